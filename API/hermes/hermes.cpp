@@ -164,7 +164,8 @@ class HermesRuntimeImpl final : public HermesRuntime,
         weakHermesValues_(runtimeConfig.getGCConfig().getOccupancyTarget()),
         rt_(::hermes::vm::Runtime::create(runtimeConfig)),
         runtime_(*rt_),
-        vmExperimentFlags_(runtimeConfig.getVMExperimentFlags()) {
+        vmExperimentFlags_(runtimeConfig.getVMExperimentFlags()),
+        sampleProfilingMaxNodes_(runtimeConfig.getSampleProfilingMaxNodes()) {
 #ifdef HERMES_ENABLE_DEBUGGER
     compileFlags_.debug = true;
 #endif
@@ -185,6 +186,7 @@ class HermesRuntimeImpl final : public HermesRuntime,
     }
 
     compileFlags_.enableGenerator = runtimeConfig.getEnableGenerator();
+    compileFlags_.parseJobs = runtimeConfig.getParseJobs();
     compileFlags_.emitAsyncBreakCheck = defaultEmitAsyncBreakCheck_ =
         runtimeConfig.getAsyncBreakCheckInEval();
     runtime_.addCustomRootsFunction(
@@ -192,6 +194,9 @@ class HermesRuntimeImpl final : public HermesRuntime,
           hermesValues_.forEach([&acceptor](HermesPointerValue &element) {
             acceptor.accept(element.value());
           });
+          scopeValues_.forEach([&acceptor](HermesPointerValue &element) {
+            acceptor.accept(element.value());
+          });
         });
     runtime_.addCustomWeakRootsFunction(
         [this](vm::GC *, vm::WeakRootAcceptor &acceptor) {
@@ -208,7 +213,8 @@ class HermesRuntimeImpl final : public HermesRuntime,
               "ManagedValues",
               vm::GCBase::IDTracker::reserved(
                   vm::GCBase::IDTracker::ReservedObjectID::JSIHermesValueList),
-              hermesValues_.capacity() * sizeof(HermesPointerValue),
+              (hermesValues_.capacity() + scopeValues_.capacity()) *
+                  sizeof(HermesPointerValue),
               0);
           snap.beginNode();
           snap.endNode(
@@ -254,6 +260,8 @@ class HermesRuntimeImpl final : public HermesRuntime,
   T add(::hermes::vm::HermesValue hv) {
     static_assert(
         std::is_base_of<jsi::Pointer, T>::value, "this type cannot be added");
+    if (scopeValues_.inScope())
+      return make<T>(&scopeValues_.add(hv));
     return make<T>(&hermesValues_.add(hv));
   }
 
@@ -315,6 +323,8 @@ class HermesRuntimeImpl final : public HermesRuntime,
     jsInfo["hermes_peakAllocatedBytes"] =
         runtime_.getHeap().getPeakAllocatedBytes();
     jsInfo["hermes_peakLiveAfterGC"] = runtime_.getHeap().getPeakLiveAfterGC();
+    jsInfo["hermes_jsiScopeValueSlots"] = scopeValues_.slotCount();
+    jsInfo["hermes_jsiEscapedScopeChunks"] = scopeValues_.escapedChunkCount();
 
 #define BRIDGE_GEN_INFO(NAME, STAT_EXPR, FACTOR)                    \
   jsInfo["hermes_full_" #NAME] = info.fullStats.STAT_EXPR * FACTOR; \
@@ -616,6 +626,13 @@ class HermesRuntimeImpl final : public HermesRuntime,
   jsi::String createStringFromUtf8(const uint8_t *utf8, size_t length) override;
   std::string utf8(const jsi::String &) override;
 
+  /// Create a string of \p length characters of type \p T stored in
+  /// \p buffer, sharing the buffer's memory if the string is long enough.
+  template <typename T>
+  jsi::String createExternalString(
+      std::shared_ptr<const jsi::Buffer> buffer,
+      size_t length);
+
   jsi::Value createValueFromJsonUtf8(const uint8_t *json, size_t length)
       override;
 
@@ -984,6 +1001,174 @@ class HermesRuntimeImpl final : public HermesRuntime,
   using HermesPointerValue = ManagedValue<vm::PinnedHermesValue>;
   using WeakRefPointerValue = ManagedValue<vm::WeakRoot<vm::JSObject>>;
 
+  // Storage for the values created while a jsi::Scope is active. Values are
+  // allocated from a stack of chunks, and each scope records the top of the
+  // stack when it is pushed, so popping it releases all of its chunks at once.
+  // A jsi::Pointer refers to its PointerValue by address, so a value that
+  // escapes its scope cannot be moved. Instead, the chunk holding it is moved
+  // off the stack, and freed once all of its values have been released.
+  class ScopeValues {
+   public:
+    static constexpr size_t kChunkSize = 16;
+
+    ScopeValues() = default;
+    ScopeValues(const ScopeValues &) = delete;
+    ScopeValues &operator=(const ScopeValues &) = delete;
+
+#ifdef ASSERT_ON_DANGLING_VM_REFS
+    // Values that are still alive are dangling, like the ones in
+    // ManagedValues. Leak their chunks so that releasing them asserts instead
+    // of touching freed memory.
+    ~ScopeValues() {
+      auto leakLive = [](std::unique_ptr<Chunk> &chunk) {
+        bool live = false;
+        for (HermesPointerValue &element : chunk->elements) {
+          if (!element.isFree()) {
+            element.markDangling();
+            live = true;
+          }
+        }
+        if (live)
+          (void)chunk.release();
+      };
+      for (auto &chunk : chunks_)
+        leakLive(chunk);
+      for (auto &chunk : escapedChunks_)
+        leakLive(chunk);
+    }
+#endif
+
+    // Whether a jsi::Scope is active.
+    bool inScope() const {
+      return !marks_.empty();
+    }
+
+    // Start a scope. Its values go into chunks that no other scope uses.
+    void push() {
+      marks_.push_back({chunks_.size(), top_});
+      top_ = kChunkSize;
+    }
+
+    // End the innermost scope, recycling the chunks it used. Chunks that hold
+    // values which are still alive are moved to escapedChunks_.
+    void pop() {
+      assert(inScope() && "popScope without matching pushScope");
+      Mark mark = marks_.back();
+      marks_.pop_back();
+      for (size_t i = mark.numChunks, e = chunks_.size(); i < e; ++i) {
+        if (isFree(*chunks_[i]))
+          recycle(std::move(chunks_[i]));
+        else
+          escapedChunks_.push_back(std::move(chunks_[i]));
+      }
+      chunks_.resize(mark.numChunks);
+      top_ = mark.top;
+      if (escapedChunks_.size() >= escapedSweepThreshold_)
+        sweepEscaped();
+    }
+
+    // Add \p hv to the innermost scope.
+    HermesPointerValue &add(vm::HermesValue hv) {
+      assert(inScope() && "No active scope");
+      if (LLVM_UNLIKELY(top_ == kChunkSize)) {
+        if (freeChunks_.empty()) {
+          chunks_.push_back(std::make_unique<Chunk>());
+        } else {
+          chunks_.push_back(std::move(freeChunks_.back()));
+          freeChunks_.pop_back();
+        }
+        top_ = 0;
+      }
+      HermesPointerValue &element = chunks_.back()->elements[top_++];
+      element.emplace(hv);
+      return element;
+    }
+
+    // Invoke \p accept on each value that has not been released.
+    template <typename Func>
+    void forEach(Func accept) {
+      auto visit = [&accept](Chunk &chunk) {
+        for (HermesPointerValue &element : chunk.elements) {
+          if (!element.isFree())
+            accept(element);
+        }
+      };
+      for (auto &chunk : chunks_)
+        visit(*chunk);
+      for (auto &chunk : escapedChunks_)
+        visit(*chunk);
+    }
+
+    // The number of slots forEach() examines, i.e. the work this adds to
+    // marking roots.
+    size_t slotCount() const {
+      return (chunks_.size() + escapedChunks_.size()) * kChunkSize;
+    }
+
+    // The number of chunks kept alive by values that escaped their scope.
+    size_t escapedChunkCount() const {
+      return escapedChunks_.size();
+    }
+
+    // The number of slots allocated, including recycled chunks.
+    size_t capacity() const {
+      return slotCount() + freeChunks_.size() * kChunkSize;
+    }
+
+   private:
+    struct Chunk {
+      HermesPointerValue elements[kChunkSize];
+    };
+
+    // The top of the stack when a scope was pushed.
+    struct Mark {
+      size_t numChunks;
+      size_t top;
+    };
+
+    // The most chunks kept for reuse after their scope is popped.
+    static constexpr size_t kMaxFreeChunks = 8;
+    // The least number of escaped chunks that triggers a sweep.
+    static constexpr size_t kMinEscapedSweepThreshold = 8;
+
+    static bool isFree(Chunk &chunk) {
+      for (HermesPointerValue &element : chunk.elements) {
+        if (!element.isFree())
+          return false;
+      }
+      return true;
+    }
+
+    void recycle(std::unique_ptr<Chunk> chunk) {
+      if (freeChunks_.size() < kMaxFreeChunks)
+        freeChunks_.push_back(std::move(chunk));
+    }
+
+    // Free the escaped chunks whose values have all been released, and sweep
+    // again when the survivors have doubled.
+    void sweepEscaped() {
+      size_t live = 0;
+      for (auto &chunk : escapedChunks_) {
+        if (isFree(*chunk))
+          recycle(std::move(chunk));
+        else
+          escapedChunks_[live++] = std::move(chunk);
+      }
+      escapedChunks_.resize(live);
+      escapedSweepThreshold_ =
+          std::max(kMinEscapedSweepThreshold, 2 * escapedChunks_.size());
+    }
+
+    std::vector<Mark> marks_;
+    // The chunks of the active scopes, innermost last.
+    std::vector<std::unique_ptr<Chunk>> chunks_;
+    // The index of the next free slot in chunks_.back().
+    size_t top_ = kChunkSize;
+    std::vector<std::unique_ptr<Chunk>> freeChunks_;
+    std::vector<std::unique_ptr<Chunk>> escapedChunks_;
+    size_t escapedSweepThreshold_ = kMinEscapedSweepThreshold;
+  };
+
   HermesPointerValue *clone(const Runtime::PointerValue *pv) {
     if (!pv) {
       return nullptr;
@@ -1007,11 +1192,17 @@ class HermesRuntimeImpl final : public HermesRuntime,
  public:
   ManagedValues<vm::PinnedHermesValue> hermesValues_;
   ManagedValues<vm::WeakRoot<vm::JSObject>> weakHermesValues_;
+  /// Values created while a jsi::Scope is active. Short-lived values never
+  /// enter hermesValues_.
+  ScopeValues scopeValues_;
   std::shared_ptr<::hermes::vm::Runtime> rt_;
   ::hermes::vm::Runtime &runtime_;
   friend class debugger::Debugger;
   std::unique_ptr<debugger::Debugger> debugger_;
   ::hermes::vm::experiments::VMExperimentFlags vmExperimentFlags_{0};
+  /// Node limit of the aggregated sampling profile, applied when the runtime
+  /// is registered for profiling. 0 if samples are not aggregated.
+  uint32_t sampleProfilingMaxNodes_{0};
 
   /// Compilation flags used by prepareJavaScript().
   ::hermes::hbc::CompileFlags compileFlags_{};
@@ -1119,6 +1310,19 @@ void HermesRuntime::sampledTraceToStreamInDevToolsFormat(std::ostream &stream) {
 #endif // HERMESVM_SAMPLING_PROFILER_AVAILABLE
 }
 
+void HermesRuntime::dumpAggregatedSampledProfile(std::ostream &stream) {
+#if HERMESVM_SAMPLING_PROFILER_AVAILABLE
+  vm::SamplingProfiler *sp = impl(this)->runtime_.samplingProfiler.get();
+  if (!sp) {
+    throw jsi::JSINativeException("Runtime not registered for profiling");
+  }
+  llvh::raw_os_ostream os(stream);
+  sp->dumpAggregatedProfile(os);
+#else
+  throwHermesNotCompiledWithSamplingProfilerSupport();
+#endif // HERMESVM_SAMPLING_PROFILER_AVAILABLE
+}
+
 /*static*/ std::unordered_map<std::string, std::vector<std::string>>
 HermesRuntime::getExecutedFunctions() {
   std::unordered_map<
@@ -1316,6 +1520,8 @@ void HermesRuntime::registerForProfiling() {
         "re-registering HermesVMs for profiling is not allowed");
   }
   runtime.samplingProfiler = ::hermes::vm::SamplingProfiler::create(runtime);
+  runtime.samplingProfiler->setAggregation(
+      impl(this)->sampleProfilingMaxNodes_);
 #else
   throwHermesNotCompiledWithSamplingProfilerSupport();
 #endif // HERMESVM_SAMPLING_PROFILER_AVAILABLE
@@ -1376,6 +1582,84 @@ jsi::Value HermesRuntime::evaluateSHUnit(SHUnit *shUnit) {
   }
 }
 
+jsi::String HermesRuntime::createExternalStringFromAscii(
+    std::shared_ptr<const jsi::Buffer> buffer) {
+  size_t length = buffer->size();
+#ifndef NDEBUG
+  for (size_t i = 0; i < length; ++i) {
+    assert(buffer->data()[i] < 128 && "non-ASCII character in string");
+  }
+#endif
+  return impl(this)->createExternalString<char>(std::move(buffer), length);
+}
+
+jsi::String HermesRuntime::createExternalStringFromUtf16(
+    std::shared_ptr<const jsi::Buffer> buffer) {
+  size_t size = buffer->size();
+  if (size % sizeof(char16_t))
+    throw jsi::JSINativeException("UTF-16 buffer size must be even");
+  return impl(this)->createExternalString<char16_t>(
+      std::move(buffer), size / sizeof(char16_t));
+}
+
+jsi::Object HermesRuntime::createObjectWithProperties(
+    const jsi::PropNameID *names,
+    const jsi::Value *values,
+    size_t count) {
+  HermesRuntimeImpl &concrete = *impl(this);
+  vm::Runtime &runtime = concrete.runtime_;
+  vm::GCScope gcScope(runtime);
+  auto obj = runtime.makeHandle(vm::JSObject::create(runtime, count));
+  vm::MutableHandle<> tmpHandle{runtime};
+  for (size_t i = 0; i < count; ++i) {
+    tmpHandle = HermesRuntimeImpl::hvFromValue(values[i]);
+    concrete.checkStatus(vm::JSObject::putNamedOrIndexed(
+                             obj,
+                             runtime,
+                             HermesRuntimeImpl::phv(names[i]).getSymbol(),
+                             tmpHandle,
+                             vm::PropOpFlags().plusThrowOnError())
+                             .getStatus());
+  }
+  return concrete.add<jsi::Object>(obj.getHermesValue());
+}
+
+void HermesRuntime::getProperties(
+    const jsi::Object &obj,
+    const jsi::PropNameID *names,
+    size_t count,
+    jsi::Value *out) {
+  HermesRuntimeImpl &concrete = *impl(this);
+  vm::Runtime &runtime = concrete.runtime_;
+  vm::GCScope gcScope(runtime);
+  auto h = concrete.handle(obj);
+  auto marker = gcScope.createMarker();
+  for (size_t i = 0; i < count; ++i) {
+    gcScope.flushToMarker(marker);
+    auto res = vm::JSObject::getNamedOrIndexed(
+        h, runtime, HermesRuntimeImpl::phv(names[i]).getSymbol());
+    concrete.checkStatus(res.getStatus());
+    out[i] = concrete.valueFromHermesValue(res->get());
+  }
+}
+
+jsi::Array HermesRuntime::createArrayFromValues(
+    const jsi::Value *values,
+    size_t count) {
+  HermesRuntimeImpl &concrete = *impl(this);
+  vm::Runtime &runtime = concrete.runtime_;
+  vm::GCScope gcScope(runtime);
+  auto arrRes = vm::JSArray::create(runtime, count, count);
+  concrete.checkStatus(arrRes.getStatus());
+  vm::Handle<vm::JSArray> arr = *arrRes;
+  vm::MutableHandle<> tmpHandle{runtime};
+  for (size_t i = 0; i < count; ++i) {
+    tmpHandle = HermesRuntimeImpl::hvFromValue(values[i]);
+    vm::JSArray::setElementAt(arr, runtime, i, tmpHandle);
+  }
+  return concrete.add<jsi::Array>(arr.getHermesValue());
+}
+
 SHRuntime *HermesRuntime::getSHRuntime() noexcept {
   return vm::getSHRuntime(impl(this)->runtime_);
 }
@@ -1735,6 +2019,33 @@ jsi::String HermesRuntimeImpl::createStringFromAscii(
   return add<jsi::String>(stringHVFromAscii(str, length));
 }
 
+template <typename T>
+jsi::String HermesRuntimeImpl::createExternalString(
+    std::shared_ptr<const jsi::Buffer> buffer,
+    size_t length) {
+  vm::GCScope gcScope(runtime_);
+  llvh::ArrayRef<T> ref(reinterpret_cast<const T *>(buffer->data()), length);
+  if (length < vm::StringPrimitive::EXTERNAL_STRING_THRESHOLD) {
+    vm::CallResult<vm::HermesValue> strRes =
+        vm::StringPrimitive::create(runtime_, ref);
+    checkStatus(strRes.getStatus());
+    return add<jsi::String>(*strRes);
+  }
+  // The string holds a reference to the buffer, which is dropped by the
+  // finalizer.
+  auto *ctx = new std::shared_ptr<const jsi::Buffer>(std::move(buffer));
+  auto release = [](void *ctx) {
+    delete static_cast<std::shared_ptr<const jsi::Buffer> *>(ctx);
+  };
+  vm::CallResult<vm::HermesValue> strRes =
+      vm::ExternalStringPrimitive<T>::createFromHost(
+          runtime_, ref, release, ctx);
+  if (LLVM_UNLIKELY(strRes == vm::ExecutionStatus::EXCEPTION))
+    release(ctx);
+  checkStatus(strRes.getStatus());
+  return add<jsi::String>(*strRes);
+}
+
 jsi::String HermesRuntimeImpl::createStringFromUtf8(
     const uint8_t *utf8,
     size_t length) {
@@ -2244,11 +2555,13 @@ bool HermesRuntimeImpl::instanceOf(
 }
 
 jsi::Runtime::ScopeState *HermesRuntimeImpl::pushScope() {
+  scopeValues_.push();
   return nullptr;
 }
 
 void HermesRuntimeImpl::popScope(ScopeState *prv) {
   assert(!prv && "pushScope only returns nullptrs");
+  scopeValues_.pop();
 }
 
 void HermesRuntimeImpl::checkStatus(vm::ExecutionStatus status) {
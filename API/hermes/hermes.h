@@ -88,6 +88,12 @@ class HERMES_EXPORT HermesRuntime : public jsi::Runtime {
   /// Profiler.stop return type.
   void sampledTraceToStreamInDevToolsFormat(std::ostream &stream);
 
+  /// Write the call tree aggregated by the sampling profiler (see
+  /// RuntimeConfig::SampleProfilingMaxNodes) to \p stream in the folded stack
+  /// format and reset it. Hosts can call this periodically to export
+  /// continuous profiles with bounded memory use.
+  void dumpAggregatedSampledProfile(std::ostream &stream);
+
   /// Return the executed JavaScript function info.
   /// This information holds the segmentID, Virtualoffset and sourceURL.
   /// This information is needed specifically to be able to symbolicate non-CJS
@@ -211,6 +217,41 @@ class HERMES_EXPORT HermesRuntime : public jsi::Runtime {
       const std::shared_ptr<const jsi::Buffer> &sourceMapBuf,
       const std::string &sourceURL);
 
+  /// Create a string whose characters are the ASCII contents of \p buffer,
+  /// without copying them. The buffer is kept alive until the GC frees the
+  /// string. Short strings are copied. ArrayBuffers backed by host memory are
+  /// created with \c createArrayBuffer().
+  ///
+  /// This is an experimental Hermes-specific API.
+  jsi::String createExternalStringFromAscii(
+      std::shared_ptr<const jsi::Buffer> buffer);
+
+  /// Same as \c createExternalStringFromAscii, but \p buffer contains UTF-16
+  /// code units in native byte order and its size must be even.
+  jsi::String createExternalStringFromUtf16(
+      std::shared_ptr<const jsi::Buffer> buffer);
+
+  /// Create an object and set its properties \p names[i] to \p values[i]
+  /// for each i in [0, \p count), in order. This is equivalent to calling
+  /// \c setProperty() for each pair, but crosses the API boundary once.
+  ///
+  /// This is an experimental Hermes-specific API.
+  jsi::Object createObjectWithProperties(
+      const jsi::PropNameID *names,
+      const jsi::Value *values,
+      size_t count);
+
+  /// Read the properties \p names[i] of \p obj into \p out[i] for each i in
+  /// [0, \p count). \p out must have room for \p count values.
+  void getProperties(
+      const jsi::Object &obj,
+      const jsi::PropNameID *names,
+      size_t count,
+      jsi::Value *out);
+
+  /// Create an array containing the \p count values in \p values.
+  jsi::Array createArrayFromValues(const jsi::Value *values, size_t count);
+
   /// Associate the specified SHUnit with this runtime and run its
   /// initialization code. The association persists until the runtime is
   /// destroyed. The unit must not be already associated with another runtime.
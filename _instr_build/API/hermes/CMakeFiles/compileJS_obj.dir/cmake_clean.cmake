@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compileJS_obj.dir/CompileJS.cpp.o"
+  "CMakeFiles/compileJS_obj.dir/CompileJS.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compileJS_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
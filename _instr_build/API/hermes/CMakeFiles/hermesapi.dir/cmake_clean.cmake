@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesapi.a"
+  "libhermesapi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesapi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
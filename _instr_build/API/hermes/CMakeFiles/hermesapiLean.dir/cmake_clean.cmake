@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesapiLean.a"
+  "libhermesapiLean.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesapiLean.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesapiLean_obj.dir/DebuggerAPI.cpp.o"
+  "CMakeFiles/hermesapiLean_obj.dir/DebuggerAPI.cpp.o.d"
+  "CMakeFiles/hermesapiLean_obj.dir/hermes.cpp.o"
+  "CMakeFiles/hermesapiLean_obj.dir/hermes.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesapiLean_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libsynthTraceParser.a"
+  "libsynthTraceParser.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/synthTraceParser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/synthTraceParser_obj.dir/SynthTraceParser.cpp.o"
+  "CMakeFiles/synthTraceParser_obj.dir/SynthTraceParser.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/synthTraceParser_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/API/hermes/SynthTrace.cpp" "API/hermes/CMakeFiles/synthTrace_obj.dir/SynthTrace.cpp.o" "gcc" "API/hermes/CMakeFiles/synthTrace_obj.dir/SynthTrace.cpp.o.d"
+  "/root/repo/API/hermes/TracingRuntime.cpp" "API/hermes/CMakeFiles/synthTrace_obj.dir/TracingRuntime.cpp.o" "gcc" "API/hermes/CMakeFiles/synthTrace_obj.dir/TracingRuntime.cpp.o.d"
+  "/root/repo/API/hermes/hermes_tracing.cpp" "API/hermes/CMakeFiles/synthTrace_obj.dir/hermes_tracing.cpp.o" "gcc" "API/hermes/CMakeFiles/synthTrace_obj.dir/hermes_tracing.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
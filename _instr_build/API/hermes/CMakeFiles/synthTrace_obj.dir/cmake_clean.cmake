@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/synthTrace_obj.dir/SynthTrace.cpp.o"
+  "CMakeFiles/synthTrace_obj.dir/SynthTrace.cpp.o.d"
+  "CMakeFiles/synthTrace_obj.dir/TracingRuntime.cpp.o"
+  "CMakeFiles/synthTrace_obj.dir/TracingRuntime.cpp.o.d"
+  "CMakeFiles/synthTrace_obj.dir/hermes_tracing.cpp.o"
+  "CMakeFiles/synthTrace_obj.dir/hermes_tracing.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/synthTrace_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libtimerStats.a"
+  "libtimerStats.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timerStats.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/timerStats_obj.dir/TimerStats.cpp.o"
+  "CMakeFiles/timerStats_obj.dir/TimerStats.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timerStats_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
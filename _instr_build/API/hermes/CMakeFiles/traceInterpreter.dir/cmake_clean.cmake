@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libtraceInterpreter.a"
+  "libtraceInterpreter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/traceInterpreter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
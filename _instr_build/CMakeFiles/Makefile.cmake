@@ -0,0 +1,380 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/API/CMakeLists.txt"
+  "/root/repo/API/hermes/CMakeLists.txt"
+  "/root/repo/API/jsi/jsi/CMakeLists.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/android/intltest/java/com/facebook/hermes/test/CMakeLists.txt"
+  "/root/repo/cmake/modules/Hermes.cmake"
+  "/root/repo/cmake/modules/Lit.cmake"
+  "/root/repo/external/CMakeLists.txt"
+  "/root/repo/external/dtoa/CMakeLists.txt"
+  "/root/repo/external/llvh/CMakeLists.txt"
+  "/root/repo/external/llvh/cmake/config-ix.cmake"
+  "/root/repo/external/llvh/cmake/modules/CheckAtomic.cmake"
+  "/root/repo/external/llvh/cmake/modules/CheckCompilerVersion.cmake"
+  "/root/repo/external/llvh/cmake/modules/CheckLinkerFlag.cmake"
+  "/root/repo/external/llvh/cmake/modules/DetermineGCCCompatible.cmake"
+  "/root/repo/external/llvh/cmake/modules/FindLibpfm.cmake"
+  "/root/repo/external/llvh/cmake/modules/GetHostTriple.cmake"
+  "/root/repo/external/llvh/cmake/modules/HandleLLVMStdlib.cmake"
+  "/root/repo/external/llvh/include/llvh/Config/config.h.cmake"
+  "/root/repo/external/llvh/include/llvh/Config/llvm-config.h.cmake"
+  "/root/repo/external/llvh/lib/CMakeLists.txt"
+  "/root/repo/external/llvh/lib/Demangle/CMakeLists.txt"
+  "/root/repo/external/llvh/lib/Support/CMakeLists.txt"
+  "/root/repo/external/llvh/lib/TableGen/CMakeLists.txt"
+  "/root/repo/external/llvh/utils/FileCheck/CMakeLists.txt"
+  "/root/repo/external/llvh/utils/TableGen/CMakeLists.txt"
+  "/root/repo/external/llvh/utils/count/CMakeLists.txt"
+  "/root/repo/external/llvh/utils/not/CMakeLists.txt"
+  "/root/repo/external/llvh/utils/unittest/CMakeLists.txt"
+  "/root/repo/external/llvh/utils/unittest/UnitTestMain/CMakeLists.txt"
+  "/root/repo/external/zip/CMakeLists.txt"
+  "/root/repo/lib/ADT/CMakeLists.txt"
+  "/root/repo/lib/AST/CMakeLists.txt"
+  "/root/repo/lib/AST2JS/CMakeLists.txt"
+  "/root/repo/lib/BCGen/CMakeLists.txt"
+  "/root/repo/lib/BCGen/HBC/CMakeLists.txt"
+  "/root/repo/lib/BCGen/SH/CMakeLists.txt"
+  "/root/repo/lib/CMakeLists.txt"
+  "/root/repo/lib/CompilerDriver/CMakeLists.txt"
+  "/root/repo/lib/ConsoleHost/CMakeLists.txt"
+  "/root/repo/lib/DependencyExtractor/CMakeLists.txt"
+  "/root/repo/lib/FrontEndDefs/CMakeLists.txt"
+  "/root/repo/lib/Inst/CMakeLists.txt"
+  "/root/repo/lib/InternalJavaScript/CMakeLists.txt"
+  "/root/repo/lib/Parser/CMakeLists.txt"
+  "/root/repo/lib/Platform/CMakeLists.txt"
+  "/root/repo/lib/Platform/Intl/CMakeLists.txt"
+  "/root/repo/lib/Platform/Unicode/CMakeLists.txt"
+  "/root/repo/lib/Regex/CMakeLists.txt"
+  "/root/repo/lib/Sema/CMakeLists.txt"
+  "/root/repo/lib/SourceMap/CMakeLists.txt"
+  "/root/repo/lib/Support/CMakeLists.txt"
+  "/root/repo/lib/VM/CMakeLists.txt"
+  "/root/repo/lib/VM/Instrumentation/CMakeLists.txt"
+  "/root/repo/lib/config/libhermesvm-config.h.in"
+  "/root/repo/public/CMakeLists.txt"
+  "/root/repo/public/hermes/Public/CMakeLists.txt"
+  "/root/repo/tools/CMakeLists.txt"
+  "/root/repo/tools/dependency-extractor/CMakeLists.txt"
+  "/root/repo/tools/emhermesc/CMakeLists.txt"
+  "/root/repo/tools/fuzzers/CMakeLists.txt"
+  "/root/repo/tools/fuzzers/fuzzilli/CMakeLists.txt"
+  "/root/repo/tools/fuzzers/libfuzzer/CMakeLists.txt"
+  "/root/repo/tools/hbc-attribute/CMakeLists.txt"
+  "/root/repo/tools/hbc-deltaprep/CMakeLists.txt"
+  "/root/repo/tools/hbc-diff/CMakeLists.txt"
+  "/root/repo/tools/hbcdump/CMakeLists.txt"
+  "/root/repo/tools/hdb/CMakeLists.txt"
+  "/root/repo/tools/hermes-parser/CMakeLists.txt"
+  "/root/repo/tools/hermes/CMakeLists.txt"
+  "/root/repo/tools/hermesc/CMakeLists.txt"
+  "/root/repo/tools/hvm-bench/CMakeLists.txt"
+  "/root/repo/tools/hvm/CMakeLists.txt"
+  "/root/repo/tools/jsi/CMakeLists.txt"
+  "/root/repo/tools/node-hermes/CMakeLists.txt"
+  "/root/repo/tools/sh_api_use/CMakeLists.txt"
+  "/root/repo/tools/sh_debug_skel/CMakeLists.txt"
+  "/root/repo/tools/shermes/CMakeLists.txt"
+  "/root/repo/tools/source-map-index/CMakeLists.txt"
+  "/root/repo/tools/synth/CMakeLists.txt"
+  "/root/repo/unittests/ADT/CMakeLists.txt"
+  "/root/repo/unittests/API/CMakeLists.txt"
+  "/root/repo/unittests/AST/CMakeLists.txt"
+  "/root/repo/unittests/CMakeLists.txt"
+  "/root/repo/unittests/IR/CMakeLists.txt"
+  "/root/repo/unittests/Optimizer/CMakeLists.txt"
+  "/root/repo/unittests/Parser/CMakeLists.txt"
+  "/root/repo/unittests/PlatformIntl/CMakeLists.txt"
+  "/root/repo/unittests/PlatformUnicode/CMakeLists.txt"
+  "/root/repo/unittests/SourceMap/CMakeLists.txt"
+  "/root/repo/unittests/Support/CMakeLists.txt"
+  "/root/repo/unittests/VMRuntime/CMakeLists.txt"
+  "/root/repo/unittests/VMRuntime/Instrumentation/CMakeLists.txt"
+  "/root/repo/unittests/dtoa/CMakeLists.txt"
+  "/root/repo/utils/hermes-lit/CMakeLists.txt"
+  "/root/repo/utils/hermes-lit/hermes-lit.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePrintHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePushCheckState.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLinkerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBacktrace.cmake"
+  "/usr/share/cmake-3.25/Modules/FindICU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckLinkerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "external/llvh/include/llvh/Config/config.h"
+  "external/llvh/include/llvh/Config/llvm-config.h"
+  "external/llvh/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "external/llvh/lib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "external/llvh/lib/Support/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "external/llvh/lib/Demangle/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "external/llvh/lib/TableGen/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "external/llvh/utils/FileCheck/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "external/llvh/utils/TableGen/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "external/llvh/utils/not/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "external/llvh/utils/count/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "external/llvh/utils/unittest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "external/llvh/utils/unittest/UnitTestMain/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bin/hermes-lit"
+  "utils/hermes-lit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/config/libhermesvm-config.h"
+  "lib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/VM/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/VM/Instrumentation/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/Inst/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/FrontEndDefs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/CompilerDriver/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/DependencyExtractor/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/ADT/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/AST/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/AST2JS/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/Parser/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/SourceMap/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/Support/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/BCGen/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/BCGen/HBC/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/BCGen/SH/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/ConsoleHost/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/Regex/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/Platform/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/Platform/Intl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/Platform/Unicode/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/InternalJavaScript/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/Sema/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "public/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "public/hermes/Public/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "external/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "external/dtoa/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "external/zip/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "API/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "API/hermes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "android/intltest/java/com/facebook/hermes/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/hermes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/hermesc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/hdb/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/hbcdump/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/hvm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/hvm-bench/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/hbc-diff/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/hbc-deltaprep/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/hbc-attribute/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/source-map-index/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/jsi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/emhermesc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/fuzzers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/fuzzers/libfuzzer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/fuzzers/fuzzilli/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/dependency-extractor/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/hermes-parser/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/node-hermes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/shermes/Debug/config.h"
+  "tools/shermes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/synth/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/sh_api_use/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/sh_debug_skel/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "jsi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unittests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unittests/AST/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unittests/IR/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unittests/Parser/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unittests/SourceMap/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unittests/VMRuntime/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unittests/VMRuntime/Instrumentation/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unittests/Support/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unittests/dtoa/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unittests/PlatformIntl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unittests/PlatformUnicode/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unittests/API/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unittests/ADT/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unittests/Optimizer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/check-hermes.dir/DependInfo.cmake"
+  "CMakeFiles/check-shermes.dir/DependInfo.cmake"
+  "CMakeFiles/update-lit.dir/DependInfo.cmake"
+  "external/llvh/CMakeFiles/check-llvh.dir/DependInfo.cmake"
+  "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/DependInfo.cmake"
+  "external/llvh/lib/Support/CMakeFiles/LLVHSupport.dir/DependInfo.cmake"
+  "external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle_obj.dir/DependInfo.cmake"
+  "external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/DependInfo.cmake"
+  "external/llvh/lib/TableGen/CMakeFiles/LLVHTableGen_obj.dir/DependInfo.cmake"
+  "external/llvh/lib/TableGen/CMakeFiles/LLVHTableGen.dir/DependInfo.cmake"
+  "external/llvh/utils/FileCheck/CMakeFiles/FileCheck.dir/DependInfo.cmake"
+  "external/llvh/utils/TableGen/CMakeFiles/llvh-tblgen.dir/DependInfo.cmake"
+  "external/llvh/utils/not/CMakeFiles/not.dir/DependInfo.cmake"
+  "external/llvh/utils/count/CMakeFiles/count.dir/DependInfo.cmake"
+  "external/llvh/utils/unittest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "external/llvh/utils/unittest/UnitTestMain/CMakeFiles/gtest_main_obj.dir/DependInfo.cmake"
+  "external/llvh/utils/unittest/UnitTestMain/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "lib/CMakeFiles/hermesOptimizer_obj.dir/DependInfo.cmake"
+  "lib/CMakeFiles/hermesOptimizer.dir/DependInfo.cmake"
+  "lib/CMakeFiles/hermesFrontend_obj.dir/DependInfo.cmake"
+  "lib/CMakeFiles/hermesFrontend.dir/DependInfo.cmake"
+  "lib/CMakeFiles/hermescompiler.dir/DependInfo.cmake"
+  "lib/CMakeFiles/hermesvm_a.dir/DependInfo.cmake"
+  "lib/CMakeFiles/hermesvmlean_a.dir/DependInfo.cmake"
+  "lib/CMakeFiles/hermesvm.dir/DependInfo.cmake"
+  "lib/CMakeFiles/hermesvmlean.dir/DependInfo.cmake"
+  "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/DependInfo.cmake"
+  "lib/VM/CMakeFiles/hermesVMRuntime.dir/DependInfo.cmake"
+  "lib/VM/CMakeFiles/hermesVMRuntimeLean_obj.dir/DependInfo.cmake"
+  "lib/VM/CMakeFiles/hermesVMRuntimeLean.dir/DependInfo.cmake"
+  "lib/VM/Instrumentation/CMakeFiles/hermesInstrumentation_obj.dir/DependInfo.cmake"
+  "lib/VM/Instrumentation/CMakeFiles/hermesInstrumentation.dir/DependInfo.cmake"
+  "lib/Inst/CMakeFiles/hermesInst_obj.dir/DependInfo.cmake"
+  "lib/Inst/CMakeFiles/hermesInst.dir/DependInfo.cmake"
+  "lib/FrontEndDefs/CMakeFiles/hermesFrontEndDefs_obj.dir/DependInfo.cmake"
+  "lib/FrontEndDefs/CMakeFiles/hermesFrontEndDefs.dir/DependInfo.cmake"
+  "lib/CompilerDriver/CMakeFiles/hermesCompilerDriver_obj.dir/DependInfo.cmake"
+  "lib/CompilerDriver/CMakeFiles/hermesCompilerDriver.dir/DependInfo.cmake"
+  "lib/DependencyExtractor/CMakeFiles/hermesDependencyExtractor_obj.dir/DependInfo.cmake"
+  "lib/DependencyExtractor/CMakeFiles/hermesDependencyExtractor.dir/DependInfo.cmake"
+  "lib/ADT/CMakeFiles/hermesADT_obj.dir/DependInfo.cmake"
+  "lib/ADT/CMakeFiles/hermesADT.dir/DependInfo.cmake"
+  "lib/AST/CMakeFiles/hermesAST_obj.dir/DependInfo.cmake"
+  "lib/AST/CMakeFiles/hermesAST.dir/DependInfo.cmake"
+  "lib/AST2JS/CMakeFiles/hermesAST2JS_obj.dir/DependInfo.cmake"
+  "lib/AST2JS/CMakeFiles/hermesAST2JS.dir/DependInfo.cmake"
+  "lib/Parser/CMakeFiles/hermesParser_obj.dir/DependInfo.cmake"
+  "lib/Parser/CMakeFiles/hermesParser.dir/DependInfo.cmake"
+  "lib/SourceMap/CMakeFiles/hermesSourceMap_obj.dir/DependInfo.cmake"
+  "lib/SourceMap/CMakeFiles/hermesSourceMap.dir/DependInfo.cmake"
+  "lib/Support/CMakeFiles/hermesSupport_obj.dir/DependInfo.cmake"
+  "lib/Support/CMakeFiles/hermesSupport.dir/DependInfo.cmake"
+  "lib/BCGen/CMakeFiles/hermesBackend_obj.dir/DependInfo.cmake"
+  "lib/BCGen/CMakeFiles/hermesBackend.dir/DependInfo.cmake"
+  "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/DependInfo.cmake"
+  "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/DependInfo.cmake"
+  "lib/BCGen/HBC/CMakeFiles/hermesHBCBackendLean_obj.dir/DependInfo.cmake"
+  "lib/BCGen/HBC/CMakeFiles/hermesHBCBackendLean.dir/DependInfo.cmake"
+  "lib/BCGen/SH/CMakeFiles/hermesSHBackend_obj.dir/DependInfo.cmake"
+  "lib/BCGen/SH/CMakeFiles/hermesSHBackend.dir/DependInfo.cmake"
+  "lib/ConsoleHost/CMakeFiles/hermesConsoleHost_obj.dir/DependInfo.cmake"
+  "lib/ConsoleHost/CMakeFiles/hermesConsoleHost.dir/DependInfo.cmake"
+  "lib/Regex/CMakeFiles/hermesRegex_obj.dir/DependInfo.cmake"
+  "lib/Regex/CMakeFiles/hermesRegex.dir/DependInfo.cmake"
+  "lib/Platform/CMakeFiles/hermesPlatform_obj.dir/DependInfo.cmake"
+  "lib/Platform/CMakeFiles/hermesPlatform.dir/DependInfo.cmake"
+  "lib/Platform/Intl/CMakeFiles/hermesBCP47Parser_obj.dir/DependInfo.cmake"
+  "lib/Platform/Intl/CMakeFiles/hermesBCP47Parser.dir/DependInfo.cmake"
+  "lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode_obj.dir/DependInfo.cmake"
+  "lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/DependInfo.cmake"
+  "lib/InternalJavaScript/CMakeFiles/hermesInternalUnit_obj.dir/DependInfo.cmake"
+  "lib/InternalJavaScript/CMakeFiles/hermesInternalUnit.dir/DependInfo.cmake"
+  "lib/Sema/CMakeFiles/hermesSema_obj.dir/DependInfo.cmake"
+  "lib/Sema/CMakeFiles/hermesSema.dir/DependInfo.cmake"
+  "public/hermes/Public/CMakeFiles/hermesPublic_obj.dir/DependInfo.cmake"
+  "public/hermes/Public/CMakeFiles/hermesPublic.dir/DependInfo.cmake"
+  "external/dtoa/CMakeFiles/dtoa_obj.dir/DependInfo.cmake"
+  "external/dtoa/CMakeFiles/dtoa.dir/DependInfo.cmake"
+  "external/zip/CMakeFiles/zip_obj.dir/DependInfo.cmake"
+  "external/zip/CMakeFiles/zip.dir/DependInfo.cmake"
+  "API/hermes/CMakeFiles/hermesapi_obj.dir/DependInfo.cmake"
+  "API/hermes/CMakeFiles/hermesapi.dir/DependInfo.cmake"
+  "API/hermes/CMakeFiles/hermesapiLean_obj.dir/DependInfo.cmake"
+  "API/hermes/CMakeFiles/hermesapiLean.dir/DependInfo.cmake"
+  "API/hermes/CMakeFiles/synthTrace_obj.dir/DependInfo.cmake"
+  "API/hermes/CMakeFiles/synthTrace.dir/DependInfo.cmake"
+  "API/hermes/CMakeFiles/timerStats_obj.dir/DependInfo.cmake"
+  "API/hermes/CMakeFiles/timerStats.dir/DependInfo.cmake"
+  "API/hermes/CMakeFiles/traceInterpreter_obj.dir/DependInfo.cmake"
+  "API/hermes/CMakeFiles/traceInterpreter.dir/DependInfo.cmake"
+  "API/hermes/CMakeFiles/synthTraceParser_obj.dir/DependInfo.cmake"
+  "API/hermes/CMakeFiles/synthTraceParser.dir/DependInfo.cmake"
+  "API/hermes/CMakeFiles/compileJS_obj.dir/DependInfo.cmake"
+  "API/hermes/CMakeFiles/compileJS.dir/DependInfo.cmake"
+  "tools/hermes/CMakeFiles/hermes.dir/DependInfo.cmake"
+  "tools/hermesc/CMakeFiles/hermesc.dir/DependInfo.cmake"
+  "tools/hdb/CMakeFiles/hdb.dir/DependInfo.cmake"
+  "tools/hbcdump/CMakeFiles/hbcdump.dir/DependInfo.cmake"
+  "tools/hvm/CMakeFiles/hvm.dir/DependInfo.cmake"
+  "tools/hvm-bench/CMakeFiles/interp-dispatch-bench.dir/DependInfo.cmake"
+  "tools/hvm-bench/CMakeFiles/lexer-bench.dir/DependInfo.cmake"
+  "tools/hbc-diff/CMakeFiles/hbc-diff.dir/DependInfo.cmake"
+  "tools/hbc-deltaprep/CMakeFiles/hbc-deltaprep.dir/DependInfo.cmake"
+  "tools/hbc-attribute/CMakeFiles/hbc-attribute.dir/DependInfo.cmake"
+  "tools/source-map-index/CMakeFiles/source-map-index.dir/DependInfo.cmake"
+  "tools/jsi/CMakeFiles/hermes-jsi.dir/DependInfo.cmake"
+  "tools/emhermesc/CMakeFiles/emhermesc.dir/DependInfo.cmake"
+  "tools/dependency-extractor/CMakeFiles/dependency-extractor.dir/DependInfo.cmake"
+  "tools/dependency-extractor/CMakeFiles/emdependency-extractor.dir/DependInfo.cmake"
+  "tools/shermes/CMakeFiles/shermes.dir/DependInfo.cmake"
+  "tools/shermes/CMakeFiles/shermes-dep.dir/DependInfo.cmake"
+  "tools/synth/CMakeFiles/synth.dir/DependInfo.cmake"
+  "tools/sh_api_use/CMakeFiles/sh_api_use.dir/DependInfo.cmake"
+  "tools/sh_debug_skel/CMakeFiles/sh_debug_skel.dir/DependInfo.cmake"
+  "jsi/CMakeFiles/jsi.dir/DependInfo.cmake"
+  "unittests/CMakeFiles/HermesUnitTests.dir/DependInfo.cmake"
+  "unittests/AST/CMakeFiles/HermesASTTests.dir/DependInfo.cmake"
+  "unittests/IR/CMakeFiles/HermesIRTests.dir/DependInfo.cmake"
+  "unittests/Parser/CMakeFiles/HermesParserTests.dir/DependInfo.cmake"
+  "unittests/SourceMap/CMakeFiles/HermesSourceMapTests.dir/DependInfo.cmake"
+  "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/DependInfo.cmake"
+  "unittests/VMRuntime/Instrumentation/CMakeFiles/HermesInstrumentationTests.dir/DependInfo.cmake"
+  "unittests/Support/CMakeFiles/HermesSupportTests.dir/DependInfo.cmake"
+  "unittests/dtoa/CMakeFiles/DtoaTests.dir/DependInfo.cmake"
+  "unittests/PlatformIntl/CMakeFiles/BCP47ParserTests.dir/DependInfo.cmake"
+  "unittests/PlatformUnicode/CMakeFiles/PlatformUnicodeTests.dir/DependInfo.cmake"
+  "unittests/API/CMakeFiles/APILeanTests.dir/DependInfo.cmake"
+  "unittests/ADT/CMakeFiles/HermesADTTests.dir/DependInfo.cmake"
+  "unittests/Optimizer/CMakeFiles/HermesOptimizerTests.dir/DependInfo.cmake"
+  )
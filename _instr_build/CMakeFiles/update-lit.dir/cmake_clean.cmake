@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/update-lit"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/update-lit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
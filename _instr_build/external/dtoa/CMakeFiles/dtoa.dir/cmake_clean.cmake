@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libdtoa.a"
+  "libdtoa.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/dtoa.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libLLVHDemangle.a"
+  "libLLVHDemangle.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/LLVHDemangle.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
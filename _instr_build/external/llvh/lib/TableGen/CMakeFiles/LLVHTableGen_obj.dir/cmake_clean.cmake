@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/LLVHTableGen_obj.dir/Error.cpp.o"
+  "CMakeFiles/LLVHTableGen_obj.dir/Error.cpp.o.d"
+  "CMakeFiles/LLVHTableGen_obj.dir/JSONBackend.cpp.o"
+  "CMakeFiles/LLVHTableGen_obj.dir/JSONBackend.cpp.o.d"
+  "CMakeFiles/LLVHTableGen_obj.dir/Main.cpp.o"
+  "CMakeFiles/LLVHTableGen_obj.dir/Main.cpp.o.d"
+  "CMakeFiles/LLVHTableGen_obj.dir/Record.cpp.o"
+  "CMakeFiles/LLVHTableGen_obj.dir/Record.cpp.o.d"
+  "CMakeFiles/LLVHTableGen_obj.dir/SetTheory.cpp.o"
+  "CMakeFiles/LLVHTableGen_obj.dir/SetTheory.cpp.o.d"
+  "CMakeFiles/LLVHTableGen_obj.dir/StringMatcher.cpp.o"
+  "CMakeFiles/LLVHTableGen_obj.dir/StringMatcher.cpp.o.d"
+  "CMakeFiles/LLVHTableGen_obj.dir/TGLexer.cpp.o"
+  "CMakeFiles/LLVHTableGen_obj.dir/TGLexer.cpp.o.d"
+  "CMakeFiles/LLVHTableGen_obj.dir/TGParser.cpp.o"
+  "CMakeFiles/LLVHTableGen_obj.dir/TGParser.cpp.o.d"
+  "CMakeFiles/LLVHTableGen_obj.dir/TableGenBackend.cpp.o"
+  "CMakeFiles/LLVHTableGen_obj.dir/TableGenBackend.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/LLVHTableGen_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/external/llvh/utils/TableGen/Example.cpp" "external/llvh/utils/TableGen/CMakeFiles/llvh-tblgen.dir/Example.cpp.o" "gcc" "external/llvh/utils/TableGen/CMakeFiles/llvh-tblgen.dir/Example.cpp.o.d"
+  "/root/repo/external/llvh/utils/TableGen/TableGen.cpp" "external/llvh/utils/TableGen/CMakeFiles/llvh-tblgen.dir/TableGen.cpp.o" "gcc" "external/llvh/utils/TableGen/CMakeFiles/llvh-tblgen.dir/TableGen.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_instr_build/external/llvh/lib/Support/CMakeFiles/LLVHSupport.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/external/llvh/lib/TableGen/CMakeFiles/LLVHTableGen.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/count"
+  "../../../../bin/count.pdb"
+  "CMakeFiles/count.dir/count.c.o"
+  "CMakeFiles/count.dir/count.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/count.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
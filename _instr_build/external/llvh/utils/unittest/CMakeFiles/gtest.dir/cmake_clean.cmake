@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gtest.dir/googlemock/src/gmock-all.cc.o"
+  "CMakeFiles/gtest.dir/googlemock/src/gmock-all.cc.o.d"
+  "CMakeFiles/gtest.dir/googletest/src/gtest-all.cc.o"
+  "CMakeFiles/gtest.dir/googletest/src/gtest-all.cc.o.d"
+  "libgtest.a"
+  "libgtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
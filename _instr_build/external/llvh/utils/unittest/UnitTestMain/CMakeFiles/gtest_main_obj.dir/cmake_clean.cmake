@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gtest_main_obj.dir/TestMain.cpp.o"
+  "CMakeFiles/gtest_main_obj.dir/TestMain.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gtest_main_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
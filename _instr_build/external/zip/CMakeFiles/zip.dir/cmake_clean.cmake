@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libzip.a"
+  "libzip.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/zip.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/jsi.dir/jsi.cpp.o"
+  "CMakeFiles/jsi.dir/jsi.cpp.o.d"
+  "libjsi.a"
+  "libjsi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/jsi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
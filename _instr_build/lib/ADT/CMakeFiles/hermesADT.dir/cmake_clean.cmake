@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesADT.a"
+  "libhermesADT.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesADT.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
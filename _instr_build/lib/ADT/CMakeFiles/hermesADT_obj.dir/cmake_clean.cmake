@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesADT_obj.dir/CompactArray.cpp.o"
+  "CMakeFiles/hermesADT_obj.dir/CompactArray.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesADT_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
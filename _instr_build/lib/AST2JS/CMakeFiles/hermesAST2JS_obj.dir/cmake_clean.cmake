@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesAST2JS_obj.dir/AST2JS.cpp.o"
+  "CMakeFiles/hermesAST2JS_obj.dir/AST2JS.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesAST2JS_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
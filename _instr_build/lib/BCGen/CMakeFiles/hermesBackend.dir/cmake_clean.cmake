@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesBackend.a"
+  "libhermesBackend.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesBackend.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesBackend_obj.dir/BackendContext.cpp.o"
+  "CMakeFiles/hermesBackend_obj.dir/BackendContext.cpp.o.d"
+  "CMakeFiles/hermesBackend_obj.dir/Exceptions.cpp.o"
+  "CMakeFiles/hermesBackend_obj.dir/Exceptions.cpp.o.d"
+  "CMakeFiles/hermesBackend_obj.dir/LIRPeephole.cpp.o"
+  "CMakeFiles/hermesBackend_obj.dir/LIRPeephole.cpp.o.d"
+  "CMakeFiles/hermesBackend_obj.dir/LowerBuiltinCalls.cpp.o"
+  "CMakeFiles/hermesBackend_obj.dir/LowerBuiltinCalls.cpp.o.d"
+  "CMakeFiles/hermesBackend_obj.dir/Lowering.cpp.o"
+  "CMakeFiles/hermesBackend_obj.dir/Lowering.cpp.o.d"
+  "CMakeFiles/hermesBackend_obj.dir/RegAlloc.cpp.o"
+  "CMakeFiles/hermesBackend_obj.dir/RegAlloc.cpp.o.d"
+  "CMakeFiles/hermesBackend_obj.dir/SerializedLiteralGenerator.cpp.o"
+  "CMakeFiles/hermesBackend_obj.dir/SerializedLiteralGenerator.cpp.o.d"
+  "CMakeFiles/hermesBackend_obj.dir/SerializedLiteralParserBase.cpp.o"
+  "CMakeFiles/hermesBackend_obj.dir/SerializedLiteralParserBase.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesBackend_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesHBCBackendLean.a"
+  "libhermesHBCBackendLean.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesHBCBackendLean.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesHBCBackendLean_obj.dir/BytecodeDataProvider.cpp.o"
+  "CMakeFiles/hermesHBCBackendLean_obj.dir/BytecodeDataProvider.cpp.o.d"
+  "CMakeFiles/hermesHBCBackendLean_obj.dir/ConsecutiveStringStorage.cpp.o"
+  "CMakeFiles/hermesHBCBackendLean_obj.dir/ConsecutiveStringStorage.cpp.o.d"
+  "CMakeFiles/hermesHBCBackendLean_obj.dir/DebugInfo.cpp.o"
+  "CMakeFiles/hermesHBCBackendLean_obj.dir/DebugInfo.cpp.o.d"
+  "CMakeFiles/hermesHBCBackendLean_obj.dir/SimpleBytecodeBuilder.cpp.o"
+  "CMakeFiles/hermesHBCBackendLean_obj.dir/SimpleBytecodeBuilder.cpp.o.d"
+  "CMakeFiles/hermesHBCBackendLean_obj.dir/UniquingFilenameTable.cpp.o"
+  "CMakeFiles/hermesHBCBackendLean_obj.dir/UniquingFilenameTable.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesHBCBackendLean_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
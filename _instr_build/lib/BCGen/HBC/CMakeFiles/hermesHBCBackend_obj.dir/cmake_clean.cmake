@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesHBCBackend_obj.dir/Bytecode.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/Bytecode.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/BytecodeDataProvider.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/BytecodeDataProvider.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/BytecodeDisassembler.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/BytecodeDisassembler.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/BytecodeFormConverter.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/BytecodeFormConverter.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/BytecodeGenerator.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/BytecodeGenerator.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/BytecodeProviderFromSrc.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/BytecodeProviderFromSrc.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/BytecodeStream.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/BytecodeStream.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/ConsecutiveStringStorage.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/ConsecutiveStringStorage.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/DebugInfo.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/DebugInfo.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/HBC.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/HBC.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/ISel.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/ISel.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/Passes.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/Passes.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/Passes/FuncCallNOpts.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/Passes/FuncCallNOpts.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/Passes/InsertProfilePoint.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/Passes/InsertProfilePoint.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/Passes/OptEnvironmentInit.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/Passes/OptEnvironmentInit.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/SimpleBytecodeBuilder.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/SimpleBytecodeBuilder.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/StringKind.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/StringKind.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/TraverseLiteralStrings.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/TraverseLiteralStrings.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/UniquingFilenameTable.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/UniquingFilenameTable.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/UniquingStringLiteralTable.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/UniquingStringLiteralTable.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesHBCBackend_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
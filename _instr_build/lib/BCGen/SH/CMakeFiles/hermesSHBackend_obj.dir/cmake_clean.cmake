@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesSHBackend_obj.dir/LineDirectiveEmitter.cpp.o"
+  "CMakeFiles/hermesSHBackend_obj.dir/LineDirectiveEmitter.cpp.o.d"
+  "CMakeFiles/hermesSHBackend_obj.dir/LowerAllocObjectLiteral.cpp.o"
+  "CMakeFiles/hermesSHBackend_obj.dir/LowerAllocObjectLiteral.cpp.o.d"
+  "CMakeFiles/hermesSHBackend_obj.dir/LowerCalls.cpp.o"
+  "CMakeFiles/hermesSHBackend_obj.dir/LowerCalls.cpp.o.d"
+  "CMakeFiles/hermesSHBackend_obj.dir/LowerNanBoxedUnionNarrowT.cpp.o"
+  "CMakeFiles/hermesSHBackend_obj.dir/LowerNanBoxedUnionNarrowT.cpp.o.d"
+  "CMakeFiles/hermesSHBackend_obj.dir/RecreateCheapValues.cpp.o"
+  "CMakeFiles/hermesSHBackend_obj.dir/RecreateCheapValues.cpp.o.d"
+  "CMakeFiles/hermesSHBackend_obj.dir/SH.cpp.o"
+  "CMakeFiles/hermesSHBackend_obj.dir/SH.cpp.o.d"
+  "CMakeFiles/hermesSHBackend_obj.dir/SHRegAlloc.cpp.o"
+  "CMakeFiles/hermesSHBackend_obj.dir/SHRegAlloc.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesSHBackend_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesFrontend.a"
+  "libhermesFrontend.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesFrontend.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
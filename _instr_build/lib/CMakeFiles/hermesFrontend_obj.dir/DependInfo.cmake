@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/IR/CFG.cpp" "lib/CMakeFiles/hermesFrontend_obj.dir/IR/CFG.cpp.o" "gcc" "lib/CMakeFiles/hermesFrontend_obj.dir/IR/CFG.cpp.o.d"
+  "/root/repo/lib/IR/ExecutionProfile.cpp" "lib/CMakeFiles/hermesFrontend_obj.dir/IR/ExecutionProfile.cpp.o" "gcc" "lib/CMakeFiles/hermesFrontend_obj.dir/IR/ExecutionProfile.cpp.o.d"
+  "/root/repo/lib/IR/IR.cpp" "lib/CMakeFiles/hermesFrontend_obj.dir/IR/IR.cpp.o" "gcc" "lib/CMakeFiles/hermesFrontend_obj.dir/IR/IR.cpp.o.d"
+  "/root/repo/lib/IR/IRBuilder.cpp" "lib/CMakeFiles/hermesFrontend_obj.dir/IR/IRBuilder.cpp.o" "gcc" "lib/CMakeFiles/hermesFrontend_obj.dir/IR/IRBuilder.cpp.o.d"
+  "/root/repo/lib/IR/IRVerifier.cpp" "lib/CMakeFiles/hermesFrontend_obj.dir/IR/IRVerifier.cpp.o" "gcc" "lib/CMakeFiles/hermesFrontend_obj.dir/IR/IRVerifier.cpp.o.d"
+  "/root/repo/lib/IR/Instrs.cpp" "lib/CMakeFiles/hermesFrontend_obj.dir/IR/Instrs.cpp.o" "gcc" "lib/CMakeFiles/hermesFrontend_obj.dir/IR/Instrs.cpp.o.d"
+  "/root/repo/lib/IRGen/ESTreeIRGen-class.cpp" "lib/CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen-class.cpp.o" "gcc" "lib/CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen-class.cpp.o.d"
+  "/root/repo/lib/IRGen/ESTreeIRGen-except.cpp" "lib/CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen-except.cpp.o" "gcc" "lib/CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen-except.cpp.o.d"
+  "/root/repo/lib/IRGen/ESTreeIRGen-expr.cpp" "lib/CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen-expr.cpp.o" "gcc" "lib/CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen-expr.cpp.o.d"
+  "/root/repo/lib/IRGen/ESTreeIRGen-func.cpp" "lib/CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen-func.cpp.o" "gcc" "lib/CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen-func.cpp.o.d"
+  "/root/repo/lib/IRGen/ESTreeIRGen-stmt.cpp" "lib/CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen-stmt.cpp.o" "gcc" "lib/CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen-stmt.cpp.o.d"
+  "/root/repo/lib/IRGen/ESTreeIRGen.cpp" "lib/CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen.cpp.o" "gcc" "lib/CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen.cpp.o.d"
+  "/root/repo/lib/IRGen/IRGen.cpp" "lib/CMakeFiles/hermesFrontend_obj.dir/IRGen/IRGen.cpp.o" "gcc" "lib/CMakeFiles/hermesFrontend_obj.dir/IRGen/IRGen.cpp.o.d"
+  "/root/repo/lib/Utils/Dumper.cpp" "lib/CMakeFiles/hermesFrontend_obj.dir/Utils/Dumper.cpp.o" "gcc" "lib/CMakeFiles/hermesFrontend_obj.dir/Utils/Dumper.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
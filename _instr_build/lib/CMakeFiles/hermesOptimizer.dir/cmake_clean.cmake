@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesOptimizer.a"
+  "libhermesOptimizer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesOptimizer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,51 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesOptimizer_obj.dir/IR/Analysis.cpp.o"
+  "CMakeFiles/hermesOptimizer_obj.dir/IR/Analysis.cpp.o.d"
+  "CMakeFiles/hermesOptimizer_obj.dir/IR/IREval.cpp.o"
+  "CMakeFiles/hermesOptimizer_obj.dir/IR/IREval.cpp.o.d"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/PassManager/PassManager.cpp.o"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/PassManager/PassManager.cpp.o.d"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/PassManager/Pipeline.cpp.o"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/PassManager/Pipeline.cpp.o.d"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/Auditor.cpp.o"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/Auditor.cpp.o.d"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/CSE.cpp.o"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/CSE.cpp.o.d"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/CodeMotion.cpp.o"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/CodeMotion.cpp.o.d"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/DCE.cpp.o"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/DCE.cpp.o.d"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/FrameLoadStoreOpts.cpp.o"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/FrameLoadStoreOpts.cpp.o.d"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/FuncSigOpts.cpp.o"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/FuncSigOpts.cpp.o.d"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/FunctionAnalysis.cpp.o"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/FunctionAnalysis.cpp.o.d"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/HoistStartGenerator.cpp.o"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/HoistStartGenerator.cpp.o.d"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/Inlining.cpp.o"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/Inlining.cpp.o.d"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/InstSimplify.cpp.o"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/InstSimplify.cpp.o.d"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/InstructionEscapeAnalysis.cpp.o"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/InstructionEscapeAnalysis.cpp.o.d"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/Mem2Reg.cpp.o"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/Mem2Reg.cpp.o.d"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/ResolveStaticRequire.cpp.o"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/ResolveStaticRequire.cpp.o.d"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/SimpleStackPromotion.cpp.o"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/SimpleStackPromotion.cpp.o.d"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/SimplifyCFG.cpp.o"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/SimplifyCFG.cpp.o.d"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/TDZDedup.cpp.o"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/TDZDedup.cpp.o.d"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/TypeInference.cpp.o"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/TypeInference.cpp.o.d"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/Utils.cpp.o"
+  "CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/Utils.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesOptimizer_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesvm.dir/dummy.cpp.o"
+  "CMakeFiles/hermesvm.dir/dummy.cpp.o.d"
+  "libhermesvm.pdb"
+  "libhermesvm.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesvm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
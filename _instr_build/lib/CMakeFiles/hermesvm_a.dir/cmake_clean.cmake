@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesvm_a.a"
+  "libhermesvm_a.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/hermesvm_a.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesvmlean_a.a"
+  "libhermesvmlean_a.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/hermesvmlean_a.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
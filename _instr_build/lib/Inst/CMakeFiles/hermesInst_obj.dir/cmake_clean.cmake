@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesInst_obj.dir/InstDecode.cpp.o"
+  "CMakeFiles/hermesInst_obj.dir/InstDecode.cpp.o.d"
+  "CMakeFiles/hermesInst_obj.dir/InstDecode2.cpp.o"
+  "CMakeFiles/hermesInst_obj.dir/InstDecode2.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesInst_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,4409 @@
+#define THIS_UNIT sh_export_internal_unit
+#include "hermes/VM/static_h.h"
+
+#include <stdlib.h>
+
+SHUnit THIS_UNIT;
+
+static SHSymbolID s_symbols[];
+static SHPropertyCacheEntry s_prop_cache[];
+static const SHSrcLoc s_source_locations[];
+static SHNativeFuncInfo s_function_info_table[];
+static SHLegacyValue _0_global(SHRuntime *shr);
+static SHLegacyValue _1___InternalBytecode_js_10(SHRuntime *shr);
+static SHLegacyValue _2_initAsyncFn__InternalBytecode_js_589(SHRuntime *shr);
+static SHLegacyValue _3_initPromise__InternalBytecode_js_18(SHRuntime *shr);
+static SHLegacyValue _4__1___InternalBytecode_js_649(SHRuntime *shr);
+static SHLegacyValue _5_spawn__InternalBytecode_js_602(SHRuntime *shr);
+static SHLegacyValue _6_noop__InternalBytecode_js_21(SHRuntime *shr);
+static SHLegacyValue _7_Promise__InternalBytecode_js_70(SHRuntime *shr);
+static SHLegacyValue _8_safeThen__InternalBytecode_js_97(SHRuntime *shr);
+static SHLegacyValue _9_handle__InternalBytecode_js_104(SHRuntime *shr);
+static SHLegacyValue _10_handleResolved__InternalBytecode_js_128(SHRuntime *shr);
+static SHLegacyValue _11_runReaction__InternalBytecode_js_140(SHRuntime *shr);
+static SHLegacyValue _12_resolve__InternalBytecode_js_158(SHRuntime *shr);
+static SHLegacyValue _13_reject__InternalBytecode_js_192(SHRuntime *shr);
+static SHLegacyValue _14_finale__InternalBytecode_js_200(SHRuntime *shr);
+static SHLegacyValue _15_Handler__InternalBytecode_js_213(SHRuntime *shr);
+static SHLegacyValue _16_doResolve__InternalBytecode_js_227(SHRuntime *shr);
+static SHLegacyValue _17_valuePromise__InternalBytecode_js_259(SHRuntime *shr);
+static SHLegacyValue _18_onSettledFulfill__InternalBytecode_js_342(SHRuntime *shr);
+static SHLegacyValue _19_onSettledReject__InternalBytecode_js_345(SHRuntime *shr);
+static SHLegacyValue _20_mapAllSettled__InternalBytecode_js_348(SHRuntime *shr);
+static SHLegacyValue _21_getAggregateError__InternalBytecode_js_385(SHRuntime *shr);
+static SHLegacyValue _22_disable__InternalBytecode_js_449(SHRuntime *shr);
+static SHLegacyValue _23_enable__InternalBytecode_js_456(SHRuntime *shr);
+static SHLegacyValue _24_logError__InternalBytecode_js_537(SHRuntime *shr);
+static SHLegacyValue _25_matchWhitelist__InternalBytecode_js_545(SHRuntime *shr);
+static SHLegacyValue _26__2___InternalBytecode_js_88(SHRuntime *shr);
+static SHLegacyValue _27__3___InternalBytecode_js_265(SHRuntime *shr);
+static SHLegacyValue _28_iterableToArray__InternalBytecode_js_290(SHRuntime *shr);
+static SHLegacyValue _29__4___InternalBytecode_js_302(SHRuntime *shr);
+static SHLegacyValue _30__5___InternalBytecode_js_361(SHRuntime *shr);
+static SHLegacyValue _31__6___InternalBytecode_js_365(SHRuntime *shr);
+static SHLegacyValue _32__7___InternalBytecode_js_371(SHRuntime *shr);
+static SHLegacyValue _33__8___InternalBytecode_js_381(SHRuntime *shr);
+static SHLegacyValue _34_promiseAny__InternalBytecode_js_398(SHRuntime *shr);
+static SHLegacyValue _35__9___InternalBytecode_js_429(SHRuntime *shr);
+static SHLegacyValue _36__10___InternalBytecode_js_603(SHRuntime *shr);
+static SHLegacyValue _37__11___InternalBytecode_js_98(SHRuntime *shr);
+static SHLegacyValue _38__12___InternalBytecode_js_135(SHRuntime *shr);
+static SHLegacyValue _39__13___InternalBytecode_js_229(SHRuntime *shr);
+static SHLegacyValue _40__14___InternalBytecode_js_233(SHRuntime *shr);
+static SHLegacyValue _41_onUnhandled__InternalBytecode_js_496(SHRuntime *shr);
+static SHLegacyValue _42__15___InternalBytecode_js_463(SHRuntime *shr);
+static SHLegacyValue _43__16___InternalBytecode_js_476(SHRuntime *shr);
+static SHLegacyValue _44__17___InternalBytecode_js_540(SHRuntime *shr);
+static SHLegacyValue _45__18___InternalBytecode_js_546(SHRuntime *shr);
+static SHLegacyValue _46__19___InternalBytecode_js_282(SHRuntime *shr);
+static SHLegacyValue _47_iterableToArray_1___InternalBytecode_js_298(SHRuntime *shr);
+static SHLegacyValue _48__20___InternalBytecode_js_305(SHRuntime *shr);
+static SHLegacyValue _49__21___InternalBytecode_js_366(SHRuntime *shr);
+static SHLegacyValue _50__22___InternalBytecode_js_372(SHRuntime *shr);
+static SHLegacyValue _51__23___InternalBytecode_js_399(SHRuntime *shr);
+static SHLegacyValue _52__24___InternalBytecode_js_430(SHRuntime *shr);
+static SHLegacyValue _53__25___InternalBytecode_js_434(SHRuntime *shr);
+static SHLegacyValue _54_step__InternalBytecode_js_605(SHRuntime *shr);
+static SHLegacyValue _55__26___InternalBytecode_js_633(SHRuntime *shr);
+static SHLegacyValue _56_res__InternalBytecode_js_308(SHRuntime *shr);
+static SHLegacyValue _57__27___InternalBytecode_js_373(SHRuntime *shr);
+static SHLegacyValue _58_resolveOnce__InternalBytecode_js_404(SHRuntime *shr);
+static SHLegacyValue _59_rejectionCheck__InternalBytecode_js_411(SHRuntime *shr);
+static SHLegacyValue _60__28___InternalBytecode_js_422(SHRuntime *shr);
+static SHLegacyValue _61__29___InternalBytecode_js_431(SHRuntime *shr);
+static SHLegacyValue _62__30___InternalBytecode_js_435(SHRuntime *shr);
+static SHLegacyValue _63__31___InternalBytecode_js_621(SHRuntime *shr);
+static SHLegacyValue _64__32___InternalBytecode_js_626(SHRuntime *shr);
+static SHLegacyValue _65__33___InternalBytecode_js_316(SHRuntime *shr);
+static SHLegacyValue _66__34___InternalBytecode_js_324(SHRuntime *shr);
+static SHLegacyValue _67__35___InternalBytecode_js_622(SHRuntime *shr);
+static SHLegacyValue _68__36___InternalBytecode_js_627(SHRuntime *shr);
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:10:1
+static SHLegacyValue _0_global(SHRuntime *shr) {
+  _SH_MODEL();
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 10);
+  locals.head.count =1;
+  locals.t0 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 0);
+  frame[3] = _sh_ljs_create_closure(shr, &locals.t0, _1___InternalBytecode_js_10, &s_function_info_table[1]);
+  np0 = _sh_ljs_undefined();
+  frame[2] = _sh_ljs_double(0);
+  frame[4] = _sh_ljs_undefined();
+  locals.t0 = _sh_ljs_call(shr, frame, 0);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:10:2
+static SHLegacyValue _1___InternalBytecode_js_10(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+    SHLegacyValue t4;
+    SHLegacyValue t5;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 10);
+  locals.head.count =6;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+  locals.t5 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+  SHLegacyValue np2 = _sh_ljs_undefined();
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 1);
+  locals.t1 = _sh_ljs_new_object(shr);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 0);
+  locals.t2 = _sh_ljs_get_global_object(shr);
+  locals.t3 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t2,s_symbols[1], s_prop_cache + 0);
+  np0 = _sh_ljs_null();
+  np1 = _sh_ljs_bool(_sh_ljs_equal_rjs(shr, &locals.t3, &np0));
+  np2 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+  if(_sh_ljs_get_bool(np1)) goto L3;
+  goto L1;
+
+L1:
+  ;
+  locals.t5 = _sh_ljs_get_by_id_rjs(shr,&locals.t3,s_symbols[2], s_prop_cache + 1);
+  np1 = _sh_ljs_bool(_sh_ljs_equal_rjs(shr, &locals.t5, &np0));
+  locals.t4 = _sh_ljs_undefined();
+  if(_sh_ljs_get_bool(np1)) goto L3;
+  goto L2;
+
+L2:
+  ;
+  frame[4] = _sh_ljs_undefined();
+  frame[3] = locals.t5;
+  frame[2] = locals.t3;
+  locals.t4 = _sh_ljs_call(shr, frame, 0);
+  goto L3;
+L3:
+  ;
+  // PhiInst
+  if(_sh_ljs_to_boolean(locals.t4)) goto L4;
+  goto L5;
+
+L4:
+  ;
+  frame[3] = _sh_ljs_create_closure(shr, &locals.t0, _3_initPromise__InternalBytecode_js_18, &s_function_info_table[3]);
+  frame[2] = _sh_ljs_double(0);
+  frame[4] = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_call(shr, frame, 0);
+  goto L5;
+L5:
+  ;
+  locals.t2 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t2,s_symbols[1], s_prop_cache + 2);
+  np1 = _sh_ljs_bool(_sh_ljs_equal_rjs(shr, &locals.t2, &np0));
+  locals.t3 = _sh_ljs_undefined();
+  if(_sh_ljs_get_bool(np1)) goto L8;
+  goto L6;
+
+L6:
+  ;
+  locals.t4 = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[2], s_prop_cache + 3);
+  np0 = _sh_ljs_bool(_sh_ljs_equal_rjs(shr, &locals.t4, &np0));
+  locals.t3 = _sh_ljs_undefined();
+  if(_sh_ljs_get_bool(np0)) goto L8;
+  goto L7;
+
+L7:
+  ;
+  frame[4] = _sh_ljs_undefined();
+  frame[3] = locals.t4;
+  frame[2] = locals.t2;
+  locals.t3 = _sh_ljs_call(shr, frame, 0);
+  goto L8;
+L8:
+  ;
+  // PhiInst
+  if(_sh_ljs_to_boolean(locals.t3)) goto L10;
+  goto L9;
+
+L9:
+  ;
+  locals.t2 = _sh_ljs_create_closure(shr, &locals.t0, _4__1___InternalBytecode_js_649, &s_function_info_table[4]);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t1,s_symbols[3], &locals.t2, s_prop_cache + 4);
+  goto L11;
+L10:
+  ;
+  frame[3] = _sh_ljs_create_closure(shr, &locals.t0, _2_initAsyncFn__InternalBytecode_js_589, &s_function_info_table[2]);
+  frame[2] = _sh_ljs_double(0);
+  frame[4] = _sh_ljs_undefined();
+  np0 = _sh_ljs_call(shr, frame, 0);
+  goto L11;
+L11:
+  ;
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t1;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:589:1
+static SHLegacyValue _2_initAsyncFn__InternalBytecode_js_589(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =4;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 2);
+  np0 = _sh_ljs_undefined();
+  _sh_ljs_store_to_env(shr, locals.t0,np0, 0);
+  _sh_ljs_store_to_env(shr, locals.t0,np0, 1);
+  locals.t1 = _sh_ljs_get_global_object(shr);
+  locals.t1 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t1,s_symbols[4], s_prop_cache + 5);
+  locals.t1 = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[5], s_prop_cache + 6);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 0);
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[6], s_prop_cache + 7);
+  frame[4] = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[7], s_prop_cache + 8);
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = locals.t2;
+  frame[2] = locals.t1;
+  locals.t1 = _sh_ljs_call(shr, frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 1);
+  locals.t1 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t1 = _sh_ljs_load_from_env(locals.t1, 0);
+  locals.t0 = _sh_ljs_create_closure(shr, &locals.t0, _5_spawn__InternalBytecode_js_602, &s_function_info_table[5]);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t1,s_symbols[3], &locals.t0, s_prop_cache + 9);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:18:33
+static SHLegacyValue _3_initPromise__InternalBytecode_js_18(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+    SHLegacyValue t4;
+    SHLegacyValue t5;
+    SHLegacyValue t6;
+    SHLegacyValue t7;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =8;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+  locals.t5 = _sh_ljs_undefined();
+  locals.t6 = _sh_ljs_undefined();
+  locals.t7 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+  SHLegacyValue np2 = _sh_ljs_undefined();
+  SHLegacyValue np3 = _sh_ljs_undefined();
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 32);
+  np0 = _sh_ljs_undefined();
+  _sh_ljs_store_to_env(shr, locals.t0,np0, 0);
+  _sh_ljs_store_to_env(shr, locals.t0,np0, 2);
+  _sh_ljs_store_to_env(shr, locals.t0,np0, 3);
+  _sh_ljs_store_to_env(shr, locals.t0,np0, 4);
+  _sh_ljs_store_to_env(shr, locals.t0,np0, 27);
+  _sh_ljs_store_to_env(shr, locals.t0,np0, 28);
+  locals.t1 = _sh_ljs_create_closure(shr, &locals.t0, _6_noop__InternalBytecode_js_21, &s_function_info_table[6]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 1);
+  locals.t2 = _sh_ljs_create_closure(shr, &locals.t0, _7_Promise__InternalBytecode_js_70, &s_function_info_table[7]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t2, 5);
+  locals.t3 = _sh_ljs_create_closure(shr, &locals.t0, _8_safeThen__InternalBytecode_js_97, &s_function_info_table[8]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t3, 6);
+  locals.t3 = _sh_ljs_create_closure(shr, &locals.t0, _9_handle__InternalBytecode_js_104, &s_function_info_table[9]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t3, 7);
+  locals.t3 = _sh_ljs_create_closure(shr, &locals.t0, _10_handleResolved__InternalBytecode_js_128, &s_function_info_table[10]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t3, 8);
+  locals.t3 = _sh_ljs_create_closure(shr, &locals.t0, _11_runReaction__InternalBytecode_js_140, &s_function_info_table[11]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t3, 9);
+  locals.t3 = _sh_ljs_create_closure(shr, &locals.t0, _12_resolve__InternalBytecode_js_158, &s_function_info_table[12]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t3, 10);
+  locals.t3 = _sh_ljs_create_closure(shr, &locals.t0, _13_reject__InternalBytecode_js_192, &s_function_info_table[13]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t3, 11);
+  locals.t3 = _sh_ljs_create_closure(shr, &locals.t0, _14_finale__InternalBytecode_js_200, &s_function_info_table[14]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t3, 12);
+  locals.t3 = _sh_ljs_create_closure(shr, &locals.t0, _15_Handler__InternalBytecode_js_213, &s_function_info_table[15]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t3, 13);
+  locals.t3 = _sh_ljs_create_closure(shr, &locals.t0, _16_doResolve__InternalBytecode_js_227, &s_function_info_table[16]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t3, 14);
+  locals.t3 = _sh_ljs_create_closure(shr, &locals.t0, _17_valuePromise__InternalBytecode_js_259, &s_function_info_table[17]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t3, 21);
+  locals.t4 = _sh_ljs_create_closure(shr, &locals.t0, _18_onSettledFulfill__InternalBytecode_js_342, &s_function_info_table[18]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t4, 23);
+  locals.t4 = _sh_ljs_create_closure(shr, &locals.t0, _19_onSettledReject__InternalBytecode_js_345, &s_function_info_table[19]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t4, 24);
+  locals.t4 = _sh_ljs_create_closure(shr, &locals.t0, _20_mapAllSettled__InternalBytecode_js_348, &s_function_info_table[20]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t4, 25);
+  locals.t4 = _sh_ljs_create_closure(shr, &locals.t0, _21_getAggregateError__InternalBytecode_js_385, &s_function_info_table[21]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t4, 26);
+  locals.t4 = _sh_ljs_create_closure(shr, &locals.t0, _22_disable__InternalBytecode_js_449, &s_function_info_table[22]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t4, 29);
+  locals.t5 = _sh_ljs_create_closure(shr, &locals.t0, _24_logError__InternalBytecode_js_537, &s_function_info_table[24]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t5, 30);
+  locals.t5 = _sh_ljs_create_closure(shr, &locals.t0, _25_matchWhitelist__InternalBytecode_js_545, &s_function_info_table[25]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t5, 31);
+  locals.t5 = _sh_ljs_get_global_object(shr);
+  locals.t6 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t5,s_symbols[1], s_prop_cache + 10);
+  frame[4] = _sh_ljs_get_by_id_rjs(shr,&locals.t6,s_symbols[8], s_prop_cache + 11);
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = locals.t6;
+  locals.t6 = _sh_ljs_call(shr, frame, 0);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t6, 0);
+  np1 = _sh_ljs_null();
+  _sh_ljs_store_to_env(shr, locals.t0,np1, 2);
+  locals.t6 = _sh_ljs_new_object(shr);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t6, 3);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t2, 4);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t2,s_symbols[9], &np1, s_prop_cache + 12);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t2,s_symbols[10], &np1, s_prop_cache + 13);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t2,s_symbols[11], &locals.t1, s_prop_cache + 14);
+  locals.t1 = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[12], s_prop_cache + 15);
+  locals.t6 = _sh_ljs_create_closure(shr, &locals.t0, _26__2___InternalBytecode_js_88, &s_function_info_table[26]);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t1,s_symbols[13], &locals.t6, s_prop_cache + 16);
+  frame[2] = _sh_ljs_bool(true);
+  frame[5] = _sh_ljs_undefined();
+  frame[4] = locals.t3;
+  frame[3] = _sh_ljs_double(0);
+  locals.t1 = _sh_ljs_call(shr, frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 15);
+  np3 = _sh_ljs_bool(false);
+  frame[5] = _sh_ljs_undefined();
+  frame[4] = locals.t3;
+  frame[3] = _sh_ljs_double(0);
+  frame[2] = _sh_ljs_bool(false);
+  locals.t1 = _sh_ljs_call(shr, frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 16);
+  frame[5] = _sh_ljs_undefined();
+  frame[4] = locals.t3;
+  frame[3] = _sh_ljs_double(0);
+  frame[2] = _sh_ljs_null();
+  locals.t1 = _sh_ljs_call(shr, frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 17);
+  frame[5] = _sh_ljs_undefined();
+  frame[4] = locals.t3;
+  frame[3] = _sh_ljs_double(0);
+  frame[2] = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_call(shr, frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 18);
+  frame[5] = _sh_ljs_undefined();
+  frame[4] = locals.t3;
+  frame[3] = _sh_ljs_double(0);
+  frame[2] = _sh_ljs_double(0);
+  locals.t1 = _sh_ljs_call(shr, frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 19);
+  frame[2] = _sh_ljs_get_string(shr, s_symbols[0]);
+  frame[5] = _sh_ljs_undefined();
+  frame[4] = locals.t3;
+  frame[3] = _sh_ljs_double(0);
+  locals.t1 = _sh_ljs_call(shr, frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 20);
+  locals.t1 = _sh_ljs_create_closure(shr, &locals.t0, _27__3___InternalBytecode_js_265, &s_function_info_table[27]);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t2,s_symbols[6], &locals.t1, s_prop_cache + 17);
+  locals.t1 = _sh_ljs_create_closure(shr, &locals.t0, _28_iterableToArray__InternalBytecode_js_290, &s_function_info_table[28]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 22);
+  locals.t1 = _sh_ljs_create_closure(shr, &locals.t0, _29__4___InternalBytecode_js_302, &s_function_info_table[29]);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t2,s_symbols[14], &locals.t1, s_prop_cache + 18);
+  locals.t1 = _sh_ljs_create_closure(shr, &locals.t0, _30__5___InternalBytecode_js_361, &s_function_info_table[30]);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t2,s_symbols[15], &locals.t1, s_prop_cache + 19);
+  locals.t1 = _sh_ljs_create_closure(shr, &locals.t0, _31__6___InternalBytecode_js_365, &s_function_info_table[31]);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t2,s_symbols[16], &locals.t1, s_prop_cache + 20);
+  locals.t1 = _sh_ljs_create_closure(shr, &locals.t0, _32__7___InternalBytecode_js_371, &s_function_info_table[32]);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t2,s_symbols[17], &locals.t1, s_prop_cache + 21);
+  locals.t1 = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[12], s_prop_cache + 22);
+  locals.t3 = _sh_ljs_create_closure(shr, &locals.t0, _33__8___InternalBytecode_js_381, &s_function_info_table[33]);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t1,s_symbols[18], &locals.t3, s_prop_cache + 23);
+  locals.t1 = _sh_ljs_create_closure(shr, &locals.t0, _34_promiseAny__InternalBytecode_js_398, &s_function_info_table[34]);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t2,s_symbols[19], &locals.t1, s_prop_cache + 24);
+  locals.t1 = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[12], s_prop_cache + 25);
+  locals.t3 = _sh_ljs_create_closure(shr, &locals.t0, _35__9___InternalBytecode_js_429, &s_function_info_table[35]);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t1,s_symbols[20], &locals.t3, s_prop_cache + 26);
+  locals.t1 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t5,s_symbols[21], s_prop_cache + 27);
+  locals.t3 = _sh_ljs_new_array(shr, 3);
+  _sh_ljs_put_own_by_index(shr, &locals.t3, 0, &locals.t1);
+  locals.t1 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t5,s_symbols[22], s_prop_cache + 28);
+  _sh_ljs_put_own_by_index(shr, &locals.t3, 1, &locals.t1);
+  locals.t1 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t5,s_symbols[23], s_prop_cache + 29);
+  _sh_ljs_put_own_by_index(shr, &locals.t3, 2, &locals.t1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t3, 27);
+  _sh_ljs_store_to_env(shr, locals.t0,np3, 28);
+  locals.t1 = _sh_ljs_new_object(shr);
+  _sh_ljs_put_new_own_by_id(shr, &locals.t1, s_symbols[24], &locals.t4);
+  locals.t0 = _sh_ljs_create_closure(shr, &locals.t0, _23_enable__InternalBytecode_js_456, &s_function_info_table[23]);
+  _sh_ljs_put_new_own_by_id(shr, &locals.t1, s_symbols[25], &locals.t0);
+  locals.t0 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t5,s_symbols[4], s_prop_cache + 30);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[5], &locals.t2, s_prop_cache + 31);
+  locals.t0 = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[25], s_prop_cache + 32);
+  locals.t1 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t5,s_symbols[1], s_prop_cache + 33);
+  if(_sh_ljs_equal_rjs(shr, &locals.t1, &np1)) goto L3;
+  goto L1;
+
+L1:
+  ;
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[26], s_prop_cache + 34);
+  if(_sh_ljs_equal_rjs(shr, &locals.t2, &np1)) goto L3;
+  goto L2;
+
+L2:
+  ;
+  frame[5] = _sh_ljs_undefined();
+  frame[4] = locals.t2;
+  frame[3] = locals.t1;
+  frame[2] = locals.t0;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  goto L3;
+L3:
+  ;
+  locals.t0 = _sh_ljs_new_object(shr);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:649:39
+static SHLegacyValue _4__1___InternalBytecode_js_649(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =2;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_get_global_object(shr);
+  frame[4] = _sh_ljs_try_get_by_id_rjs(shr,&locals.t0,s_symbols[27], s_prop_cache + 35);
+  np0 = _sh_ljs_undefined();
+  frame[2] = _sh_ljs_get_string(shr, s_symbols[28]);
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = _sh_ljs_undefined();
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  _sh_throw(shr, locals.t0);
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:602:3
+static SHLegacyValue _5_spawn__InternalBytecode_js_602(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =3;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 3);
+  locals.t1 = _sh_ljs_param(frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 0);
+  locals.t1 = _sh_ljs_param(frame, 2);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 1);
+  locals.t1 = _sh_ljs_param(frame, 3);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 2);
+  locals.t1 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t1 = _sh_ljs_load_from_env(locals.t1, 0);
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[12], s_prop_cache + 36);
+  locals.t2 = _sh_ljs_create_this(shr, &locals.t2, &locals.t1);
+  frame[2] = _sh_ljs_create_closure(shr, &locals.t0, _36__10___InternalBytecode_js_603, &s_function_info_table[36]);
+  frame[5] = locals.t1;
+  frame[4] = locals.t1;
+  frame[3] = locals.t2;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  locals.t0 = _sh_ljs_is_object(locals.t0) ? locals.t0 : locals.t2;
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:21:3
+static SHLegacyValue _6_noop__InternalBytecode_js_21(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 2);
+  locals.head.count =0;
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  np0 = _sh_ljs_undefined();
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:70:3
+static SHLegacyValue _7_Promise__InternalBytecode_js_70(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =4;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = frame[-8];
+  locals.t1 = _sh_ljs_param(frame, 1);
+  locals.t2 = _sh_ljs_typeof(shr, &locals.t0);
+  locals.t3 = _sh_ljs_get_string(shr, s_symbols[29]);
+  if(!_sh_ljs_strict_equal(locals.t2, locals.t3)) goto L6;
+  goto L1;
+
+L1:
+  ;
+  locals.t2 = _sh_ljs_typeof(shr, &locals.t1);
+  locals.t3 = _sh_ljs_get_string(shr, s_symbols[30]);
+  if(!_sh_ljs_strict_equal(locals.t2, locals.t3)) goto L5;
+  goto L2;
+
+L2:
+  ;
+  np0 = _sh_ljs_double(0);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[31], &np0, s_prop_cache + 37);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[32], &np0, s_prop_cache + 38);
+  np1 = _sh_ljs_null();
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[33], &np1, s_prop_cache + 39);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[34], &np1, s_prop_cache + 40);
+  locals.t2 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t3 = _sh_ljs_load_from_env(locals.t2, 1);
+  if(_sh_ljs_strict_equal(locals.t1, locals.t3)) goto L4;
+  goto L3;
+
+L3:
+  ;
+  frame[5] = _sh_ljs_load_from_env(locals.t2, 14);
+  np1 = _sh_ljs_undefined();
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_double(0);
+  frame[3] = locals.t1;
+  frame[2] = locals.t0;
+  np0 = _sh_ljs_call(shr, frame, 2);
+  _sh_leave(shr, &locals.head, frame);
+  return np1;
+
+L4:
+  ;
+  np0 = _sh_ljs_undefined();
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+
+L5:
+  ;
+  locals.t0 = _sh_ljs_get_global_object(shr);
+  locals.t0 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t0,s_symbols[22], s_prop_cache + 41);
+  locals.t1 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[12], s_prop_cache + 42);
+  locals.t1 = _sh_ljs_create_this(shr, &locals.t1, &locals.t0);
+  frame[3] = _sh_ljs_get_string(shr, s_symbols[35]);
+  frame[6] = locals.t0;
+  frame[5] = locals.t0;
+  frame[4] = locals.t1;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  locals.t0 = _sh_ljs_is_object(locals.t0) ? locals.t0 : locals.t1;
+  _sh_throw(shr, locals.t0);
+
+L6:
+  ;
+  locals.t0 = _sh_ljs_get_global_object(shr);
+  locals.t0 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t0,s_symbols[22], s_prop_cache + 43);
+  locals.t1 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[12], s_prop_cache + 44);
+  locals.t1 = _sh_ljs_create_this(shr, &locals.t1, &locals.t0);
+  frame[3] = _sh_ljs_get_string(shr, s_symbols[36]);
+  frame[6] = locals.t0;
+  frame[5] = locals.t0;
+  frame[4] = locals.t1;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  locals.t0 = _sh_ljs_is_object(locals.t0) ? locals.t0 : locals.t1;
+  _sh_throw(shr, locals.t0);
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:97:3
+static SHLegacyValue _8_safeThen__InternalBytecode_js_97(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =3;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 3);
+  locals.t1 = _sh_ljs_param(frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 0);
+  locals.t2 = _sh_ljs_param(frame, 2);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t2, 1);
+  locals.t2 = _sh_ljs_param(frame, 3);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t2, 2);
+  locals.t1 = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[37], s_prop_cache + 45);
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[12], s_prop_cache + 46);
+  locals.t2 = _sh_ljs_create_this(shr, &locals.t2, &locals.t1);
+  frame[2] = _sh_ljs_create_closure(shr, &locals.t0, _37__11___InternalBytecode_js_98, &s_function_info_table[37]);
+  frame[5] = locals.t1;
+  frame[4] = locals.t1;
+  frame[3] = locals.t2;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  locals.t0 = _sh_ljs_is_object(locals.t0) ? locals.t0 : locals.t2;
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:104:3
+static SHLegacyValue _9_handle__InternalBytecode_js_104(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+    SHLegacyValue t4;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =5;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+  SHLegacyValue np2 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_param(frame, 1);
+  locals.t1 = _sh_ljs_param(frame, 2);
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[32], s_prop_cache + 47);
+  np0 = _sh_ljs_double(3);
+  locals.t3 = locals.t0;
+  locals.t0 = locals.t3;
+  if(_sh_ljs_strict_equal(locals.t2, np0)) goto L1;
+  goto L2;
+
+L1:
+  ;
+  // PhiInst
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t3,s_symbols[33], s_prop_cache + 48);
+  locals.t4 = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[32], s_prop_cache + 49);
+  locals.t3 = locals.t2;
+  locals.t0 = locals.t3;
+  if(_sh_ljs_strict_equal(locals.t4, np0)) goto L1;
+  goto L2;
+
+L2:
+  ;
+  // PhiInst
+  locals.t2 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t3 = _sh_ljs_load_from_env(locals.t2, 5);
+  locals.t4 = _sh_ljs_get_by_id_rjs(shr,&locals.t3,s_symbols[9], s_prop_cache + 50);
+  if(_sh_ljs_to_boolean(locals.t4)) goto L3;
+  goto L4;
+
+L3:
+  ;
+  frame[5] = _sh_ljs_get_by_id_rjs(shr,&locals.t3,s_symbols[9], s_prop_cache + 51);
+  np0 = _sh_ljs_undefined();
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = locals.t3;
+  frame[3] = locals.t0;
+  locals.t3 = _sh_ljs_call(shr, frame, 1);
+  goto L4;
+L4:
+  ;
+  locals.t3 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[32], s_prop_cache + 52);
+  np0 = _sh_ljs_double(0);
+  if(_sh_ljs_strict_equal(locals.t3, np0)) goto L6;
+  goto L5;
+
+L5:
+  ;
+  frame[5] = _sh_ljs_load_from_env(locals.t2, 8);
+  np1 = _sh_ljs_undefined();
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_double(0);
+  frame[3] = locals.t0;
+  frame[2] = locals.t1;
+  np2 = _sh_ljs_call(shr, frame, 2);
+  _sh_leave(shr, &locals.head, frame);
+  return np1;
+
+L6:
+  ;
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[31], s_prop_cache + 53);
+  if(_sh_ljs_strict_equal(locals.t2, np0)) goto L10;
+  goto L7;
+
+L7:
+  ;
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[31], s_prop_cache + 54);
+  np0 = _sh_ljs_double(1);
+  if(_sh_ljs_strict_equal(locals.t2, np0)) goto L9;
+  goto L8;
+
+L8:
+  ;
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[34], s_prop_cache + 55);
+  frame[5] = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[38], s_prop_cache + 56);
+  np0 = _sh_ljs_undefined();
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = locals.t2;
+  frame[3] = locals.t1;
+  locals.t2 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+
+L9:
+  ;
+  np0 = _sh_ljs_double(2);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[31], &np0, s_prop_cache + 57);
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[34], s_prop_cache + 58);
+  locals.t3 = _sh_ljs_new_array(shr, 2);
+  _sh_ljs_put_own_by_index(shr, &locals.t3, 0, &locals.t2);
+  _sh_ljs_put_own_by_index(shr, &locals.t3, 1, &locals.t1);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[34], &locals.t3, s_prop_cache + 59);
+  np0 = _sh_ljs_undefined();
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+
+L10:
+  ;
+  np0 = _sh_ljs_double(1);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[31], &np0, s_prop_cache + 60);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[34], &locals.t1, s_prop_cache + 61);
+  np0 = _sh_ljs_undefined();
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:128:3
+static SHLegacyValue _10_handleResolved__InternalBytecode_js_128(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+    SHLegacyValue t4;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =5;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 1);
+  locals.t1 = _sh_ljs_param(frame, 2);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 0);
+  locals.t2 = _sh_ljs_param(frame, 1);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t1,s_symbols[39], &locals.t2, s_prop_cache + 62);
+  locals.t2 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t3 = _sh_ljs_load_from_env(locals.t2, 0);
+  locals.t4 = _sh_ljs_get_global_object(shr);
+  if(_sh_ljs_to_boolean(locals.t3)) goto L2;
+  goto L1;
+
+L1:
+  ;
+  frame[5] = _sh_ljs_try_get_by_id_rjs(shr,&locals.t4,s_symbols[40], s_prop_cache + 63);
+  np0 = _sh_ljs_undefined();
+  frame[3] = _sh_ljs_create_closure(shr, &locals.t0, _38__12___InternalBytecode_js_135, &s_function_info_table[38]);
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_undefined();
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  goto L3;
+L2:
+  ;
+  locals.t0 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t4,s_symbols[1], s_prop_cache + 64);
+  frame[5] = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[41], s_prop_cache + 65);
+  frame[3] = _sh_ljs_load_from_env(locals.t2, 9);
+  np0 = _sh_ljs_undefined();
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = locals.t0;
+  frame[2] = locals.t1;
+  locals.t0 = _sh_ljs_call(shr, frame, 2);
+  goto L3;
+L3:
+  ;
+  np0 = _sh_ljs_undefined();
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:140:3
+static SHLegacyValue _11_runReaction__InternalBytecode_js_140(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+    SHLegacyValue t4;
+    SHLegacyValue t5;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =6;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+  locals.t5 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+  SHLegacyValue np2 = _sh_ljs_undefined();
+  SHJmpBuf jmpBuf0;
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_param(frame, 1);
+  locals.t1 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[39], s_prop_cache + 66);
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[32], s_prop_cache + 67);
+  np0 = _sh_ljs_double(1);
+  if(_sh_ljs_strict_equal(locals.t2, np0)) goto L2;
+  goto L1;
+
+L1:
+  ;
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[42], s_prop_cache + 68);
+  goto L3;
+L2:
+  ;
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[43], s_prop_cache + 69);
+  goto L3;
+L3:
+  ;
+  // PhiInst
+  np1 = _sh_ljs_null();
+  if(_sh_ljs_strict_equal(locals.t2, np1)) goto L13;
+  goto L4;
+
+L4:
+  ;
+  locals.t3 = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[33], s_prop_cache + 70);
+  goto L5;
+L5:
+  ;
+  if(_sh_try(shr, &jmpBuf0) == 0) goto L6;
+  goto L8;
+
+L6:
+  ;
+  np1 = _sh_ljs_undefined();
+  frame[6] = _sh_ljs_undefined();
+  frame[5] = locals.t2;
+  frame[4] = _sh_ljs_undefined();
+  frame[3] = locals.t3;
+  locals.t2 = _sh_ljs_call(shr, frame, 1);
+  goto L7;
+L7:
+  ;
+  _sh_end_try(shr, &jmpBuf0);
+  goto L9;
+L8:
+  ;
+  locals.t3 = _sh_catch(shr, (SHLocals*)&locals, frame, 12);
+  locals.t4 = _sh_ljs_get_env(shr, frame, 0);
+  _sh_ljs_store_to_env(shr, locals.t4,locals.t3, 2);
+  locals.t2 = _sh_ljs_load_from_env(locals.t4, 3);
+  goto L9;
+L9:
+  ;
+  // PhiInst
+  locals.t3 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t4 = _sh_ljs_load_from_env(locals.t3, 3);
+  if(_sh_ljs_strict_equal(locals.t2, locals.t4)) goto L11;
+  goto L10;
+
+L10:
+  ;
+  frame[5] = _sh_ljs_load_from_env(locals.t3, 10);
+  frame[3] = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[44], s_prop_cache + 71);
+  np1 = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_double(0);
+  frame[6] = _sh_ljs_undefined();
+  frame[2] = locals.t2;
+  np1 = _sh_ljs_call(shr, frame, 2);
+  goto L12;
+L11:
+  ;
+  frame[5] = _sh_ljs_load_from_env(locals.t3, 11);
+  frame[3] = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[44], s_prop_cache + 72);
+  frame[2] = _sh_ljs_load_from_env(locals.t3, 2);
+  np1 = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_double(0);
+  frame[6] = _sh_ljs_undefined();
+  np1 = _sh_ljs_call(shr, frame, 2);
+  goto L12;
+L12:
+  ;
+  np1 = _sh_ljs_undefined();
+  _sh_leave(shr, &locals.head, frame);
+  return np1;
+
+L13:
+  ;
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[32], s_prop_cache + 73);
+  if(_sh_ljs_strict_equal(locals.t2, np0)) goto L15;
+  goto L14;
+
+L14:
+  ;
+  locals.t2 = _sh_ljs_get_env(shr, frame, 0);
+  frame[5] = _sh_ljs_load_from_env(locals.t2, 11);
+  frame[3] = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[44], s_prop_cache + 74);
+  frame[2] = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[33], s_prop_cache + 75);
+  np0 = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_double(0);
+  frame[6] = _sh_ljs_undefined();
+  np0 = _sh_ljs_call(shr, frame, 2);
+  goto L16;
+L15:
+  ;
+  locals.t2 = _sh_ljs_get_env(shr, frame, 0);
+  frame[5] = _sh_ljs_load_from_env(locals.t2, 10);
+  frame[3] = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[44], s_prop_cache + 76);
+  frame[2] = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[33], s_prop_cache + 77);
+  np0 = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_double(0);
+  frame[6] = _sh_ljs_undefined();
+  np0 = _sh_ljs_call(shr, frame, 2);
+  goto L16;
+L16:
+  ;
+  np0 = _sh_ljs_undefined();
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:158:3
+static SHLegacyValue _12_resolve__InternalBytecode_js_158(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+    SHLegacyValue t4;
+    SHLegacyValue t5;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =6;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+  locals.t5 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+  SHJmpBuf jmpBuf0;
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_param(frame, 1);
+  locals.t1 = _sh_ljs_param(frame, 2);
+  if(_sh_ljs_strict_equal(locals.t1, locals.t0)) goto L17;
+  goto L1;
+
+L1:
+  ;
+  if(_sh_ljs_to_boolean(locals.t1)) goto L2;
+  goto L13;
+
+L2:
+  ;
+  locals.t2 = _sh_ljs_typeof(shr, &locals.t1);
+  locals.t3 = _sh_ljs_get_string(shr, s_symbols[29]);
+  if(_sh_ljs_strict_equal(locals.t2, locals.t3)) goto L4;
+  goto L3;
+
+L3:
+  ;
+  locals.t3 = _sh_ljs_get_string(shr, s_symbols[30]);
+  if(_sh_ljs_strict_equal(locals.t2, locals.t3)) goto L4;
+  goto L13;
+
+L4:
+  ;
+  goto L5;
+L5:
+  ;
+  if(_sh_try(shr, &jmpBuf0) == 0) goto L6;
+  goto L8;
+
+L6:
+  ;
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[13], s_prop_cache + 78);
+  goto L7;
+L7:
+  ;
+  _sh_end_try(shr, &jmpBuf0);
+  goto L9;
+L8:
+  ;
+  locals.t3 = _sh_catch(shr, (SHLocals*)&locals, frame, 12);
+  locals.t4 = _sh_ljs_get_env(shr, frame, 0);
+  _sh_ljs_store_to_env(shr, locals.t4,locals.t3, 2);
+  locals.t2 = _sh_ljs_load_from_env(locals.t4, 3);
+  goto L9;
+L9:
+  ;
+  // PhiInst
+  locals.t3 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t4 = _sh_ljs_load_from_env(locals.t3, 3);
+  if(_sh_ljs_strict_equal(locals.t2, locals.t4)) goto L16;
+  goto L10;
+
+L10:
+  ;
+  locals.t4 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[13], s_prop_cache + 79);
+  if(_sh_ljs_strict_equal(locals.t2, locals.t4)) goto L11;
+  goto L12;
+
+L11:
+  ;
+  locals.t4 = _sh_ljs_load_from_env(locals.t3, 5);
+  np0 = _sh_ljs_instance_of_rjs(shr, &locals.t1, &locals.t4);
+  if(_sh_ljs_get_bool(np0)) goto L15;
+  goto L12;
+
+L12:
+  ;
+  locals.t4 = _sh_ljs_typeof(shr, &locals.t2);
+  locals.t5 = _sh_ljs_get_string(shr, s_symbols[30]);
+  if(_sh_ljs_strict_equal(locals.t4, locals.t5)) goto L14;
+  goto L13;
+
+L13:
+  ;
+  np0 = _sh_ljs_double(1);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[32], &np0, s_prop_cache + 80);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[33], &locals.t1, s_prop_cache + 81);
+  locals.t4 = _sh_ljs_get_env(shr, frame, 0);
+  frame[5] = _sh_ljs_load_from_env(locals.t4, 12);
+  np0 = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_double(0);
+  frame[6] = _sh_ljs_undefined();
+  frame[3] = locals.t0;
+  np1 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+
+L14:
+  ;
+  locals.t4 = _sh_ljs_load_from_env(locals.t3, 14);
+  frame[5] = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[7], s_prop_cache + 82);
+  np0 = _sh_ljs_undefined();
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = locals.t2;
+  frame[3] = locals.t1;
+  frame[3] = _sh_ljs_call(shr, frame, 1);
+  frame[4] = _sh_ljs_double(0);
+  frame[6] = _sh_ljs_undefined();
+  frame[5] = locals.t4;
+  frame[2] = locals.t0;
+  np1 = _sh_ljs_call(shr, frame, 2);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+
+L15:
+  ;
+  np0 = _sh_ljs_double(3);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[32], &np0, s_prop_cache + 83);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[33], &locals.t1, s_prop_cache + 84);
+  frame[5] = _sh_ljs_load_from_env(locals.t3, 12);
+  np0 = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_double(0);
+  frame[6] = _sh_ljs_undefined();
+  frame[3] = locals.t0;
+  np1 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+
+L16:
+  ;
+  frame[5] = _sh_ljs_load_from_env(locals.t3, 11);
+  frame[2] = _sh_ljs_load_from_env(locals.t3, 2);
+  np0 = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_double(0);
+  frame[6] = _sh_ljs_undefined();
+  frame[3] = locals.t0;
+  np1 = _sh_ljs_call(shr, frame, 2);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+
+L17:
+  ;
+  locals.t1 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t1 = _sh_ljs_load_from_env(locals.t1, 11);
+  locals.t2 = _sh_ljs_get_global_object(shr);
+  locals.t2 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t2,s_symbols[22], s_prop_cache + 85);
+  locals.t3 = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[12], s_prop_cache + 86);
+  locals.t3 = _sh_ljs_create_this(shr, &locals.t3, &locals.t2);
+  frame[3] = _sh_ljs_get_string(shr, s_symbols[45]);
+  frame[6] = locals.t2;
+  frame[5] = locals.t2;
+  frame[4] = locals.t3;
+  locals.t2 = _sh_ljs_call(shr, frame, 1);
+  np0 = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_double(0);
+  frame[2] = _sh_ljs_is_object(locals.t2) ? locals.t2 : locals.t3;
+  frame[6] = _sh_ljs_undefined();
+  frame[5] = locals.t1;
+  frame[3] = locals.t0;
+  np1 = _sh_ljs_call(shr, frame, 2);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:192:3
+static SHLegacyValue _13_reject__InternalBytecode_js_192(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+    SHLegacyValue t4;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =5;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_param(frame, 1);
+  locals.t1 = _sh_ljs_param(frame, 2);
+  np0 = _sh_ljs_double(2);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[32], &np0, s_prop_cache + 87);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[33], &locals.t1, s_prop_cache + 88);
+  locals.t2 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t3 = _sh_ljs_load_from_env(locals.t2, 5);
+  locals.t4 = _sh_ljs_get_by_id_rjs(shr,&locals.t3,s_symbols[10], s_prop_cache + 89);
+  if(_sh_ljs_to_boolean(locals.t4)) goto L1;
+  goto L2;
+
+L1:
+  ;
+  frame[5] = _sh_ljs_get_by_id_rjs(shr,&locals.t3,s_symbols[10], s_prop_cache + 90);
+  np0 = _sh_ljs_undefined();
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = locals.t3;
+  frame[3] = locals.t0;
+  frame[2] = locals.t1;
+  locals.t1 = _sh_ljs_call(shr, frame, 2);
+  goto L2;
+L2:
+  ;
+  frame[5] = _sh_ljs_load_from_env(locals.t2, 12);
+  np0 = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_double(0);
+  frame[6] = _sh_ljs_undefined();
+  frame[3] = locals.t0;
+  np1 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:200:3
+static SHLegacyValue _14_finale__InternalBytecode_js_200(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =4;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+  SHLegacyValue np2 = _sh_ljs_undefined();
+  SHLegacyValue np3 = _sh_ljs_undefined();
+  SHLegacyValue np4 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_param(frame, 1);
+  locals.t1 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[31], s_prop_cache + 91);
+  np0 = _sh_ljs_double(1);
+  if(_sh_ljs_strict_equal(locals.t1, np0)) goto L1;
+  goto L2;
+
+L1:
+  ;
+  locals.t1 = _sh_ljs_get_env(shr, frame, 0);
+  frame[5] = _sh_ljs_load_from_env(locals.t1, 7);
+  frame[2] = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[34], s_prop_cache + 92);
+  np1 = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_double(0);
+  frame[6] = _sh_ljs_undefined();
+  frame[3] = locals.t0;
+  np1 = _sh_ljs_call(shr, frame, 2);
+  np1 = _sh_ljs_null();
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[34], &np1, s_prop_cache + 93);
+  goto L2;
+L2:
+  ;
+  locals.t1 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[31], s_prop_cache + 94);
+  np1 = _sh_ljs_double(2);
+  if(_sh_ljs_strict_equal(locals.t1, np1)) goto L3;
+  goto L6;
+
+L3:
+  ;
+  locals.t1 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[34], s_prop_cache + 95);
+  locals.t1 = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[46], s_prop_cache + 96);
+  np1 = _sh_ljs_double(0);
+  np2 = _sh_ljs_bool(_sh_ljs_less_rjs(shr, &np1, &locals.t1));
+  locals.t1 = _sh_ljs_get_env(shr, frame, 0);
+  np3 = _sh_ljs_undefined();
+  np4 = _sh_ljs_double(0);
+  if(_sh_ljs_get_bool(np2)) goto L4;
+  goto L5;
+
+L4:
+  ;
+  // PhiInst
+  frame[5] = _sh_ljs_load_from_env(locals.t1, 7);
+  locals.t3 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[34], s_prop_cache + 97);
+  frame[2] = _sh_ljs_get_by_val_rjs(shr,&locals.t3, &np4);
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_double(0);
+  frame[3] = locals.t0;
+  np2 = _sh_ljs_call(shr, frame, 2);
+  np4 = _sh_ljs_double(_sh_ljs_get_double(np4) + _sh_ljs_get_double(np0));
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[34], s_prop_cache + 98);
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[46], s_prop_cache + 99);
+  if(_sh_ljs_less_rjs(shr, &np4, &locals.t2)) goto L4;
+  goto L5;
+
+L5:
+  ;
+  np0 = _sh_ljs_null();
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[34], &np0, s_prop_cache + 100);
+  goto L6;
+L6:
+  ;
+  np0 = _sh_ljs_undefined();
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:213:3
+static SHLegacyValue _15_Handler__InternalBytecode_js_213(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+    SHLegacyValue t4;
+    SHLegacyValue t5;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 2);
+  locals.head.count =6;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+  locals.t5 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = frame[-8];
+  locals.t1 = _sh_ljs_param(frame, 1);
+  locals.t2 = _sh_ljs_param(frame, 2);
+  np0 = _sh_ljs_null();
+  locals.t3 = _sh_ljs_typeof(shr, &locals.t1);
+  locals.t4 = _sh_ljs_get_string(shr, s_symbols[30]);
+  locals.t5 = _sh_ljs_null();
+  if(_sh_ljs_strict_equal(locals.t3, locals.t4)) goto L1;
+  goto L2;
+
+L1:
+  ;
+  locals.t5 = locals.t1;
+  goto L2;
+L2:
+  ;
+  // PhiInst
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[43], &locals.t5, s_prop_cache + 101);
+  locals.t1 = _sh_ljs_typeof(shr, &locals.t2);
+  locals.t3 = _sh_ljs_null();
+  if(_sh_ljs_strict_equal(locals.t1, locals.t4)) goto L3;
+  goto L4;
+
+L3:
+  ;
+  locals.t3 = locals.t2;
+  goto L4;
+L4:
+  ;
+  // PhiInst
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[42], &locals.t3, s_prop_cache + 102);
+  locals.t1 = _sh_ljs_param(frame, 3);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[44], &locals.t1, s_prop_cache + 103);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[39], &np0, s_prop_cache + 104);
+  np0 = _sh_ljs_undefined();
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:227:3
+static SHLegacyValue _16_doResolve__InternalBytecode_js_227(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+    SHLegacyValue t4;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =5;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+  SHJmpBuf jmpBuf0;
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 2);
+  locals.t1 = _sh_ljs_param(frame, 2);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 0);
+  np0 = _sh_ljs_bool(false);
+  _sh_ljs_store_to_env(shr, locals.t0,np0, 1);
+  goto L1;
+L1:
+  ;
+  if(_sh_try(shr, &jmpBuf0) == 0) goto L2;
+  goto L4;
+
+L2:
+  ;
+  frame[5] = _sh_ljs_param(frame, 1);
+  np0 = _sh_ljs_undefined();
+  frame[3] = _sh_ljs_create_closure(shr, &locals.t0, _39__13___InternalBytecode_js_229, &s_function_info_table[39]);
+  frame[2] = _sh_ljs_create_closure(shr, &locals.t0, _40__14___InternalBytecode_js_233, &s_function_info_table[40]);
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_call(shr, frame, 2);
+  goto L3;
+L3:
+  ;
+  _sh_end_try(shr, &jmpBuf0);
+  locals.t2 = _sh_ljs_undefined();
+  goto L5;
+L4:
+  ;
+  locals.t3 = _sh_catch(shr, (SHLocals*)&locals, frame, 12);
+  locals.t4 = _sh_ljs_get_env(shr, frame, 0);
+  _sh_ljs_store_to_env(shr, locals.t4,locals.t3, 2);
+  locals.t2 = _sh_ljs_load_from_env(locals.t4, 3);
+  goto L5;
+L5:
+  ;
+  // PhiInst
+  np0 = _sh_ljs_load_from_env(locals.t0, 1);
+  if(_sh_ljs_get_bool(np0)) goto L8;
+  goto L6;
+
+L6:
+  ;
+  locals.t3 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t4 = _sh_ljs_load_from_env(locals.t3, 3);
+  if(_sh_ljs_strict_equal(locals.t2, locals.t4)) goto L7;
+  goto L8;
+
+L7:
+  ;
+  np0 = _sh_ljs_bool(true);
+  _sh_ljs_store_to_env(shr, locals.t0,np0, 1);
+  frame[5] = _sh_ljs_load_from_env(locals.t3, 11);
+  frame[2] = _sh_ljs_load_from_env(locals.t3, 2);
+  np0 = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_double(0);
+  frame[6] = _sh_ljs_undefined();
+  frame[3] = locals.t1;
+  np0 = _sh_ljs_call(shr, frame, 2);
+  goto L8;
+L8:
+  ;
+  np0 = _sh_ljs_undefined();
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:259:3
+static SHLegacyValue _17_valuePromise__InternalBytecode_js_259(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =3;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t0 = _sh_ljs_load_from_env(locals.t0, 4);
+  frame[2] = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[11], s_prop_cache + 105);
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[12], s_prop_cache + 106);
+  locals.t2 = _sh_ljs_create_this(shr, &locals.t2, &locals.t0);
+  frame[5] = locals.t0;
+  frame[4] = locals.t0;
+  frame[3] = locals.t2;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  locals.t0 = _sh_ljs_is_object(locals.t0) ? locals.t0 : locals.t2;
+  np0 = _sh_ljs_double(1);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[32], &np0, s_prop_cache + 107);
+  locals.t1 = _sh_ljs_param(frame, 1);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[33], &locals.t1, s_prop_cache + 108);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:342:3
+static SHLegacyValue _18_onSettledFulfill__InternalBytecode_js_342(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 2);
+  locals.head.count =2;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_new_object(shr);
+  locals.t1 = _sh_ljs_get_string(shr, s_symbols[47]);
+  _sh_ljs_put_new_own_by_id(shr, &locals.t0, s_symbols[48], &locals.t1);
+  locals.t1 = _sh_ljs_param(frame, 1);
+  _sh_ljs_put_new_own_by_id(shr, &locals.t0, s_symbols[49], &locals.t1);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:345:3
+static SHLegacyValue _19_onSettledReject__InternalBytecode_js_345(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 2);
+  locals.head.count =2;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_new_object(shr);
+  locals.t1 = _sh_ljs_get_string(shr, s_symbols[50]);
+  _sh_ljs_put_new_own_by_id(shr, &locals.t0, s_symbols[48], &locals.t1);
+  locals.t1 = _sh_ljs_param(frame, 1);
+  _sh_ljs_put_new_own_by_id(shr, &locals.t0, s_symbols[51], &locals.t1);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:348:3
+static SHLegacyValue _20_mapAllSettled__InternalBytecode_js_348(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+    SHLegacyValue t4;
+    SHLegacyValue t5;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =6;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+  locals.t5 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_param(frame, 1);
+  if(_sh_ljs_to_boolean(locals.t0)) goto L1;
+  goto L6;
+
+L1:
+  ;
+  locals.t1 = _sh_ljs_typeof(shr, &locals.t0);
+  locals.t2 = _sh_ljs_get_string(shr, s_symbols[29]);
+  if(_sh_ljs_strict_equal(locals.t1, locals.t2)) goto L3;
+  goto L2;
+
+L2:
+  ;
+  locals.t2 = _sh_ljs_get_string(shr, s_symbols[30]);
+  if(_sh_ljs_strict_equal(locals.t1, locals.t2)) goto L3;
+  goto L6;
+
+L3:
+  ;
+  locals.t1 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t2 = _sh_ljs_load_from_env(locals.t1, 4);
+  np0 = _sh_ljs_instance_of_rjs(shr, &locals.t0, &locals.t2);
+  if(_sh_ljs_get_bool(np0)) goto L4;
+  goto L5;
+
+L4:
+  ;
+  locals.t3 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[13], s_prop_cache + 109);
+  locals.t4 = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[12], s_prop_cache + 110);
+  locals.t4 = _sh_ljs_get_by_id_rjs(shr,&locals.t4,s_symbols[13], s_prop_cache + 111);
+  if(_sh_ljs_strict_equal(locals.t3, locals.t4)) goto L8;
+  goto L5;
+
+L5:
+  ;
+  locals.t3 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[13], s_prop_cache + 112);
+  locals.t4 = _sh_ljs_typeof(shr, &locals.t3);
+  locals.t5 = _sh_ljs_get_string(shr, s_symbols[30]);
+  if(_sh_ljs_strict_equal(locals.t4, locals.t5)) goto L7;
+  goto L6;
+
+L6:
+  ;
+  locals.t4 = _sh_ljs_get_env(shr, frame, 0);
+  frame[5] = _sh_ljs_load_from_env(locals.t4, 23);
+  np0 = _sh_ljs_undefined();
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_undefined();
+  frame[3] = locals.t0;
+  locals.t4 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t4;
+
+L7:
+  ;
+  frame[5] = _sh_ljs_get_by_id_rjs(shr,&locals.t3,s_symbols[7], s_prop_cache + 113);
+  np0 = _sh_ljs_undefined();
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = locals.t3;
+  frame[3] = locals.t0;
+  frame[3] = _sh_ljs_call(shr, frame, 1);
+  locals.t4 = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[12], s_prop_cache + 114);
+  locals.t4 = _sh_ljs_create_this(shr, &locals.t4, &locals.t2);
+  frame[6] = locals.t2;
+  frame[5] = locals.t2;
+  frame[4] = locals.t4;
+  locals.t2 = _sh_ljs_call(shr, frame, 1);
+  locals.t2 = _sh_ljs_is_object(locals.t2) ? locals.t2 : locals.t4;
+  frame[5] = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[13], s_prop_cache + 115);
+  frame[3] = _sh_ljs_load_from_env(locals.t1, 23);
+  frame[2] = _sh_ljs_load_from_env(locals.t1, 24);
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = locals.t2;
+  locals.t2 = _sh_ljs_call(shr, frame, 2);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t2;
+
+L8:
+  ;
+  frame[5] = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[13], s_prop_cache + 116);
+  frame[3] = _sh_ljs_load_from_env(locals.t1, 23);
+  frame[2] = _sh_ljs_load_from_env(locals.t1, 24);
+  np0 = _sh_ljs_undefined();
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = locals.t0;
+  locals.t0 = _sh_ljs_call(shr, frame, 2);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:385:3
+static SHLegacyValue _21_getAggregateError__InternalBytecode_js_385(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+    SHLegacyValue t4;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =5;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_param(frame, 1);
+  locals.t1 = _sh_ljs_get_global_object(shr);
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[52], s_prop_cache + 117);
+  locals.t2 = _sh_ljs_typeof(shr, &locals.t2);
+  locals.t3 = _sh_ljs_get_string(shr, s_symbols[30]);
+  if(_sh_ljs_strict_equal(locals.t2, locals.t3)) goto L2;
+  goto L1;
+
+L1:
+  ;
+  locals.t2 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t1,s_symbols[27], s_prop_cache + 118);
+  locals.t3 = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[12], s_prop_cache + 119);
+  locals.t3 = _sh_ljs_create_this(shr, &locals.t3, &locals.t2);
+  frame[3] = _sh_ljs_get_string(shr, s_symbols[53]);
+  frame[6] = locals.t2;
+  frame[5] = locals.t2;
+  frame[4] = locals.t3;
+  locals.t2 = _sh_ljs_call(shr, frame, 1);
+  locals.t2 = _sh_ljs_is_object(locals.t2) ? locals.t2 : locals.t3;
+  locals.t3 = _sh_ljs_get_string(shr, s_symbols[52]);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t2,s_symbols[54], &locals.t3, s_prop_cache + 120);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t2,s_symbols[55], &locals.t0, s_prop_cache + 121);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t2;
+
+L2:
+  ;
+  locals.t1 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t1,s_symbols[52], s_prop_cache + 122);
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[12], s_prop_cache + 123);
+  locals.t2 = _sh_ljs_create_this(shr, &locals.t2, &locals.t1);
+  frame[2] = _sh_ljs_get_string(shr, s_symbols[53]);
+  frame[6] = locals.t1;
+  frame[5] = locals.t1;
+  frame[4] = locals.t2;
+  frame[3] = locals.t0;
+  locals.t0 = _sh_ljs_call(shr, frame, 2);
+  locals.t0 = _sh_ljs_is_object(locals.t0) ? locals.t0 : locals.t2;
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:449:3
+static SHLegacyValue _22_disable__InternalBytecode_js_449(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 2);
+  locals.head.count =1;
+  locals.t0 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_get_env(shr, frame, 0);
+  np0 = _sh_ljs_bool(false);
+  _sh_ljs_store_to_env(shr, locals.t0,np0, 28);
+  locals.t0 = _sh_ljs_load_from_env(locals.t0, 4);
+  np0 = _sh_ljs_null();
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[9], &np0, s_prop_cache + 124);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[10], &np0, s_prop_cache + 125);
+  np0 = _sh_ljs_undefined();
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:456:3
+static SHLegacyValue _23_enable__InternalBytecode_js_456(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 10);
+  locals.head.count =3;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 5);
+  locals.t1 = _sh_ljs_param(frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 0);
+  np0 = _sh_ljs_undefined();
+  _sh_ljs_store_to_env(shr, locals.t0,np0, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,np0, 2);
+  _sh_ljs_store_to_env(shr, locals.t0,np0, 3);
+  locals.t2 = _sh_ljs_create_closure(shr, &locals.t0, _41_onUnhandled__InternalBytecode_js_496, &s_function_info_table[41]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t2, 4);
+  if(_sh_ljs_to_boolean(locals.t1)) goto L2;
+  goto L1;
+
+L1:
+  ;
+  locals.t1 = _sh_ljs_new_object(shr);
+  goto L2;
+L2:
+  ;
+  // PhiInst
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 0);
+  locals.t1 = _sh_ljs_get_env(shr, frame, 0);
+  np1 = _sh_ljs_load_from_env(locals.t1, 28);
+  if(_sh_ljs_to_boolean(np1)) goto L3;
+  goto L4;
+
+L3:
+  ;
+  frame[3] = _sh_ljs_load_from_env(locals.t1, 29);
+  frame[4] = _sh_ljs_undefined();
+  frame[2] = _sh_ljs_undefined();
+  np1 = _sh_ljs_call(shr, frame, 0);
+  goto L4;
+L4:
+  ;
+  np1 = _sh_ljs_bool(true);
+  _sh_ljs_store_to_env(shr, locals.t1,np1, 28);
+  np1 = _sh_ljs_double(0);
+  _sh_ljs_store_to_env(shr, locals.t0,np1, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,np1, 2);
+  locals.t2 = _sh_ljs_new_object(shr);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t2, 3);
+  locals.t1 = _sh_ljs_load_from_env(locals.t1, 4);
+  locals.t2 = _sh_ljs_create_closure(shr, &locals.t0, _42__15___InternalBytecode_js_463, &s_function_info_table[42]);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t1,s_symbols[9], &locals.t2, s_prop_cache + 126);
+  locals.t0 = _sh_ljs_create_closure(shr, &locals.t0, _43__16___InternalBytecode_js_476, &s_function_info_table[43]);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t1,s_symbols[10], &locals.t0, s_prop_cache + 127);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:537:3
+static SHLegacyValue _24_logError__InternalBytecode_js_537(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+    SHLegacyValue t4;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =5;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_param(frame, 2);
+  locals.t1 = _sh_ljs_get_global_object(shr);
+  locals.t1 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t1,s_symbols[56], s_prop_cache + 128);
+  frame[4] = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[57], s_prop_cache + 129);
+  locals.t3 = _sh_ljs_get_string(shr, s_symbols[58]);
+  locals.t4 = _sh_ljs_param(frame, 1);
+  locals.t3 = _sh_ljs_add_rjs(shr, &locals.t3, &locals.t4);
+  np0 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_get_string(shr, s_symbols[59]);
+  frame[2] = _sh_ljs_add_rjs(shr, &locals.t3, &locals.t4);
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = locals.t1;
+  locals.t1 = _sh_ljs_call(shr, frame, 1);
+  locals.t1 = locals.t0;
+  if(_sh_ljs_to_boolean(locals.t1)) goto L1;
+  goto L4;
+
+L1:
+  ;
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[60], s_prop_cache + 130);
+  if(_sh_ljs_to_boolean(locals.t2)) goto L3;
+  goto L2;
+
+L2:
+  ;
+  locals.t2 = locals.t0;
+  goto L3;
+L3:
+  ;
+  // PhiInst
+  locals.t1 = locals.t2;
+  goto L4;
+L4:
+  ;
+  // PhiInst
+  locals.t0 = _sh_ljs_add_empty_string_rjs(shr, &locals.t1);
+  frame[4] = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[61], s_prop_cache + 131);
+  frame[2] = _sh_ljs_get_string(shr, s_symbols[62]);
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = locals.t0;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  frame[4] = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[63], s_prop_cache + 132);
+  _sh_ljs_create_environment(shr, frame, &locals.t2, 0);
+  frame[2] = _sh_ljs_create_closure(shr, &locals.t2, _44__17___InternalBytecode_js_540, &s_function_info_table[44]);
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = locals.t0;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:545:3
+static SHLegacyValue _25_matchWhitelist__InternalBytecode_js_545(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =3;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 1);
+  locals.t1 = _sh_ljs_param(frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 0);
+  locals.t1 = _sh_ljs_param(frame, 2);
+  frame[4] = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[64], s_prop_cache + 133);
+  np0 = _sh_ljs_undefined();
+  frame[2] = _sh_ljs_create_closure(shr, &locals.t0, _45__18___InternalBytecode_js_546, &s_function_info_table[45]);
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = locals.t1;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:88:28
+static SHLegacyValue _26__2___InternalBytecode_js_88(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+    SHLegacyValue t4;
+    SHLegacyValue t5;
+    SHLegacyValue t6;
+    SHLegacyValue t7;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 13);
+  locals.head.count =8;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+  locals.t5 = _sh_ljs_undefined();
+  locals.t6 = _sh_ljs_undefined();
+  locals.t7 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = frame[-8];
+  locals.t1 = _sh_ljs_param(frame, 1);
+  locals.t2 = _sh_ljs_param(frame, 2);
+  locals.t3 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[37], s_prop_cache + 134);
+  locals.t4 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t5 = _sh_ljs_load_from_env(locals.t4, 5);
+  if(!_sh_ljs_strict_equal(locals.t3, locals.t5)) goto L2;
+  goto L1;
+
+L1:
+  ;
+  frame[4] = _sh_ljs_load_from_env(locals.t4, 1);
+  locals.t6 = _sh_ljs_get_by_id_rjs(shr,&locals.t5,s_symbols[12], s_prop_cache + 135);
+  locals.t6 = _sh_ljs_create_this(shr, &locals.t6, &locals.t5);
+  np0 = _sh_ljs_undefined();
+  frame[7] = _sh_ljs_undefined();
+  frame[6] = locals.t5;
+  frame[5] = locals.t6;
+  np1 = _sh_ljs_call(shr, frame, 1);
+  locals.t3 = _sh_ljs_load_from_env(locals.t4, 7);
+  locals.t5 = _sh_ljs_load_from_env(locals.t4, 13);
+  locals.t7 = _sh_ljs_get_by_id_rjs(shr,&locals.t5,s_symbols[12], s_prop_cache + 136);
+  locals.t7 = _sh_ljs_create_this(shr, &locals.t7, &locals.t5);
+  frame[7] = _sh_ljs_undefined();
+  frame[6] = locals.t5;
+  frame[5] = locals.t7;
+  frame[4] = locals.t1;
+  frame[3] = locals.t2;
+  frame[2] = locals.t6;
+  np1 = _sh_ljs_call(shr, frame, 3);
+  frame[5] = _sh_ljs_double(0);
+  frame[7] = _sh_ljs_undefined();
+  frame[6] = locals.t3;
+  frame[4] = locals.t0;
+  frame[3] = locals.t7;
+  np0 = _sh_ljs_call(shr, frame, 2);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t6;
+
+L2:
+  ;
+  frame[6] = _sh_ljs_load_from_env(locals.t4, 6);
+  np0 = _sh_ljs_undefined();
+  frame[5] = _sh_ljs_double(0);
+  frame[7] = _sh_ljs_undefined();
+  frame[4] = locals.t0;
+  frame[3] = locals.t1;
+  frame[2] = locals.t2;
+  locals.t0 = _sh_ljs_call(shr, frame, 3);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:265:18
+static SHLegacyValue _27__3___InternalBytecode_js_265(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+    SHLegacyValue t4;
+    SHLegacyValue t5;
+    SHLegacyValue t6;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =7;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+  locals.t5 = _sh_ljs_undefined();
+  locals.t6 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+  SHJmpBuf jmpBuf0;
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 1);
+  // AllockStackInst
+  locals.t2 = _sh_ljs_param(frame, 1);
+  np0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t4 = _sh_ljs_load_from_env(locals.t3, 4);
+  np1 = _sh_ljs_instance_of_rjs(shr, &locals.t2, &locals.t4);
+  if(_sh_ljs_get_bool(np1)) goto L23;
+  goto L1;
+
+L1:
+  ;
+  np1 = _sh_ljs_null();
+  if(_sh_ljs_strict_equal(locals.t2, np1)) goto L22;
+  goto L2;
+
+L2:
+  ;
+  if(_sh_ljs_strict_equal(locals.t2, np0)) goto L21;
+  goto L3;
+
+L3:
+  ;
+  np1 = _sh_ljs_bool(true);
+  if(_sh_ljs_strict_equal(locals.t2, np1)) goto L20;
+  goto L4;
+
+L4:
+  ;
+  np1 = _sh_ljs_bool(false);
+  if(_sh_ljs_strict_equal(locals.t2, np1)) goto L19;
+  goto L5;
+
+L5:
+  ;
+  np1 = _sh_ljs_double(0);
+  if(_sh_ljs_strict_equal(locals.t2, np1)) goto L18;
+  goto L6;
+
+L6:
+  ;
+  locals.t5 = _sh_ljs_get_string(shr, s_symbols[0]);
+  if(_sh_ljs_strict_equal(locals.t2, locals.t5)) goto L17;
+  goto L7;
+
+L7:
+  ;
+  locals.t5 = _sh_ljs_typeof(shr, &locals.t2);
+  locals.t6 = _sh_ljs_get_string(shr, s_symbols[29]);
+  if(_sh_ljs_strict_equal(locals.t5, locals.t6)) goto L9;
+  goto L8;
+
+L8:
+  ;
+  locals.t6 = _sh_ljs_get_string(shr, s_symbols[30]);
+  if(_sh_ljs_strict_equal(locals.t5, locals.t6)) goto L9;
+  goto L13;
+
+L9:
+  ;
+  if(_sh_try(shr, &jmpBuf0) == 0) goto L10;
+  goto L16;
+
+L10:
+  ;
+  locals.t5 = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[13], s_prop_cache + 137);
+  locals.t1 = locals.t5;
+  locals.t5 = _sh_ljs_typeof(shr, &locals.t5);
+  locals.t6 = _sh_ljs_get_string(shr, s_symbols[30]);
+  if(_sh_ljs_strict_equal(locals.t5, locals.t6)) goto L14;
+  goto L11;
+
+L11:
+  ;
+  goto L12;
+L12:
+  ;
+  _sh_end_try(shr, &jmpBuf0);
+  goto L13;
+L13:
+  ;
+  frame[4] = _sh_ljs_load_from_env(locals.t3, 21);
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = _sh_ljs_double(0);
+  frame[2] = locals.t2;
+  locals.t5 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t5;
+
+L14:
+  ;
+  locals.t1 = locals.t1;
+  frame[4] = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[7], s_prop_cache + 138);
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = locals.t1;
+  frame[2] = locals.t2;
+  frame[2] = _sh_ljs_call(shr, frame, 1);
+  locals.t5 = _sh_ljs_get_by_id_rjs(shr,&locals.t4,s_symbols[12], s_prop_cache + 139);
+  locals.t5 = _sh_ljs_create_this(shr, &locals.t5, &locals.t4);
+  frame[5] = locals.t4;
+  frame[4] = locals.t4;
+  frame[3] = locals.t5;
+  locals.t1 = _sh_ljs_call(shr, frame, 1);
+  goto L15;
+L15:
+  ;
+  _sh_end_try(shr, &jmpBuf0);
+  locals.t1 = _sh_ljs_is_object(locals.t1) ? locals.t1 : locals.t5;
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t1;
+
+L16:
+  ;
+  locals.t1 = _sh_catch(shr, (SHLocals*)&locals, frame, 11);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 0);
+  locals.t1 = _sh_ljs_get_by_id_rjs(shr,&locals.t4,s_symbols[12], s_prop_cache + 140);
+  locals.t1 = _sh_ljs_create_this(shr, &locals.t1, &locals.t4);
+  frame[2] = _sh_ljs_create_closure(shr, &locals.t0, _46__19___InternalBytecode_js_282, &s_function_info_table[46]);
+  frame[5] = locals.t4;
+  frame[4] = locals.t4;
+  frame[3] = locals.t1;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  locals.t0 = _sh_ljs_is_object(locals.t0) ? locals.t0 : locals.t1;
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+
+L17:
+  ;
+  locals.t0 = _sh_ljs_load_from_env(locals.t3, 20);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+
+L18:
+  ;
+  locals.t0 = _sh_ljs_load_from_env(locals.t3, 19);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+
+L19:
+  ;
+  locals.t0 = _sh_ljs_load_from_env(locals.t3, 16);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+
+L20:
+  ;
+  locals.t0 = _sh_ljs_load_from_env(locals.t3, 15);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+
+L21:
+  ;
+  locals.t0 = _sh_ljs_load_from_env(locals.t3, 18);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+
+L22:
+  ;
+  locals.t0 = _sh_ljs_load_from_env(locals.t3, 17);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+
+L23:
+  ;
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t2;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:290:25
+static SHLegacyValue _28_iterableToArray__InternalBytecode_js_290(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =4;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_param(frame, 1);
+  locals.t1 = _sh_ljs_get_global_object(shr);
+  locals.t2 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t1,s_symbols[65], s_prop_cache + 141);
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[66], s_prop_cache + 142);
+  locals.t2 = _sh_ljs_typeof(shr, &locals.t2);
+  locals.t3 = _sh_ljs_get_string(shr, s_symbols[30]);
+  if(_sh_ljs_strict_equal(locals.t2, locals.t3)) goto L2;
+  goto L1;
+
+L1:
+  ;
+  locals.t2 = _sh_ljs_get_env(shr, frame, 0);
+  _sh_ljs_create_environment(shr, frame, &locals.t3, 0);
+  locals.t3 = _sh_ljs_create_closure(shr, &locals.t3, _47_iterableToArray_1___InternalBytecode_js_298, &s_function_info_table[47]);
+  _sh_ljs_store_to_env(shr, locals.t2,locals.t3, 22);
+  locals.t2 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t1,s_symbols[65], s_prop_cache + 143);
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[12], s_prop_cache + 144);
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[67], s_prop_cache + 145);
+  frame[4] = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[68], s_prop_cache + 146);
+  np0 = _sh_ljs_undefined();
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = locals.t2;
+  frame[2] = locals.t0;
+  locals.t2 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t2;
+
+L2:
+  ;
+  locals.t2 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t1,s_symbols[65], s_prop_cache + 147);
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[66], s_prop_cache + 148);
+  locals.t3 = _sh_ljs_get_env(shr, frame, 0);
+  _sh_ljs_store_to_env(shr, locals.t3,locals.t2, 22);
+  locals.t1 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t1,s_symbols[65], s_prop_cache + 149);
+  frame[4] = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[66], s_prop_cache + 150);
+  np0 = _sh_ljs_undefined();
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = locals.t1;
+  frame[2] = locals.t0;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:302:14
+static SHLegacyValue _29__4___InternalBytecode_js_302(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =4;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 1);
+  locals.t1 = _sh_ljs_get_env(shr, frame, 0);
+  frame[4] = _sh_ljs_load_from_env(locals.t1, 22);
+  np0 = _sh_ljs_undefined();
+  frame[2] = _sh_ljs_param(frame, 1);
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_call(shr, frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t2, 0);
+  locals.t1 = _sh_ljs_load_from_env(locals.t1, 4);
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[12], s_prop_cache + 151);
+  locals.t2 = _sh_ljs_create_this(shr, &locals.t2, &locals.t1);
+  frame[2] = _sh_ljs_create_closure(shr, &locals.t0, _48__20___InternalBytecode_js_305, &s_function_info_table[48]);
+  frame[5] = locals.t1;
+  frame[4] = locals.t1;
+  frame[3] = locals.t2;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  locals.t0 = _sh_ljs_is_object(locals.t0) ? locals.t0 : locals.t2;
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:361:21
+static SHLegacyValue _30__5___InternalBytecode_js_361(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+    SHLegacyValue t4;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =5;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t1 = _sh_ljs_load_from_env(locals.t0, 4);
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[14], s_prop_cache + 152);
+  frame[4] = _sh_ljs_load_from_env(locals.t0, 22);
+  np0 = _sh_ljs_undefined();
+  frame[2] = _sh_ljs_param(frame, 1);
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_call(shr, frame, 1);
+  frame[4] = _sh_ljs_get_by_id_rjs(shr,&locals.t3,s_symbols[69], s_prop_cache + 153);
+  frame[2] = _sh_ljs_load_from_env(locals.t0, 25);
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = locals.t3;
+  frame[2] = _sh_ljs_call(shr, frame, 1);
+  frame[5] = _sh_ljs_undefined();
+  frame[4] = locals.t2;
+  frame[3] = locals.t1;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:365:17
+static SHLegacyValue _31__6___InternalBytecode_js_365(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =3;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 1);
+  locals.t1 = _sh_ljs_param(frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 0);
+  locals.t1 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t1 = _sh_ljs_load_from_env(locals.t1, 4);
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[12], s_prop_cache + 154);
+  locals.t2 = _sh_ljs_create_this(shr, &locals.t2, &locals.t1);
+  frame[2] = _sh_ljs_create_closure(shr, &locals.t0, _49__21___InternalBytecode_js_366, &s_function_info_table[49]);
+  frame[5] = locals.t1;
+  frame[4] = locals.t1;
+  frame[3] = locals.t2;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  locals.t0 = _sh_ljs_is_object(locals.t0) ? locals.t0 : locals.t2;
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:371:15
+static SHLegacyValue _32__7___InternalBytecode_js_371(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =3;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 1);
+  locals.t1 = _sh_ljs_param(frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 0);
+  locals.t1 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t1 = _sh_ljs_load_from_env(locals.t1, 4);
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[12], s_prop_cache + 155);
+  locals.t2 = _sh_ljs_create_this(shr, &locals.t2, &locals.t1);
+  frame[2] = _sh_ljs_create_closure(shr, &locals.t0, _50__22___InternalBytecode_js_372, &s_function_info_table[50]);
+  frame[5] = locals.t1;
+  frame[4] = locals.t1;
+  frame[3] = locals.t2;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  locals.t0 = _sh_ljs_is_object(locals.t0) ? locals.t0 : locals.t2;
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:381:29
+static SHLegacyValue _33__8___InternalBytecode_js_381(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =3;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = frame[-8];
+  frame[5] = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[13], s_prop_cache + 156);
+  np0 = _sh_ljs_undefined();
+  frame[3] = _sh_ljs_null();
+  frame[2] = _sh_ljs_param(frame, 1);
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = locals.t0;
+  locals.t0 = _sh_ljs_call(shr, frame, 2);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:398:14
+static SHLegacyValue _34_promiseAny__InternalBytecode_js_398(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =3;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 1);
+  locals.t1 = _sh_ljs_param(frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 0);
+  locals.t1 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t1 = _sh_ljs_load_from_env(locals.t1, 4);
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[12], s_prop_cache + 157);
+  locals.t2 = _sh_ljs_create_this(shr, &locals.t2, &locals.t1);
+  frame[2] = _sh_ljs_create_closure(shr, &locals.t0, _51__23___InternalBytecode_js_399, &s_function_info_table[51]);
+  frame[5] = locals.t1;
+  frame[4] = locals.t1;
+  frame[3] = locals.t2;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  locals.t0 = _sh_ljs_is_object(locals.t0) ? locals.t0 : locals.t2;
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:429:28
+static SHLegacyValue _35__9___InternalBytecode_js_429(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =4;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 1);
+  locals.t1 = frame[-8];
+  locals.t2 = _sh_ljs_param(frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t2, 0);
+  frame[5] = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[13], s_prop_cache + 158);
+  np0 = _sh_ljs_undefined();
+  frame[3] = _sh_ljs_create_closure(shr, &locals.t0, _52__24___InternalBytecode_js_430, &s_function_info_table[52]);
+  frame[2] = _sh_ljs_create_closure(shr, &locals.t0, _53__25___InternalBytecode_js_434, &s_function_info_table[53]);
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = locals.t1;
+  locals.t0 = _sh_ljs_call(shr, frame, 2);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:603:30
+static SHLegacyValue _36__10___InternalBytecode_js_603(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+    SHLegacyValue t4;
+    SHLegacyValue t5;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =6;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+  locals.t5 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 4);
+  locals.t1 = _sh_ljs_param(frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 0);
+  locals.t1 = _sh_ljs_param(frame, 2);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 1);
+  np0 = _sh_ljs_undefined();
+  _sh_ljs_store_to_env(shr, locals.t0,np0, 2);
+  locals.t1 = _sh_ljs_create_closure(shr, &locals.t0, _54_step__InternalBytecode_js_605, &s_function_info_table[54]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 3);
+  locals.t2 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t3 = _sh_ljs_load_from_env(locals.t2, 0);
+  frame[5] = _sh_ljs_get_by_id_rjs(shr,&locals.t3,s_symbols[70], s_prop_cache + 159);
+  frame[3] = _sh_ljs_load_from_env(locals.t2, 1);
+  frame[2] = _sh_ljs_load_from_env(locals.t2, 2);
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = locals.t3;
+  locals.t2 = _sh_ljs_call(shr, frame, 2);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t2, 2);
+  frame[4] = _sh_ljs_double(0);
+  frame[3] = _sh_ljs_create_closure(shr, &locals.t0, _55__26___InternalBytecode_js_633, &s_function_info_table[55]);
+  frame[6] = _sh_ljs_undefined();
+  frame[5] = locals.t1;
+  np1 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:98:33
+static SHLegacyValue _37__11___InternalBytecode_js_98(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+    SHLegacyValue t4;
+    SHLegacyValue t5;
+    SHLegacyValue t6;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 13);
+  locals.head.count =7;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+  locals.t5 = _sh_ljs_undefined();
+  locals.t6 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_get_env(shr, frame, 1);
+  locals.t1 = _sh_ljs_load_from_env(locals.t0, 5);
+  frame[4] = _sh_ljs_load_from_env(locals.t0, 1);
+  locals.t3 = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[12], s_prop_cache + 160);
+  locals.t3 = _sh_ljs_create_this(shr, &locals.t3, &locals.t1);
+  np0 = _sh_ljs_undefined();
+  frame[7] = _sh_ljs_undefined();
+  frame[6] = locals.t1;
+  frame[5] = locals.t3;
+  np1 = _sh_ljs_call(shr, frame, 1);
+  frame[6] = _sh_ljs_get_by_id_rjs(shr,&locals.t3,s_symbols[13], s_prop_cache + 161);
+  frame[4] = _sh_ljs_param(frame, 1);
+  frame[3] = _sh_ljs_param(frame, 2);
+  frame[7] = _sh_ljs_undefined();
+  frame[5] = locals.t3;
+  locals.t1 = _sh_ljs_call(shr, frame, 2);
+  locals.t1 = _sh_ljs_load_from_env(locals.t0, 7);
+  locals.t2 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t4 = _sh_ljs_load_from_env(locals.t2, 0);
+  locals.t0 = _sh_ljs_load_from_env(locals.t0, 13);
+  frame[4] = _sh_ljs_load_from_env(locals.t2, 1);
+  frame[3] = _sh_ljs_load_from_env(locals.t2, 2);
+  locals.t6 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[12], s_prop_cache + 162);
+  locals.t6 = _sh_ljs_create_this(shr, &locals.t6, &locals.t0);
+  frame[7] = _sh_ljs_undefined();
+  frame[6] = locals.t0;
+  frame[5] = locals.t6;
+  frame[2] = locals.t3;
+  np1 = _sh_ljs_call(shr, frame, 3);
+  frame[5] = _sh_ljs_double(0);
+  frame[7] = _sh_ljs_undefined();
+  frame[6] = locals.t1;
+  frame[4] = locals.t4;
+  frame[3] = locals.t6;
+  np1 = _sh_ljs_call(shr, frame, 2);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:135:20
+static SHLegacyValue _38__12___InternalBytecode_js_135(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =2;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_get_env(shr, frame, 1);
+  frame[4] = _sh_ljs_load_from_env(locals.t0, 9);
+  locals.t1 = _sh_ljs_get_env(shr, frame, 0);
+  frame[2] = _sh_ljs_load_from_env(locals.t1, 0);
+  np0 = _sh_ljs_undefined();
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = _sh_ljs_undefined();
+  np1 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:229:30
+static SHLegacyValue _39__13___InternalBytecode_js_229(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =3;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_get_env(shr, frame, 0);
+  np0 = _sh_ljs_load_from_env(locals.t0, 1);
+  if(_sh_ljs_get_bool(np0)) goto L2;
+  goto L1;
+
+L1:
+  ;
+  np0 = _sh_ljs_bool(true);
+  _sh_ljs_store_to_env(shr, locals.t0,np0, 1);
+  locals.t1 = _sh_ljs_get_env(shr, frame, 1);
+  frame[5] = _sh_ljs_load_from_env(locals.t1, 10);
+  frame[3] = _sh_ljs_load_from_env(locals.t0, 0);
+  np0 = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_double(0);
+  frame[2] = _sh_ljs_param(frame, 1);
+  frame[6] = _sh_ljs_undefined();
+  np1 = _sh_ljs_call(shr, frame, 2);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+
+L2:
+  ;
+  np0 = _sh_ljs_undefined();
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:233:8
+static SHLegacyValue _40__14___InternalBytecode_js_233(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =3;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_get_env(shr, frame, 0);
+  np0 = _sh_ljs_load_from_env(locals.t0, 1);
+  if(_sh_ljs_get_bool(np0)) goto L2;
+  goto L1;
+
+L1:
+  ;
+  np0 = _sh_ljs_bool(true);
+  _sh_ljs_store_to_env(shr, locals.t0,np0, 1);
+  locals.t1 = _sh_ljs_get_env(shr, frame, 1);
+  frame[5] = _sh_ljs_load_from_env(locals.t1, 11);
+  frame[3] = _sh_ljs_load_from_env(locals.t0, 0);
+  np0 = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_double(0);
+  frame[2] = _sh_ljs_param(frame, 1);
+  frame[6] = _sh_ljs_undefined();
+  np1 = _sh_ljs_call(shr, frame, 2);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+
+L2:
+  ;
+  np0 = _sh_ljs_undefined();
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:496:5
+static SHLegacyValue _41_onUnhandled__InternalBytecode_js_496(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+    SHLegacyValue t4;
+    SHLegacyValue t5;
+    SHLegacyValue t6;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =7;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+  locals.t5 = _sh_ljs_undefined();
+  locals.t6 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_param(frame, 1);
+  locals.t1 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t2 = _sh_ljs_load_from_env(locals.t1, 0);
+  locals.t3 = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[71], s_prop_cache + 163);
+  if(_sh_ljs_to_boolean(locals.t3)) goto L4;
+  goto L1;
+
+L1:
+  ;
+  locals.t3 = _sh_ljs_get_env(shr, frame, 1);
+  locals.t4 = _sh_ljs_load_from_env(locals.t3, 31);
+  locals.t5 = _sh_ljs_load_from_env(locals.t1, 3);
+  locals.t5 = _sh_ljs_get_by_val_rjs(shr,&locals.t5, &locals.t0);
+  locals.t5 = _sh_ljs_get_by_id_rjs(shr,&locals.t5,s_symbols[72], s_prop_cache + 164);
+  locals.t6 = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[73], s_prop_cache + 165);
+  if(_sh_ljs_to_boolean(locals.t6)) goto L3;
+  goto L2;
+
+L2:
+  ;
+  locals.t6 = _sh_ljs_load_from_env(locals.t3, 27);
+  goto L3;
+L3:
+  ;
+  // PhiInst
+  np0 = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_double(0);
+  frame[6] = _sh_ljs_undefined();
+  frame[5] = locals.t4;
+  frame[3] = locals.t5;
+  frame[2] = locals.t6;
+  locals.t3 = _sh_ljs_call(shr, frame, 2);
+  if(_sh_ljs_to_boolean(locals.t3)) goto L4;
+  goto L7;
+
+L4:
+  ;
+  locals.t3 = _sh_ljs_load_from_env(locals.t1, 3);
+  locals.t4 = _sh_ljs_get_by_val_rjs(shr,&locals.t3, &locals.t0);
+  locals.t5 = _sh_ljs_load_from_env(locals.t1, 2);
+  locals.t5 = _sh_ljs_to_numeric_rjs(shr, &locals.t5);
+  locals.t6 = _sh_ljs_inc_rjs(shr, &locals.t5);
+  _sh_ljs_store_to_env(shr, locals.t1,locals.t6, 2);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t4,s_symbols[74], &locals.t5, s_prop_cache + 166);
+  locals.t1 = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[75], s_prop_cache + 167);
+  locals.t4 = _sh_ljs_get_by_val_rjs(shr,&locals.t3, &locals.t0);
+  np0 = _sh_ljs_bool(true);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t4,s_symbols[76], &np0, s_prop_cache + 168);
+  if(_sh_ljs_to_boolean(locals.t1)) goto L6;
+  goto L5;
+
+L5:
+  ;
+  locals.t1 = _sh_ljs_get_env(shr, frame, 1);
+  frame[5] = _sh_ljs_load_from_env(locals.t1, 30);
+  locals.t4 = _sh_ljs_get_by_val_rjs(shr,&locals.t3, &locals.t0);
+  frame[3] = _sh_ljs_get_by_id_rjs(shr,&locals.t4,s_symbols[74], s_prop_cache + 169);
+  locals.t5 = _sh_ljs_get_by_val_rjs(shr,&locals.t3, &locals.t0);
+  frame[2] = _sh_ljs_get_by_id_rjs(shr,&locals.t5,s_symbols[72], s_prop_cache + 170);
+  np0 = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_double(0);
+  frame[6] = _sh_ljs_undefined();
+  np0 = _sh_ljs_call(shr, frame, 2);
+  goto L7;
+L6:
+  ;
+  frame[5] = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[75], s_prop_cache + 171);
+  locals.t4 = _sh_ljs_get_by_val_rjs(shr,&locals.t3, &locals.t0);
+  frame[3] = _sh_ljs_get_by_id_rjs(shr,&locals.t4,s_symbols[74], s_prop_cache + 172);
+  locals.t0 = _sh_ljs_get_by_val_rjs(shr,&locals.t3, &locals.t0);
+  frame[2] = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[72], s_prop_cache + 173);
+  np0 = _sh_ljs_undefined();
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = locals.t2;
+  locals.t0 = _sh_ljs_call(shr, frame, 2);
+  goto L7;
+L7:
+  ;
+  np0 = _sh_ljs_undefined();
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:463:15
+static SHLegacyValue _42__15___InternalBytecode_js_463(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+    SHLegacyValue t4;
+    SHLegacyValue t5;
+    SHLegacyValue t6;
+    SHLegacyValue t7;
+    SHLegacyValue t8;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =9;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+  locals.t5 = _sh_ljs_undefined();
+  locals.t6 = _sh_ljs_undefined();
+  locals.t7 = _sh_ljs_undefined();
+  locals.t8 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_param(frame, 1);
+  locals.t1 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[32], s_prop_cache + 174);
+  np0 = _sh_ljs_double(2);
+  if(_sh_ljs_strict_equal(locals.t1, np0)) goto L1;
+  goto L10;
+
+L1:
+  ;
+  locals.t1 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t2 = _sh_ljs_load_from_env(locals.t1, 3);
+  locals.t3 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[77], s_prop_cache + 175);
+  locals.t3 = _sh_ljs_get_by_val_rjs(shr,&locals.t2, &locals.t3);
+  if(_sh_ljs_to_boolean(locals.t3)) goto L2;
+  goto L10;
+
+L2:
+  ;
+  locals.t3 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[77], s_prop_cache + 176);
+  locals.t3 = _sh_ljs_get_by_val_rjs(shr,&locals.t2, &locals.t3);
+  locals.t3 = _sh_ljs_get_by_id_rjs(shr,&locals.t3,s_symbols[76], s_prop_cache + 177);
+  if(_sh_ljs_to_boolean(locals.t3)) goto L4;
+  goto L3;
+
+L3:
+  ;
+  locals.t3 = _sh_ljs_get_global_object(shr);
+  frame[5] = _sh_ljs_try_get_by_id_rjs(shr,&locals.t3,s_symbols[78], s_prop_cache + 178);
+  locals.t4 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[77], s_prop_cache + 179);
+  locals.t4 = _sh_ljs_get_by_val_rjs(shr,&locals.t2, &locals.t4);
+  frame[3] = _sh_ljs_get_by_id_rjs(shr,&locals.t4,s_symbols[79], s_prop_cache + 180);
+  np0 = _sh_ljs_undefined();
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_call(shr, frame, 1);
+  goto L9;
+L4:
+  ;
+  locals.t3 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[77], s_prop_cache + 181);
+  locals.t4 = _sh_ljs_get_by_val_rjs(shr,&locals.t2, &locals.t3);
+  locals.t4 = _sh_ljs_get_by_id_rjs(shr,&locals.t4,s_symbols[76], s_prop_cache + 182);
+  if(_sh_ljs_to_boolean(locals.t4)) goto L5;
+  goto L9;
+
+L5:
+  ;
+  locals.t1 = _sh_ljs_load_from_env(locals.t1, 0);
+  locals.t4 = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[80], s_prop_cache + 183);
+  if(_sh_ljs_to_boolean(locals.t4)) goto L8;
+  goto L6;
+
+L6:
+  ;
+  locals.t4 = _sh_ljs_get_by_val_rjs(shr,&locals.t2, &locals.t3);
+  locals.t4 = _sh_ljs_get_by_id_rjs(shr,&locals.t4,s_symbols[75], s_prop_cache + 184);
+  if(_sh_ljs_to_boolean(locals.t4)) goto L9;
+  goto L7;
+
+L7:
+  ;
+  locals.t4 = _sh_ljs_get_global_object(shr);
+  locals.t5 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t4,s_symbols[56], s_prop_cache + 185);
+  frame[5] = _sh_ljs_get_by_id_rjs(shr,&locals.t5,s_symbols[57], s_prop_cache + 186);
+  locals.t7 = _sh_ljs_get_by_val_rjs(shr,&locals.t2, &locals.t3);
+  locals.t7 = _sh_ljs_get_by_id_rjs(shr,&locals.t7,s_symbols[74], s_prop_cache + 187);
+  locals.t8 = _sh_ljs_get_string(shr, s_symbols[81]);
+  locals.t7 = _sh_ljs_add_rjs(shr, &locals.t8, &locals.t7);
+  np0 = _sh_ljs_undefined();
+  locals.t8 = _sh_ljs_get_string(shr, s_symbols[59]);
+  frame[3] = _sh_ljs_add_rjs(shr, &locals.t7, &locals.t8);
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = locals.t5;
+  locals.t5 = _sh_ljs_call(shr, frame, 1);
+  locals.t4 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t4,s_symbols[56], s_prop_cache + 188);
+  frame[5] = _sh_ljs_get_by_id_rjs(shr,&locals.t4,s_symbols[57], s_prop_cache + 189);
+  locals.t6 = _sh_ljs_get_by_val_rjs(shr,&locals.t2, &locals.t3);
+  locals.t6 = _sh_ljs_get_by_id_rjs(shr,&locals.t6,s_symbols[74], s_prop_cache + 190);
+  locals.t7 = _sh_ljs_get_string(shr, s_symbols[82]);
+  locals.t6 = _sh_ljs_add_rjs(shr, &locals.t7, &locals.t6);
+  locals.t7 = _sh_ljs_get_string(shr, s_symbols[83]);
+  frame[3] = _sh_ljs_add_rjs(shr, &locals.t6, &locals.t7);
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = locals.t4;
+  locals.t4 = _sh_ljs_call(shr, frame, 1);
+  goto L9;
+L8:
+  ;
+  frame[5] = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[80], s_prop_cache + 191);
+  locals.t5 = _sh_ljs_get_by_val_rjs(shr,&locals.t2, &locals.t3);
+  frame[3] = _sh_ljs_get_by_id_rjs(shr,&locals.t5,s_symbols[74], s_prop_cache + 192);
+  locals.t3 = _sh_ljs_get_by_val_rjs(shr,&locals.t2, &locals.t3);
+  frame[2] = _sh_ljs_get_by_id_rjs(shr,&locals.t3,s_symbols[72], s_prop_cache + 193);
+  np0 = _sh_ljs_undefined();
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = locals.t1;
+  locals.t1 = _sh_ljs_call(shr, frame, 2);
+  goto L9;
+L9:
+  ;
+  locals.t0 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[77], s_prop_cache + 194);
+  np0 = _sh_ljs_del_by_val_strict(shr, &locals.t2, &locals.t0);
+  goto L10;
+L10:
+  ;
+  np0 = _sh_ljs_undefined();
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:476:15
+static SHLegacyValue _43__16___InternalBytecode_js_476(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+    SHLegacyValue t4;
+    SHLegacyValue t5;
+    SHLegacyValue t6;
+    SHLegacyValue t7;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =8;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+  locals.t5 = _sh_ljs_undefined();
+  locals.t6 = _sh_ljs_undefined();
+  locals.t7 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+  SHLegacyValue np2 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_param(frame, 1);
+  locals.t1 = _sh_ljs_param(frame, 2);
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[31], s_prop_cache + 195);
+  np0 = _sh_ljs_double(0);
+  if(_sh_ljs_strict_equal(locals.t2, np0)) goto L1;
+  goto L4;
+
+L1:
+  ;
+  locals.t2 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t3 = _sh_ljs_load_from_env(locals.t2, 1);
+  locals.t3 = _sh_ljs_to_numeric_rjs(shr, &locals.t3);
+  locals.t4 = _sh_ljs_inc_rjs(shr, &locals.t3);
+  _sh_ljs_store_to_env(shr, locals.t2,locals.t4, 1);
+  _sh_ljs_put_by_id_strict_rjs(shr,&locals.t0,s_symbols[77], &locals.t3, s_prop_cache + 196);
+  locals.t3 = _sh_ljs_load_from_env(locals.t2, 3);
+  locals.t4 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[77], s_prop_cache + 197);
+  locals.t5 = _sh_ljs_new_object(shr);
+  np1 = _sh_ljs_null();
+  _sh_ljs_put_new_own_by_id(shr, &locals.t5, s_symbols[74], &np1);
+  _sh_ljs_put_new_own_by_id(shr, &locals.t5, s_symbols[72], &locals.t1);
+  locals.t6 = _sh_ljs_get_global_object(shr);
+  locals.t6 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t6,s_symbols[84], s_prop_cache + 198);
+  locals.t2 = _sh_ljs_load_from_env(locals.t2, 4);
+  frame[5] = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[7], s_prop_cache + 199);
+  frame[2] = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[77], s_prop_cache + 200);
+  np2 = _sh_ljs_undefined();
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = locals.t2;
+  frame[3] = _sh_ljs_null();
+  locals.t0 = _sh_ljs_call(shr, frame, 2);
+  locals.t2 = _sh_ljs_get_env(shr, frame, 1);
+  frame[5] = _sh_ljs_load_from_env(locals.t2, 31);
+  frame[2] = _sh_ljs_load_from_env(locals.t2, 27);
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_double(0);
+  frame[3] = locals.t1;
+  locals.t1 = _sh_ljs_call(shr, frame, 2);
+  np0 = _sh_ljs_double(2000);
+  if(_sh_ljs_to_boolean(locals.t1)) goto L2;
+  goto L3;
+
+L2:
+  ;
+  np0 = _sh_ljs_double(100);
+  goto L3;
+L3:
+  ;
+  // PhiInst
+  frame[6] = _sh_ljs_undefined();
+  frame[5] = locals.t6;
+  frame[4] = _sh_ljs_undefined();
+  frame[3] = locals.t0;
+  frame[2] = np0;
+  locals.t0 = _sh_ljs_call(shr, frame, 2);
+  _sh_ljs_put_new_own_by_id(shr, &locals.t5, s_symbols[79], &locals.t0);
+  np0 = _sh_ljs_bool(false);
+  _sh_ljs_put_new_own_by_id(shr, &locals.t5, s_symbols[76], &np0);
+  _sh_ljs_put_by_val_strict_rjs(shr,&locals.t3, &locals.t4, &locals.t5);
+  goto L4;
+L4:
+  ;
+  np0 = _sh_ljs_undefined();
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:540:32
+static SHLegacyValue _44__17___InternalBytecode_js_540(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =4;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_get_global_object(shr);
+  locals.t0 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t0,s_symbols[56], s_prop_cache + 201);
+  frame[4] = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[57], s_prop_cache + 202);
+  locals.t2 = _sh_ljs_get_string(shr, s_symbols[85]);
+  locals.t3 = _sh_ljs_param(frame, 1);
+  frame[2] = _sh_ljs_add_rjs(shr, &locals.t2, &locals.t3);
+  np0 = _sh_ljs_undefined();
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = locals.t0;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:546:22
+static SHLegacyValue _45__18___InternalBytecode_js_546(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 2);
+  locals.head.count =2;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t0 = _sh_ljs_load_from_env(locals.t0, 0);
+  locals.t1 = _sh_ljs_param(frame, 1);
+  np0 = _sh_ljs_instance_of_rjs(shr, &locals.t0, &locals.t1);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:282:25
+static SHLegacyValue _46__19___InternalBytecode_js_282(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =2;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_get_env(shr, frame, 0);
+  frame[2] = _sh_ljs_load_from_env(locals.t0, 0);
+  frame[4] = _sh_ljs_param(frame, 2);
+  np0 = _sh_ljs_undefined();
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = _sh_ljs_undefined();
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:298:23
+static SHLegacyValue _47_iterableToArray_1___InternalBytecode_js_298(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =3;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_get_global_object(shr);
+  locals.t0 = _sh_ljs_try_get_by_id_rjs(shr,&locals.t0,s_symbols[65], s_prop_cache + 203);
+  locals.t0 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[12], s_prop_cache + 204);
+  locals.t0 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[67], s_prop_cache + 205);
+  frame[4] = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[68], s_prop_cache + 206);
+  np0 = _sh_ljs_undefined();
+  frame[2] = _sh_ljs_param(frame, 1);
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = locals.t0;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:305:21
+static SHLegacyValue _48__20___InternalBytecode_js_305(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+    SHLegacyValue t4;
+    SHLegacyValue t5;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =6;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+  locals.t5 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+  SHLegacyValue np2 = _sh_ljs_undefined();
+  SHLegacyValue np3 = _sh_ljs_undefined();
+  SHLegacyValue np4 = _sh_ljs_undefined();
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 4);
+  locals.t1 = _sh_ljs_param(frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 0);
+  locals.t2 = _sh_ljs_param(frame, 2);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t2, 1);
+  np0 = _sh_ljs_undefined();
+  _sh_ljs_store_to_env(shr, locals.t0,np0, 2);
+  locals.t2 = _sh_ljs_create_closure(shr, &locals.t0, _56_res__InternalBytecode_js_308, &s_function_info_table[56]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t2, 3);
+  locals.t3 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t4 = _sh_ljs_load_from_env(locals.t3, 0);
+  locals.t5 = _sh_ljs_get_by_id_rjs(shr,&locals.t4,s_symbols[46], s_prop_cache + 207);
+  np1 = _sh_ljs_double(0);
+  if(_sh_ljs_strict_equal(locals.t5, np1)) goto L4;
+  goto L1;
+
+L1:
+  ;
+  locals.t5 = _sh_ljs_get_by_id_rjs(shr,&locals.t4,s_symbols[46], s_prop_cache + 208);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t5, 2);
+  locals.t0 = _sh_ljs_get_by_id_rjs(shr,&locals.t4,s_symbols[46], s_prop_cache + 209);
+  np2 = _sh_ljs_bool(_sh_ljs_less_rjs(shr, &np1, &locals.t0));
+  np3 = _sh_ljs_double(1);
+  np4 = _sh_ljs_double(0);
+  if(_sh_ljs_get_bool(np2)) goto L2;
+  goto L3;
+
+L2:
+  ;
+  // PhiInst
+  locals.t0 = _sh_ljs_load_from_env(locals.t3, 0);
+  frame[2] = _sh_ljs_get_by_val_rjs(shr,&locals.t0, &np4);
+  frame[6] = _sh_ljs_undefined();
+  frame[5] = locals.t2;
+  frame[4] = _sh_ljs_double(0);
+  frame[3] = np4;
+  np2 = _sh_ljs_call(shr, frame, 2);
+  np4 = _sh_ljs_double(_sh_ljs_get_double(np4) + _sh_ljs_get_double(np3));
+  locals.t0 = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[46], s_prop_cache + 210);
+  if(_sh_ljs_less_rjs(shr, &np4, &locals.t0)) goto L2;
+  goto L3;
+
+L3:
+  ;
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+
+L4:
+  ;
+  frame[3] = _sh_ljs_new_array(shr, 0);
+  frame[6] = _sh_ljs_undefined();
+  frame[5] = locals.t1;
+  frame[4] = _sh_ljs_undefined();
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:366:21
+static SHLegacyValue _49__21___InternalBytecode_js_366(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =2;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_get_env(shr, frame, 0);
+  frame[2] = _sh_ljs_load_from_env(locals.t0, 0);
+  frame[4] = _sh_ljs_param(frame, 2);
+  np0 = _sh_ljs_undefined();
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = _sh_ljs_undefined();
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:372:21
+static SHLegacyValue _50__22___InternalBytecode_js_372(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =3;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 2);
+  locals.t1 = _sh_ljs_param(frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 0);
+  locals.t1 = _sh_ljs_param(frame, 2);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 1);
+  locals.t1 = _sh_ljs_get_env(shr, frame, 1);
+  frame[4] = _sh_ljs_load_from_env(locals.t1, 22);
+  locals.t2 = _sh_ljs_get_env(shr, frame, 0);
+  frame[2] = _sh_ljs_load_from_env(locals.t2, 0);
+  np0 = _sh_ljs_undefined();
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_call(shr, frame, 1);
+  frame[4] = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[63], s_prop_cache + 211);
+  frame[2] = _sh_ljs_create_closure(shr, &locals.t0, _57__27___InternalBytecode_js_373, &s_function_info_table[57]);
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = locals.t1;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:399:21
+static SHLegacyValue _51__23___InternalBytecode_js_399(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+    SHLegacyValue t4;
+    SHLegacyValue t5;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =6;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+  locals.t5 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 7);
+  locals.t1 = _sh_ljs_param(frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 0);
+  locals.t1 = _sh_ljs_param(frame, 2);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 1);
+  np0 = _sh_ljs_undefined();
+  _sh_ljs_store_to_env(shr, locals.t0,np0, 2);
+  _sh_ljs_store_to_env(shr, locals.t0,np0, 3);
+  _sh_ljs_store_to_env(shr, locals.t0,np0, 4);
+  locals.t2 = _sh_ljs_create_closure(shr, &locals.t0, _58_resolveOnce__InternalBytecode_js_404, &s_function_info_table[58]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t2, 5);
+  locals.t2 = _sh_ljs_create_closure(shr, &locals.t0, _59_rejectionCheck__InternalBytecode_js_411, &s_function_info_table[59]);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t2, 6);
+  locals.t2 = _sh_ljs_get_env(shr, frame, 1);
+  frame[4] = _sh_ljs_load_from_env(locals.t2, 22);
+  locals.t4 = _sh_ljs_get_env(shr, frame, 0);
+  frame[2] = _sh_ljs_load_from_env(locals.t4, 0);
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_call(shr, frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t3, 2);
+  np1 = _sh_ljs_bool(false);
+  _sh_ljs_store_to_env(shr, locals.t0,np1, 3);
+  locals.t4 = _sh_ljs_new_array(shr, 0);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t4, 4);
+  locals.t5 = _sh_ljs_get_by_id_rjs(shr,&locals.t3,s_symbols[46], s_prop_cache + 212);
+  np1 = _sh_ljs_double(0);
+  if(_sh_ljs_strict_equal(locals.t5, np1)) goto L2;
+  goto L1;
+
+L1:
+  ;
+  frame[4] = _sh_ljs_get_by_id_rjs(shr,&locals.t3,s_symbols[63], s_prop_cache + 213);
+  frame[2] = _sh_ljs_create_closure(shr, &locals.t0, _60__28___InternalBytecode_js_422, &s_function_info_table[60]);
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = locals.t3;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  goto L3;
+L2:
+  ;
+  frame[4] = _sh_ljs_load_from_env(locals.t2, 26);
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = _sh_ljs_double(0);
+  frame[2] = locals.t4;
+  frame[2] = _sh_ljs_call(shr, frame, 1);
+  frame[5] = _sh_ljs_undefined();
+  frame[4] = locals.t1;
+  frame[3] = _sh_ljs_undefined();
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  goto L3;
+L3:
+  ;
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:430:22
+static SHLegacyValue _52__24___InternalBytecode_js_430(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =4;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 1);
+  locals.t1 = _sh_ljs_param(frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 0);
+  locals.t1 = _sh_ljs_get_env(shr, frame, 1);
+  locals.t1 = _sh_ljs_load_from_env(locals.t1, 4);
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[6], s_prop_cache + 214);
+  locals.t3 = _sh_ljs_get_env(shr, frame, 0);
+  frame[4] = _sh_ljs_load_from_env(locals.t3, 0);
+  np0 = _sh_ljs_undefined();
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = _sh_ljs_undefined();
+  frame[2] = _sh_ljs_call(shr, frame, 0);
+  frame[5] = _sh_ljs_undefined();
+  frame[4] = locals.t2;
+  frame[3] = locals.t1;
+  locals.t1 = _sh_ljs_call(shr, frame, 1);
+  frame[4] = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[13], s_prop_cache + 215);
+  frame[2] = _sh_ljs_create_closure(shr, &locals.t0, _61__29___InternalBytecode_js_431, &s_function_info_table[61]);
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = locals.t1;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:434:8
+static SHLegacyValue _53__25___InternalBytecode_js_434(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =4;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 1);
+  locals.t1 = _sh_ljs_param(frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 0);
+  locals.t1 = _sh_ljs_get_env(shr, frame, 1);
+  locals.t1 = _sh_ljs_load_from_env(locals.t1, 4);
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[6], s_prop_cache + 216);
+  locals.t3 = _sh_ljs_get_env(shr, frame, 0);
+  frame[4] = _sh_ljs_load_from_env(locals.t3, 0);
+  np0 = _sh_ljs_undefined();
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = _sh_ljs_undefined();
+  frame[2] = _sh_ljs_call(shr, frame, 0);
+  frame[5] = _sh_ljs_undefined();
+  frame[4] = locals.t2;
+  frame[3] = locals.t1;
+  locals.t1 = _sh_ljs_call(shr, frame, 1);
+  frame[4] = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[13], s_prop_cache + 217);
+  frame[2] = _sh_ljs_create_closure(shr, &locals.t0, _62__30___InternalBytecode_js_435, &s_function_info_table[62]);
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = locals.t1;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:605:7
+static SHLegacyValue _54_step__InternalBytecode_js_605(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+    SHLegacyValue t4;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =5;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHJmpBuf jmpBuf0;
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 0);
+  // AllockStackInst
+  np0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  if(_sh_try(shr, &jmpBuf0) == 0) goto L1;
+  goto L5;
+
+L1:
+  ;
+  frame[5] = _sh_ljs_param(frame, 1);
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_call(shr, frame, 0);
+  goto L2;
+L2:
+  ;
+  _sh_end_try(shr, &jmpBuf0);
+  locals.t2 = locals.t1;
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[86], s_prop_cache + 218);
+  if(_sh_ljs_to_boolean(locals.t2)) goto L4;
+  goto L3;
+
+L3:
+  ;
+  locals.t2 = _sh_ljs_get_env(shr, frame, 2);
+  frame[5] = _sh_ljs_load_from_env(locals.t2, 1);
+  locals.t3 = locals.t1;
+  frame[3] = _sh_ljs_get_by_id_rjs(shr,&locals.t3,s_symbols[49], s_prop_cache + 219);
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_call(shr, frame, 1);
+  frame[5] = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[13], s_prop_cache + 220);
+  frame[3] = _sh_ljs_create_closure(shr, &locals.t0, _63__31___InternalBytecode_js_621, &s_function_info_table[63]);
+  frame[2] = _sh_ljs_create_closure(shr, &locals.t0, _64__32___InternalBytecode_js_626, &s_function_info_table[64]);
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = locals.t2;
+  locals.t0 = _sh_ljs_call(shr, frame, 2);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+
+L4:
+  ;
+  locals.t0 = _sh_ljs_get_env(shr, frame, 0);
+  frame[5] = _sh_ljs_load_from_env(locals.t0, 0);
+  locals.t1 = locals.t1;
+  frame[3] = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[49], s_prop_cache + 221);
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_undefined();
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+
+L5:
+  ;
+  frame[3] = _sh_catch(shr, (SHLocals*)&locals, frame, 12);
+  locals.t1 = _sh_ljs_get_env(shr, frame, 0);
+  frame[5] = _sh_ljs_load_from_env(locals.t1, 1);
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_undefined();
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:633:12
+static SHLegacyValue _55__26___InternalBytecode_js_633(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =2;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t0 = _sh_ljs_load_from_env(locals.t0, 2);
+  frame[4] = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[87], s_prop_cache + 222);
+  np0 = _sh_ljs_undefined();
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = locals.t0;
+  frame[2] = _sh_ljs_undefined();
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:308:7
+static SHLegacyValue _56_res__InternalBytecode_js_308(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+    SHLegacyValue t4;
+    SHLegacyValue t5;
+    SHLegacyValue t6;
+    SHLegacyValue t7;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =8;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  locals.t4 = _sh_ljs_undefined();
+  locals.t5 = _sh_ljs_undefined();
+  locals.t6 = _sh_ljs_undefined();
+  locals.t7 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 1);
+  locals.t1 = _sh_ljs_param(frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 0);
+  locals.t2 = _sh_ljs_param(frame, 2);
+  if(_sh_ljs_to_boolean(locals.t2)) goto L1;
+  goto L6;
+
+L1:
+  ;
+  locals.t3 = _sh_ljs_typeof(shr, &locals.t2);
+  locals.t4 = _sh_ljs_get_string(shr, s_symbols[29]);
+  if(_sh_ljs_strict_equal(locals.t3, locals.t4)) goto L3;
+  goto L2;
+
+L2:
+  ;
+  locals.t4 = _sh_ljs_get_string(shr, s_symbols[30]);
+  if(_sh_ljs_strict_equal(locals.t3, locals.t4)) goto L3;
+  goto L6;
+
+L3:
+  ;
+  locals.t3 = _sh_ljs_get_env(shr, frame, 2);
+  locals.t3 = _sh_ljs_load_from_env(locals.t3, 4);
+  np0 = _sh_ljs_instance_of_rjs(shr, &locals.t2, &locals.t3);
+  if(_sh_ljs_get_bool(np0)) goto L4;
+  goto L5;
+
+L4:
+  ;
+  locals.t4 = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[13], s_prop_cache + 223);
+  locals.t5 = _sh_ljs_get_by_id_rjs(shr,&locals.t3,s_symbols[12], s_prop_cache + 224);
+  locals.t5 = _sh_ljs_get_by_id_rjs(shr,&locals.t5,s_symbols[13], s_prop_cache + 225);
+  if(_sh_ljs_strict_equal(locals.t4, locals.t5)) goto L10;
+  goto L5;
+
+L5:
+  ;
+  locals.t4 = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[13], s_prop_cache + 226);
+  locals.t5 = _sh_ljs_typeof(shr, &locals.t4);
+  locals.t6 = _sh_ljs_get_string(shr, s_symbols[30]);
+  if(_sh_ljs_strict_equal(locals.t5, locals.t6)) goto L9;
+  goto L6;
+
+L6:
+  ;
+  locals.t5 = _sh_ljs_get_env(shr, frame, 1);
+  locals.t5 = _sh_ljs_load_from_env(locals.t5, 0);
+  _sh_ljs_put_by_val_strict_rjs(shr,&locals.t5, &locals.t1, &locals.t2);
+  locals.t6 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t7 = _sh_ljs_load_from_env(locals.t6, 2);
+  locals.t7 = _sh_ljs_dec_rjs(shr, &locals.t7);
+  _sh_ljs_store_to_env(shr, locals.t6,locals.t7, 2);
+  np0 = _sh_ljs_double(0);
+  if(_sh_ljs_strict_equal(locals.t7, np0)) goto L7;
+  goto L8;
+
+L7:
+  ;
+  frame[5] = _sh_ljs_load_from_env(locals.t6, 0);
+  np0 = _sh_ljs_undefined();
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_undefined();
+  frame[3] = locals.t5;
+  locals.t5 = _sh_ljs_call(shr, frame, 1);
+  goto L8;
+L8:
+  ;
+  np0 = _sh_ljs_undefined();
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+
+L9:
+  ;
+  frame[5] = _sh_ljs_get_by_id_rjs(shr,&locals.t4,s_symbols[7], s_prop_cache + 227);
+  np0 = _sh_ljs_undefined();
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = locals.t4;
+  frame[3] = locals.t2;
+  frame[3] = _sh_ljs_call(shr, frame, 1);
+  locals.t5 = _sh_ljs_get_by_id_rjs(shr,&locals.t3,s_symbols[12], s_prop_cache + 228);
+  locals.t5 = _sh_ljs_create_this(shr, &locals.t5, &locals.t3);
+  frame[6] = locals.t3;
+  frame[5] = locals.t3;
+  frame[4] = locals.t5;
+  locals.t3 = _sh_ljs_call(shr, frame, 1);
+  locals.t3 = _sh_ljs_is_object(locals.t3) ? locals.t3 : locals.t5;
+  frame[5] = _sh_ljs_get_by_id_rjs(shr,&locals.t3,s_symbols[13], s_prop_cache + 229);
+  locals.t5 = _sh_ljs_get_env(shr, frame, 0);
+  frame[2] = _sh_ljs_load_from_env(locals.t5, 1);
+  frame[3] = _sh_ljs_create_closure(shr, &locals.t0, _66__34___InternalBytecode_js_324, &s_function_info_table[66]);
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = locals.t3;
+  locals.t3 = _sh_ljs_call(shr, frame, 2);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+
+L10:
+  ;
+  locals.t3 = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[32], s_prop_cache + 230);
+  np0 = _sh_ljs_double(3);
+  locals.t4 = locals.t2;
+  locals.t2 = locals.t4;
+  if(_sh_ljs_strict_equal(locals.t3, np0)) goto L11;
+  goto L12;
+
+L11:
+  ;
+  // PhiInst
+  locals.t3 = _sh_ljs_get_by_id_rjs(shr,&locals.t4,s_symbols[33], s_prop_cache + 231);
+  locals.t5 = _sh_ljs_get_by_id_rjs(shr,&locals.t3,s_symbols[32], s_prop_cache + 232);
+  locals.t4 = locals.t3;
+  locals.t2 = locals.t4;
+  if(_sh_ljs_strict_equal(locals.t5, np0)) goto L11;
+  goto L12;
+
+L12:
+  ;
+  // PhiInst
+  locals.t3 = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[32], s_prop_cache + 233);
+  np0 = _sh_ljs_double(1);
+  if(_sh_ljs_strict_equal(locals.t3, np0)) goto L16;
+  goto L13;
+
+L13:
+  ;
+  locals.t3 = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[32], s_prop_cache + 234);
+  np0 = _sh_ljs_double(2);
+  if(_sh_ljs_strict_equal(locals.t3, np0)) goto L14;
+  goto L15;
+
+L14:
+  ;
+  locals.t3 = _sh_ljs_get_env(shr, frame, 0);
+  frame[5] = _sh_ljs_load_from_env(locals.t3, 1);
+  frame[3] = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[33], s_prop_cache + 235);
+  np0 = _sh_ljs_undefined();
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_call(shr, frame, 1);
+  goto L15;
+L15:
+  ;
+  frame[5] = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[13], s_prop_cache + 236);
+  locals.t4 = _sh_ljs_get_env(shr, frame, 0);
+  frame[2] = _sh_ljs_load_from_env(locals.t4, 1);
+  np0 = _sh_ljs_undefined();
+  frame[3] = _sh_ljs_create_closure(shr, &locals.t0, _65__33___InternalBytecode_js_316, &s_function_info_table[65]);
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = locals.t2;
+  locals.t0 = _sh_ljs_call(shr, frame, 2);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+
+L16:
+  ;
+  locals.t0 = _sh_ljs_get_env(shr, frame, 0);
+  frame[5] = _sh_ljs_load_from_env(locals.t0, 3);
+  frame[2] = _sh_ljs_get_by_id_rjs(shr,&locals.t2,s_symbols[33], s_prop_cache + 237);
+  np0 = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_double(0);
+  frame[6] = _sh_ljs_undefined();
+  frame[3] = locals.t1;
+  np0 = _sh_ljs_call(shr, frame, 2);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:373:39
+static SHLegacyValue _57__27___InternalBytecode_js_373(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =4;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_get_env(shr, frame, 2);
+  locals.t0 = _sh_ljs_load_from_env(locals.t0, 4);
+  frame[5] = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[6], s_prop_cache + 238);
+  np0 = _sh_ljs_undefined();
+  frame[3] = _sh_ljs_param(frame, 1);
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = locals.t0;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  frame[5] = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[13], s_prop_cache + 239);
+  locals.t2 = _sh_ljs_get_env(shr, frame, 0);
+  frame[3] = _sh_ljs_load_from_env(locals.t2, 0);
+  frame[2] = _sh_ljs_load_from_env(locals.t2, 1);
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = locals.t0;
+  locals.t0 = _sh_ljs_call(shr, frame, 2);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:404:7
+static SHLegacyValue _58_resolveOnce__InternalBytecode_js_404(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =2;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_get_env(shr, frame, 0);
+  np0 = _sh_ljs_load_from_env(locals.t0, 3);
+  if(_sh_ljs_to_boolean(np0)) goto L2;
+  goto L1;
+
+L1:
+  ;
+  np0 = _sh_ljs_bool(true);
+  _sh_ljs_store_to_env(shr, locals.t0,np0, 3);
+  frame[4] = _sh_ljs_load_from_env(locals.t0, 0);
+  np0 = _sh_ljs_undefined();
+  frame[2] = _sh_ljs_param(frame, 1);
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = _sh_ljs_undefined();
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  goto L2;
+L2:
+  ;
+  np0 = _sh_ljs_undefined();
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:411:7
+static SHLegacyValue _59_rejectionCheck__InternalBytecode_js_411(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =4;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t1 = _sh_ljs_load_from_env(locals.t0, 4);
+  frame[4] = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[38], s_prop_cache + 240);
+  np0 = _sh_ljs_undefined();
+  frame[2] = _sh_ljs_param(frame, 1);
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = locals.t1;
+  locals.t2 = _sh_ljs_call(shr, frame, 1);
+  locals.t2 = _sh_ljs_get_by_id_rjs(shr,&locals.t1,s_symbols[46], s_prop_cache + 241);
+  locals.t3 = _sh_ljs_load_from_env(locals.t0, 2);
+  locals.t3 = _sh_ljs_get_by_id_rjs(shr,&locals.t3,s_symbols[46], s_prop_cache + 242);
+  if(_sh_ljs_strict_equal(locals.t2, locals.t3)) goto L1;
+  goto L2;
+
+L1:
+  ;
+  locals.t0 = _sh_ljs_load_from_env(locals.t0, 1);
+  locals.t2 = _sh_ljs_get_env(shr, frame, 2);
+  frame[4] = _sh_ljs_load_from_env(locals.t2, 26);
+  frame[3] = _sh_ljs_double(0);
+  frame[5] = _sh_ljs_undefined();
+  frame[2] = locals.t1;
+  frame[2] = _sh_ljs_call(shr, frame, 1);
+  frame[5] = _sh_ljs_undefined();
+  frame[4] = locals.t0;
+  frame[3] = _sh_ljs_undefined();
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  goto L2;
+L2:
+  ;
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:422:26
+static SHLegacyValue _60__28___InternalBytecode_js_422(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+    SHLegacyValue t3;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =4;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  locals.t3 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_get_env(shr, frame, 2);
+  locals.t0 = _sh_ljs_load_from_env(locals.t0, 4);
+  frame[5] = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[6], s_prop_cache + 243);
+  np0 = _sh_ljs_undefined();
+  frame[3] = _sh_ljs_param(frame, 1);
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = locals.t0;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  frame[5] = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[13], s_prop_cache + 244);
+  locals.t2 = _sh_ljs_get_env(shr, frame, 0);
+  frame[3] = _sh_ljs_load_from_env(locals.t2, 5);
+  frame[2] = _sh_ljs_load_from_env(locals.t2, 6);
+  frame[6] = _sh_ljs_undefined();
+  frame[4] = locals.t0;
+  locals.t0 = _sh_ljs_call(shr, frame, 2);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:431:37
+static SHLegacyValue _61__29___InternalBytecode_js_431(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 2);
+  locals.head.count =1;
+  locals.t0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t0 = _sh_ljs_load_from_env(locals.t0, 0);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:435:37
+static SHLegacyValue _62__30___InternalBytecode_js_435(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 2);
+  locals.head.count =1;
+  locals.t0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_get_env(shr, frame, 0);
+  locals.t0 = _sh_ljs_load_from_env(locals.t0, 0);
+  _sh_throw(shr, locals.t0);
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:621:11
+static SHLegacyValue _63__31___InternalBytecode_js_621(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =2;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 1);
+  locals.t1 = _sh_ljs_param(frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 0);
+  locals.t1 = _sh_ljs_get_env(shr, frame, 1);
+  frame[4] = _sh_ljs_load_from_env(locals.t1, 3);
+  np0 = _sh_ljs_undefined();
+  frame[3] = _sh_ljs_double(0);
+  frame[2] = _sh_ljs_create_closure(shr, &locals.t0, _67__35___InternalBytecode_js_622, &s_function_info_table[67]);
+  frame[5] = _sh_ljs_undefined();
+  np1 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:626:11
+static SHLegacyValue _64__32___InternalBytecode_js_626(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =2;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+
+L0:
+  ;
+  _sh_ljs_create_environment(shr, frame, &locals.t0, 1);
+  locals.t1 = _sh_ljs_param(frame, 1);
+  _sh_ljs_store_to_env(shr, locals.t0,locals.t1, 0);
+  locals.t1 = _sh_ljs_get_env(shr, frame, 1);
+  frame[4] = _sh_ljs_load_from_env(locals.t1, 3);
+  np0 = _sh_ljs_undefined();
+  frame[3] = _sh_ljs_double(0);
+  frame[2] = _sh_ljs_create_closure(shr, &locals.t0, _68__36___InternalBytecode_js_627, &s_function_info_table[68]);
+  frame[5] = _sh_ljs_undefined();
+  np1 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:316:22
+static SHLegacyValue _65__33___InternalBytecode_js_316(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =3;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_get_env(shr, frame, 1);
+  frame[5] = _sh_ljs_load_from_env(locals.t0, 3);
+  locals.t1 = _sh_ljs_get_env(shr, frame, 0);
+  frame[3] = _sh_ljs_load_from_env(locals.t1, 0);
+  np0 = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_double(0);
+  frame[2] = _sh_ljs_param(frame, 1);
+  frame[6] = _sh_ljs_undefined();
+  np1 = _sh_ljs_call(shr, frame, 2);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:324:22
+static SHLegacyValue _66__34___InternalBytecode_js_324(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 12);
+  locals.head.count =3;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+  SHLegacyValue np1 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_get_env(shr, frame, 1);
+  frame[5] = _sh_ljs_load_from_env(locals.t0, 3);
+  locals.t1 = _sh_ljs_get_env(shr, frame, 0);
+  frame[3] = _sh_ljs_load_from_env(locals.t1, 0);
+  np0 = _sh_ljs_undefined();
+  frame[4] = _sh_ljs_double(0);
+  frame[2] = _sh_ljs_param(frame, 1);
+  frame[6] = _sh_ljs_undefined();
+  np1 = _sh_ljs_call(shr, frame, 2);
+  _sh_leave(shr, &locals.head, frame);
+  return np0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:622:18
+static SHLegacyValue _67__35___InternalBytecode_js_622(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =3;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_get_env(shr, frame, 2);
+  locals.t0 = _sh_ljs_load_from_env(locals.t0, 2);
+  frame[4] = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[87], s_prop_cache + 245);
+  locals.t2 = _sh_ljs_get_env(shr, frame, 0);
+  frame[2] = _sh_ljs_load_from_env(locals.t2, 0);
+  np0 = _sh_ljs_undefined();
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = locals.t0;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+// /root/repo/_instr_build/lib/InternalJavaScript/InternalBytecode.js:627:18
+static SHLegacyValue _68__36___InternalBytecode_js_627(SHRuntime *shr) {
+  struct {
+    SHLocals head;
+    SHLegacyValue t0;
+    SHLegacyValue t1;
+    SHLegacyValue t2;
+  } locals;
+  _sh_check_native_stack_overflow(shr);
+  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 11);
+  locals.head.count =3;
+  locals.t0 = _sh_ljs_undefined();
+  locals.t1 = _sh_ljs_undefined();
+  locals.t2 = _sh_ljs_undefined();
+  SHLegacyValue np0 = _sh_ljs_undefined();
+
+L0:
+  ;
+  locals.t0 = _sh_ljs_get_env(shr, frame, 2);
+  locals.t0 = _sh_ljs_load_from_env(locals.t0, 2);
+  frame[4] = _sh_ljs_get_by_id_rjs(shr,&locals.t0,s_symbols[88], s_prop_cache + 246);
+  locals.t2 = _sh_ljs_get_env(shr, frame, 0);
+  frame[2] = _sh_ljs_load_from_env(locals.t2, 0);
+  np0 = _sh_ljs_undefined();
+  frame[5] = _sh_ljs_undefined();
+  frame[3] = locals.t0;
+  locals.t0 = _sh_ljs_call(shr, frame, 1);
+  _sh_leave(shr, &locals.head, frame);
+  return locals.t0;
+}
+static unsigned char s_obj_key_buffer[0] = {};
+static unsigned char s_obj_val_buffer[0] = {};
+static unsigned char s_array_buffer[0] = {};
+static SHCompressedPointer s_object_literal_class_cache[0];
+static SHObjectLiteralKeyInfo s_object_literal_key_info[0] = {};
+
+static const SHSrcLoc s_source_locations[] = {
+  { .filename_idx = 0, .line = 0, .column = 0 },
+};
+
+static SHNativeFuncInfo s_function_info_table[] = {
+  { .unit = &THIS_UNIT, .name_index = 89, .arg_count = 0 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 0 },
+  { .unit = &THIS_UNIT, .name_index = 90, .arg_count = 0 },
+  { .unit = &THIS_UNIT, .name_index = 91, .arg_count = 0 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 0 },
+  { .unit = &THIS_UNIT, .name_index = 92, .arg_count = 3 },
+  { .unit = &THIS_UNIT, .name_index = 93, .arg_count = 0 },
+  { .unit = &THIS_UNIT, .name_index = 5, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 94, .arg_count = 3 },
+  { .unit = &THIS_UNIT, .name_index = 95, .arg_count = 2 },
+  { .unit = &THIS_UNIT, .name_index = 96, .arg_count = 2 },
+  { .unit = &THIS_UNIT, .name_index = 97, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 6, .arg_count = 2 },
+  { .unit = &THIS_UNIT, .name_index = 16, .arg_count = 2 },
+  { .unit = &THIS_UNIT, .name_index = 98, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 99, .arg_count = 3 },
+  { .unit = &THIS_UNIT, .name_index = 100, .arg_count = 2 },
+  { .unit = &THIS_UNIT, .name_index = 101, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 102, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 103, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 104, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 105, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 24, .arg_count = 0 },
+  { .unit = &THIS_UNIT, .name_index = 25, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 106, .arg_count = 2 },
+  { .unit = &THIS_UNIT, .name_index = 107, .arg_count = 2 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 2 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 108, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 109, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 2 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 2 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 0 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 75, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 2 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 2 },
+  { .unit = &THIS_UNIT, .name_index = 108, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 2 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 2 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 2 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 2 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 110, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 0 },
+  { .unit = &THIS_UNIT, .name_index = 111, .arg_count = 2 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 112, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 113, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 0 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 0 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 1 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 0 },
+  { .unit = &THIS_UNIT, .name_index = 0, .arg_count = 0 },
+};
+static const char s_ascii_pool[] = {
+  '\0',
+  'H', 'e', 'r', 'm', 'e', 's', 'I', 'n', 't', 'e', 'r', 'n', 'a', 'l', '\0',
+  'h', 'a', 's', 'P', 'r', 'o', 'm', 'i', 's', 'e', '\0',
+  's', 'p', 'a', 'w', 'n', 'A', 's', 'y', 'n', 'c', '\0',
+  'g', 'l', 'o', 'b', 'a', 'l', 'T', 'h', 'i', 's', '\0',
+  'P', 'r', 'o', 'm', 'i', 's', 'e', '\0',
+  'r', 'e', 's', 'o', 'l', 'v', 'e', '\0',
+  'b', 'i', 'n', 'd', '\0',
+  'u', 's', 'e', 'E', 'n', 'g', 'i', 'n', 'e', 'Q', 'u', 'e', 'u', 'e', '\0',
+  '_', 'l', '\0',
+  '_', 'm', '\0',
+  '_', 'n', '\0',
+  'p', 'r', 'o', 't', 'o', 't', 'y', 'p', 'e', '\0',
+  't', 'h', 'e', 'n', '\0',
+  'a', 'l', 'l', '\0',
+  'a', 'l', 'l', 'S', 'e', 't', 't', 'l', 'e', 'd', '\0',
+  'r', 'e', 'j', 'e', 'c', 't', '\0',
+  'r', 'a', 'c', 'e', '\0',
+  'c', 'a', 't', 'c', 'h', '\0',
+  'a', 'n', 'y', '\0',
+  'f', 'i', 'n', 'a', 'l', 'l', 'y', '\0',
+  'R', 'e', 'f', 'e', 'r', 'e', 'n', 'c', 'e', 'E', 'r', 'r', 'o', 'r', '\0',
+  'T', 'y', 'p', 'e', 'E', 'r', 'r', 'o', 'r', '\0',
+  'R', 'a', 'n', 'g', 'e', 'E', 'r', 'r', 'o', 'r', '\0',
+  'd', 'i', 's', 'a', 'b', 'l', 'e', '\0',
+  'e', 'n', 'a', 'b', 'l', 'e', '\0',
+  's', 'e', 't', 'P', 'r', 'o', 'm', 'i', 's', 'e', 'R', 'e', 'j', 'e', 'c', 't', 'i', 'o', 'n', 'T', 'r', 'a', 'c', 'k', 'i', 'n', 'g', 'H', 'o', 'o', 'k', '\0',
+  'E', 'r', 'r', 'o', 'r', '\0',
+  'a', 's', 'y', 'n', 'c', ' ', 'f', 'u', 'n', 'c', 't', 'i', 'o', 'n', ' ', 'c', 'a', 'n', 'n', 'o', 't', ' ', 'b', 'e', ' ', 'u', 's', 'e', 'd', ' ', 'w', 'i', 't', 'h', ' ', 'P', 'r', 'o', 'm', 'i', 's', 'e', ' ', 'd', 'i', 's', 'a', 'b', 'l', 'e', 'd', '.', ' ', 's', 'p', 'a', 'w', 'n', 'A', 's', 'y', 'n', 'c', ' ', 'n', 'o', 't', ' ', 'r', 'e', 'g', 'i', 's', 't', 'e', 'r', 'e', 'd', '.', '\0',
+  'o', 'b', 'j', 'e', 'c', 't', '\0',
+  'f', 'u', 'n', 'c', 't', 'i', 'o', 'n', '\0',
+  '_', 'h', '\0',
+  '_', 'i', '\0',
+  '_', 'j', '\0',
+  '_', 'k', '\0',
+  'P', 'r', 'o', 'm', 'i', 's', 'e', ' ', 'c', 'o', 'n', 's', 't', 'r', 'u', 'c', 't', 'o', 'r', '\x0027', 's', ' ', 'a', 'r', 'g', 'u', 'm', 'e', 'n', 't', ' ', 'i', 's', ' ', 'n', 'o', 't', ' ', 'a', ' ', 'f', 'u', 'n', 'c', 't', 'i', 'o', 'n', '\0',
+  'P', 'r', 'o', 'm', 'i', 's', 'e', 's', ' ', 'm', 'u', 's', 't', ' ', 'b', 'e', ' ', 'c', 'o', 'n', 's', 't', 'r', 'u', 'c', 't', 'e', 'd', ' ', 'v', 'i', 'a', ' ', 'n', 'e', 'w', '\0',
+  'c', 'o', 'n', 's', 't', 'r', 'u', 'c', 't', 'o', 'r', '\0',
+  'p', 'u', 's', 'h', '\0',
+  's', 'o', 'u', 'r', 'c', 'e', '\0',
+  's', 'e', 't', 'I', 'm', 'm', 'e', 'd', 'i', 'a', 't', 'e', '\0',
+  'e', 'n', 'q', 'u', 'e', 'u', 'e', 'J', 'o', 'b', '\0',
+  'o', 'n', 'R', 'e', 'j', 'e', 'c', 't', 'e', 'd', '\0',
+  'o', 'n', 'F', 'u', 'l', 'f', 'i', 'l', 'l', 'e', 'd', '\0',
+  'p', 'r', 'o', 'm', 'i', 's', 'e', '\0',
+  'A', ' ', 'p', 'r', 'o', 'm', 'i', 's', 'e', ' ', 'c', 'a', 'n', 'n', 'o', 't', ' ', 'b', 'e', ' ', 'r', 'e', 's', 'o', 'l', 'v', 'e', 'd', ' ', 'w', 'i', 't', 'h', ' ', 'i', 't', 's', 'e', 'l', 'f', '.', '\0',
+  'l', 'e', 'n', 'g', 't', 'h', '\0',
+  'f', 'u', 'l', 'f', 'i', 'l', 'l', 'e', 'd', '\0',
+  's', 't', 'a', 't', 'u', 's', '\0',
+  'v', 'a', 'l', 'u', 'e', '\0',
+  'r', 'e', 'j', 'e', 'c', 't', 'e', 'd', '\0',
+  'r', 'e', 'a', 's', 'o', 'n', '\0',
+  'A', 'g', 'g', 'r', 'e', 'g', 'a', 't', 'e', 'E', 'r', 'r', 'o', 'r', '\0',
+  'A', 'l', 'l', ' ', 'p', 'r', 'o', 'm', 'i', 's', 'e', 's', ' ', 'w', 'e', 'r', 'e', ' ', 'r', 'e', 'j', 'e', 'c', 't', 'e', 'd', '\0',
+  'n', 'a', 'm', 'e', '\0',
+  'e', 'r', 'r', 'o', 'r', 's', '\0',
+  'c', 'o', 'n', 's', 'o', 'l', 'e', '\0',
+  'w', 'a', 'r', 'n', '\0',
+  'P', 'o', 's', 's', 'i', 'b', 'l', 'e', ' ', 'U', 'n', 'h', 'a', 'n', 'd', 'l', 'e', 'd', ' ', 'P', 'r', 'o', 'm', 'i', 's', 'e', ' ', 'R', 'e', 'j', 'e', 'c', 't', 'i', 'o', 'n', ' ', '(', 'i', 'd', ':', ' ', '\0',
+  ')', ':', '\0',
+  's', 't', 'a', 'c', 'k', '\0',
+  's', 'p', 'l', 'i', 't', '\0',
+  '\x000A', '\0',
+  'f', 'o', 'r', 'E', 'a', 'c', 'h', '\0',
+  's', 'o', 'm', 'e', '\0',
+  'A', 'r', 'r', 'a', 'y', '\0',
+  'f', 'r', 'o', 'm', '\0',
+  's', 'l', 'i', 'c', 'e', '\0',
+  'c', 'a', 'l', 'l', '\0',
+  'm', 'a', 'p', '\0',
+  'a', 'p', 'p', 'l', 'y', '\0',
+  'a', 'l', 'l', 'R', 'e', 'j', 'e', 'c', 't', 'i', 'o', 'n', 's', '\0',
+  'e', 'r', 'r', 'o', 'r', '\0',
+  'w', 'h', 'i', 't', 'e', 'l', 'i', 's', 't', '\0',
+  'd', 'i', 's', 'p', 'l', 'a', 'y', 'I', 'd', '\0',
+  'o', 'n', 'U', 'n', 'h', 'a', 'n', 'd', 'l', 'e', 'd', '\0',
+  'l', 'o', 'g', 'g', 'e', 'd', '\0',
+  '_', 'o', '\0',
+  'c', 'l', 'e', 'a', 'r', 'T', 'i', 'm', 'e', 'o', 'u', 't', '\0',
+  't', 'i', 'm', 'e', 'o', 'u', 't', '\0',
+  'o', 'n', 'H', 'a', 'n', 'd', 'l', 'e', 'd', '\0',
+  'P', 'r', 'o', 'm', 'i', 's', 'e', ' ', 'R', 'e', 'j', 'e', 'c', 't', 'i', 'o', 'n', ' ', 'H', 'a', 'n', 'd', 'l', 'e', 'd', ' ', '(', 'i', 'd', ':', ' ', '\0',
+  ' ', ' ', 'T', 'h', 'i', 's', ' ', 'm', 'e', 'a', 'n', 's', ' ', 'y', 'o', 'u', ' ', 'c', 'a', 'n', ' ', 'i', 'g', 'n', 'o', 'r', 'e', ' ', 'a', 'n', 'y', ' ', 'p', 'r', 'e', 'v', 'i', 'o', 'u', 's', ' ', 'm', 'e', 's', 's', 'a', 'g', 'e', 's', ' ', 'o', 'f', ' ', 't', 'h', 'e', ' ', 'f', 'o', 'r', 'm', ' ', '"', 'P', 'o', 's', 's', 'i', 'b', 'l', 'e', ' ', 'U', 'n', 'h', 'a', 'n', 'd', 'l', 'e', 'd', ' ', 'P', 'r', 'o', 'm', 'i', 's', 'e', ' ', 'R', 'e', 'j', 'e', 'c', 't', 'i', 'o', 'n', '"', ' ', 'w', 'i', 't', 'h', ' ', 'i', 'd', ' ', '\0',
+  '.', '\0',
+  's', 'e', 't', 'T', 'i', 'm', 'e', 'o', 'u', 't', '\0',
+  ' ', ' ', '\0',
+  'd', 'o', 'n', 'e', '\0',
+  'n', 'e', 'x', 't', '\0',
+  't', 'h', 'r', 'o', 'w', '\0',
+  'g', 'l', 'o', 'b', 'a', 'l', '\0',
+  'i', 'n', 'i', 't', 'A', 's', 'y', 'n', 'c', 'F', 'n', '\0',
+  'i', 'n', 'i', 't', 'P', 'r', 'o', 'm', 'i', 's', 'e', '\0',
+  's', 'p', 'a', 'w', 'n', '\0',
+  'n', 'o', 'o', 'p', '\0',
+  's', 'a', 'f', 'e', 'T', 'h', 'e', 'n', '\0',
+  'h', 'a', 'n', 'd', 'l', 'e', '\0',
+  'h', 'a', 'n', 'd', 'l', 'e', 'R', 'e', 's', 'o', 'l', 'v', 'e', 'd', '\0',
+  'r', 'u', 'n', 'R', 'e', 'a', 'c', 't', 'i', 'o', 'n', '\0',
+  'f', 'i', 'n', 'a', 'l', 'e', '\0',
+  'H', 'a', 'n', 'd', 'l', 'e', 'r', '\0',
+  'd', 'o', 'R', 'e', 's', 'o', 'l', 'v', 'e', '\0',
+  'v', 'a', 'l', 'u', 'e', 'P', 'r', 'o', 'm', 'i', 's', 'e', '\0',
+  'o', 'n', 'S', 'e', 't', 't', 'l', 'e', 'd', 'F', 'u', 'l', 'f', 'i', 'l', 'l', '\0',
+  'o', 'n', 'S', 'e', 't', 't', 'l', 'e', 'd', 'R', 'e', 'j', 'e', 'c', 't', '\0',
+  'm', 'a', 'p', 'A', 'l', 'l', 'S', 'e', 't', 't', 'l', 'e', 'd', '\0',
+  'g', 'e', 't', 'A', 'g', 'g', 'r', 'e', 'g', 'a', 't', 'e', 'E', 'r', 'r', 'o', 'r', '\0',
+  'l', 'o', 'g', 'E', 'r', 'r', 'o', 'r', '\0',
+  'm', 'a', 't', 'c', 'h', 'W', 'h', 'i', 't', 'e', 'l', 'i', 's', 't', '\0',
+  'i', 't', 'e', 'r', 'a', 'b', 'l', 'e', 'T', 'o', 'A', 'r', 'r', 'a', 'y', '\0',
+  'p', 'r', 'o', 'm', 'i', 's', 'e', 'A', 'n', 'y', '\0',
+  's', 't', 'e', 'p', '\0',
+  'r', 'e', 's', '\0',
+  'r', 'e', 's', 'o', 'l', 'v', 'e', 'O', 'n', 'c', 'e', '\0',
+  'r', 'e', 'j', 'e', 'c', 't', 'i', 'o', 'n', 'C', 'h', 'e', 'c', 'k', '\0',
+};
+static const char16_t s_u16_pool[] = {
+};
+static SHSymbolID s_symbols[114];
+static const uint32_t s_strings[] = {0,0,0,1,14,2243688185,16,10,4073797791,27,10,4035978515,38,10,4077459857,49,7,2634051974,57,7,2997109761,65,4,2278826651,70,14,3113447470,85,2,100550034,88,2,100548995,91,2,100552116,94,9,2155634493,104,4,1067223058,109,3,1484695221,113,10,3464973563,124,6,791754528,131,4,5337861,136,5,2349391986,142,3,1482649512,146,7,2244725219,154,14,1533351871,169,9,2467505850,179,10,2253555253,190,7,860131031,198,6,2482873441,205,31,4021023317,237,5,2432869328,243,79,942596125,323,6,343831328,330,8,126745432,339,2,100562270,342,2,100561231,345,2,100564336,348,2,100563297,351,48,4209146217,400,36,1383104753,437,11,2127663999,449,4,1059174534,454,6,3254391067,461,12,2212380668,474,10,1229246461,485,10,2854218314,496,11,1970132078,508,7,2284502330,516,41,894118662,558,6,363462486,565,9,944900463,575,6,137603819,582,5,3746588989,588,8,1953324483,597,6,2212311218,604,14,1728043389,619,26,1232416702,646,4,3891058614,651,6,928643800,658,7,1654270973,666,4,627472850,671,42,4167723518,714,2,43385656,717,5,2203018044,723,5,247753208,729,1,10410,731,7,706269937,739,4,3531571397,744,5,3111565995,750,4,3941611110,755,5,377550857,761,4,2730800004,766,3,1513730174,770,5,3820442164,776,13,1008305134,790,5,750956762,796,9,2487426948,806,9,1990918618,816,11,1104438444,828,6,2909871477,835,2,100551077,838,12,3511480930,851,7,3828983647,859,9,3808346256,869,31,1919300581,901,109,14529873,1011,1,47822,1013,10,1342918903,1024,2,33662025,1027,4,3042174909,1032,4,3324119240,1037,5,3780107318,1043,6,615793799,1050,11,1199894401,1062,11,3810581325,1074,5,3523850417,1080,4,4186823275,1085,8,1678072358,1094,6,597231068,1101,14,132622335,1116,11,2204695079,1128,6,2922793891,1135,7,907545636,1143,9,2400314425,1153,12,1758558674,1166,16,2220617400,1183,15,2048146879,1199,13,2109565706,1213,17,2291069085,1231,8,2197757500,1240,14,673655665,1255,15,3530880796,1271,10,590928304,1282,4,4180033303,1287,3,2146164540,1291,11,1555873742,1303,14,217923774,};
+static SHPropertyCacheEntry s_prop_cache[247];
+SHUnit THIS_UNIT = { .num_symbols = 114, .num_prop_cache_entries = 247, .ascii_pool = s_ascii_pool, .u16_pool = s_u16_pool,.strings = s_strings, .symbols = s_symbols, .prop_cache = s_prop_cache,.obj_key_buffer = s_obj_key_buffer, .obj_key_buffer_size = 0, .obj_val_buffer = s_obj_val_buffer, .obj_val_buffer_size = 0, .array_buffer = s_array_buffer, .array_buffer_size = 0, .object_literal_key_info = s_object_literal_key_info, .object_literal_class_cache = s_object_literal_class_cache, .num_object_literal_class_cache_entries = 0, .source_locations = s_source_locations, .source_locations_size = 1, .unit_main = _0_global, .unit_main_info = &s_function_info_table[0], .unit_name = "sh_compiled" };
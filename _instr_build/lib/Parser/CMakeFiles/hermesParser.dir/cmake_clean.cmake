@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesParser.a"
+  "libhermesParser.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesParser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
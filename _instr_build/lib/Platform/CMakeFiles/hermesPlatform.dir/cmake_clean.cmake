@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesPlatform.a"
+  "libhermesPlatform.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesPlatform.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesBCP47Parser.a"
+  "libhermesBCP47Parser.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesBCP47Parser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
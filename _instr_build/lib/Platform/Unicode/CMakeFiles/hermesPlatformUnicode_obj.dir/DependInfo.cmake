@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/Platform/Unicode/CharacterProperties.cpp" "lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode_obj.dir/CharacterProperties.cpp.o" "gcc" "lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode_obj.dir/CharacterProperties.cpp.o.d"
+  "/root/repo/lib/Platform/Unicode/PlatformUnicodeCF.cpp" "lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode_obj.dir/PlatformUnicodeCF.cpp.o" "gcc" "lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode_obj.dir/PlatformUnicodeCF.cpp.o.d"
+  "/root/repo/lib/Platform/Unicode/PlatformUnicodeEmscripten.cpp" "lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode_obj.dir/PlatformUnicodeEmscripten.cpp.o" "gcc" "lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode_obj.dir/PlatformUnicodeEmscripten.cpp.o.d"
+  "/root/repo/lib/Platform/Unicode/PlatformUnicodeICU.cpp" "lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode_obj.dir/PlatformUnicodeICU.cpp.o" "gcc" "lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode_obj.dir/PlatformUnicodeICU.cpp.o.d"
+  "/root/repo/lib/Platform/Unicode/PlatformUnicodeJava.cpp" "lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode_obj.dir/PlatformUnicodeJava.cpp.o" "gcc" "lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode_obj.dir/PlatformUnicodeJava.cpp.o.d"
+  "/root/repo/lib/Platform/Unicode/PlatformUnicodeLite.cpp" "lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode_obj.dir/PlatformUnicodeLite.cpp.o" "gcc" "lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode_obj.dir/PlatformUnicodeLite.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesPlatformUnicode_obj.dir/CharacterProperties.cpp.o"
+  "CMakeFiles/hermesPlatformUnicode_obj.dir/CharacterProperties.cpp.o.d"
+  "CMakeFiles/hermesPlatformUnicode_obj.dir/PlatformUnicodeCF.cpp.o"
+  "CMakeFiles/hermesPlatformUnicode_obj.dir/PlatformUnicodeCF.cpp.o.d"
+  "CMakeFiles/hermesPlatformUnicode_obj.dir/PlatformUnicodeEmscripten.cpp.o"
+  "CMakeFiles/hermesPlatformUnicode_obj.dir/PlatformUnicodeEmscripten.cpp.o.d"
+  "CMakeFiles/hermesPlatformUnicode_obj.dir/PlatformUnicodeICU.cpp.o"
+  "CMakeFiles/hermesPlatformUnicode_obj.dir/PlatformUnicodeICU.cpp.o.d"
+  "CMakeFiles/hermesPlatformUnicode_obj.dir/PlatformUnicodeJava.cpp.o"
+  "CMakeFiles/hermesPlatformUnicode_obj.dir/PlatformUnicodeJava.cpp.o.d"
+  "CMakeFiles/hermesPlatformUnicode_obj.dir/PlatformUnicodeLite.cpp.o"
+  "CMakeFiles/hermesPlatformUnicode_obj.dir/PlatformUnicodeLite.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesPlatformUnicode_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
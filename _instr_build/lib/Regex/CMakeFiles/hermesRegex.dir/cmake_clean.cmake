@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesRegex.a"
+  "libhermesRegex.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesRegex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
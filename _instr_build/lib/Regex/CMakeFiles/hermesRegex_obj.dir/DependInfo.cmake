@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/Regex/Executor.cpp" "lib/Regex/CMakeFiles/hermesRegex_obj.dir/Executor.cpp.o" "gcc" "lib/Regex/CMakeFiles/hermesRegex_obj.dir/Executor.cpp.o.d"
+  "/root/repo/lib/Regex/RegexParser.cpp" "lib/Regex/CMakeFiles/hermesRegex_obj.dir/RegexParser.cpp.o" "gcc" "lib/Regex/CMakeFiles/hermesRegex_obj.dir/RegexParser.cpp.o.d"
+  "/root/repo/lib/Regex/RegexSerialization.cpp" "lib/Regex/CMakeFiles/hermesRegex_obj.dir/RegexSerialization.cpp.o" "gcc" "lib/Regex/CMakeFiles/hermesRegex_obj.dir/RegexSerialization.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesSema.a"
+  "libhermesSema.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesSema.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesSupport.a"
+  "libhermesSupport.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesSupport.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
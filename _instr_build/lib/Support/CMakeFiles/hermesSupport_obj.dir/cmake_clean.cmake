@@ -0,0 +1,55 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesSupport_obj.dir/Allocator.cpp.o"
+  "CMakeFiles/hermesSupport_obj.dir/Allocator.cpp.o.d"
+  "CMakeFiles/hermesSupport_obj.dir/Base64.cpp.o"
+  "CMakeFiles/hermesSupport_obj.dir/Base64.cpp.o.d"
+  "CMakeFiles/hermesSupport_obj.dir/Base64vlq.cpp.o"
+  "CMakeFiles/hermesSupport_obj.dir/Base64vlq.cpp.o.d"
+  "CMakeFiles/hermesSupport_obj.dir/BigIntSupport.cpp.o"
+  "CMakeFiles/hermesSupport_obj.dir/BigIntSupport.cpp.o.d"
+  "CMakeFiles/hermesSupport_obj.dir/CheckedMalloc.cpp.o"
+  "CMakeFiles/hermesSupport_obj.dir/CheckedMalloc.cpp.o.d"
+  "CMakeFiles/hermesSupport_obj.dir/Conversions.cpp.o"
+  "CMakeFiles/hermesSupport_obj.dir/Conversions.cpp.o.d"
+  "CMakeFiles/hermesSupport_obj.dir/ErrorHandling.cpp.o"
+  "CMakeFiles/hermesSupport_obj.dir/ErrorHandling.cpp.o.d"
+  "CMakeFiles/hermesSupport_obj.dir/JSONEmitter.cpp.o"
+  "CMakeFiles/hermesSupport_obj.dir/JSONEmitter.cpp.o.d"
+  "CMakeFiles/hermesSupport_obj.dir/LEB128.cpp.o"
+  "CMakeFiles/hermesSupport_obj.dir/LEB128.cpp.o.d"
+  "CMakeFiles/hermesSupport_obj.dir/MemorySizeParser.cpp.o"
+  "CMakeFiles/hermesSupport_obj.dir/MemorySizeParser.cpp.o.d"
+  "CMakeFiles/hermesSupport_obj.dir/OSCompatEmscripten.cpp.o"
+  "CMakeFiles/hermesSupport_obj.dir/OSCompatEmscripten.cpp.o.d"
+  "CMakeFiles/hermesSupport_obj.dir/OSCompatPosix.cpp.o"
+  "CMakeFiles/hermesSupport_obj.dir/OSCompatPosix.cpp.o.d"
+  "CMakeFiles/hermesSupport_obj.dir/OSCompatWindows.cpp.o"
+  "CMakeFiles/hermesSupport_obj.dir/OSCompatWindows.cpp.o.d"
+  "CMakeFiles/hermesSupport_obj.dir/PageAccessTrackerPosix.cpp.o"
+  "CMakeFiles/hermesSupport_obj.dir/PageAccessTrackerPosix.cpp.o.d"
+  "CMakeFiles/hermesSupport_obj.dir/PerfSection.cpp.o"
+  "CMakeFiles/hermesSupport_obj.dir/PerfSection.cpp.o.d"
+  "CMakeFiles/hermesSupport_obj.dir/RandomSeedParser.cpp.o"
+  "CMakeFiles/hermesSupport_obj.dir/RandomSeedParser.cpp.o.d"
+  "CMakeFiles/hermesSupport_obj.dir/SHA1.cpp.o"
+  "CMakeFiles/hermesSupport_obj.dir/SHA1.cpp.o.d"
+  "CMakeFiles/hermesSupport_obj.dir/SNPrintfBuf.cpp.o"
+  "CMakeFiles/hermesSupport_obj.dir/SNPrintfBuf.cpp.o.d"
+  "CMakeFiles/hermesSupport_obj.dir/SemaphorePosix.cpp.o"
+  "CMakeFiles/hermesSupport_obj.dir/SemaphorePosix.cpp.o.d"
+  "CMakeFiles/hermesSupport_obj.dir/SimpleDiagHandler.cpp.o"
+  "CMakeFiles/hermesSupport_obj.dir/SimpleDiagHandler.cpp.o.d"
+  "CMakeFiles/hermesSupport_obj.dir/SourceErrorManager.cpp.o"
+  "CMakeFiles/hermesSupport_obj.dir/SourceErrorManager.cpp.o.d"
+  "CMakeFiles/hermesSupport_obj.dir/StringTable.cpp.o"
+  "CMakeFiles/hermesSupport_obj.dir/StringTable.cpp.o.d"
+  "CMakeFiles/hermesSupport_obj.dir/UTF16Stream.cpp.o"
+  "CMakeFiles/hermesSupport_obj.dir/UTF16Stream.cpp.o.d"
+  "CMakeFiles/hermesSupport_obj.dir/UTF8.cpp.o"
+  "CMakeFiles/hermesSupport_obj.dir/UTF8.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesSupport_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
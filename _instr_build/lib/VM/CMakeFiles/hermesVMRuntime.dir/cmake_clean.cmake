@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesVMRuntime.a"
+  "libhermesVMRuntime.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesVMRuntime.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
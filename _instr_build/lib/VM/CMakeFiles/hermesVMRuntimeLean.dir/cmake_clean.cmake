@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesVMRuntimeLean.a"
+  "libhermesVMRuntimeLean.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesVMRuntimeLean.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,265 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/ArrayStorage.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/ArrayStorage.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/BasicBlockExecutionInfo.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/BasicBlockExecutionInfo.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/BigIntPrimitive.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/BigIntPrimitive.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/BoxedDouble.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/BoxedDouble.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/BuildMetadata.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/BuildMetadata.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Callable.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Callable.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/CellKind.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/CellKind.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/CheckHeapWellFormedAcceptor.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/CheckHeapWellFormedAcceptor.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/CodeBlock.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/CodeBlock.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Debugger/Debugger.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Debugger/Debugger.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/DecoratedObject.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/DecoratedObject.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/DictPropertyMap.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/DictPropertyMap.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Domain.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Domain.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/DummyObject.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/DummyObject.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/FastArray.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/FastArray.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/GCBase.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/GCBase.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/HandleRootOwner.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/HandleRootOwner.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/HeapSnapshot.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/HeapSnapshot.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/HermesValue.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/HermesValue.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/HiddenClass.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/HiddenClass.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/HostModel.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/HostModel.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/IdentifierTable.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/IdentifierTable.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Interpreter-slowpaths.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Interpreter-slowpaths.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Interpreter.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Interpreter.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSArray.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSArray.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSArrayBuffer.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSArrayBuffer.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSCallSite.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSCallSite.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSCallableProxy.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSCallableProxy.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSDataView.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSDataView.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSDate.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSDate.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSError.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSError.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSGenerator.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSGenerator.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Array.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Array.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/ArrayBuffer.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/ArrayBuffer.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/ArrayIterator.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/ArrayIterator.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/AsyncFunction.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/AsyncFunction.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/BigInt.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/BigInt.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Boolean.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Boolean.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/CallSite.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/CallSite.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/DataView.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/DataView.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Date.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Date.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/DateCache.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/DateCache.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/DateUtil.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/DateUtil.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/DebuggerInternal.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/DebuggerInternal.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Error.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Error.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Function.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Function.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/GeneratorFunction.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/GeneratorFunction.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/GeneratorPrototype.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/GeneratorPrototype.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/GlobalObject.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/GlobalObject.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/HermesBuiltin.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/HermesBuiltin.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/HermesInternal.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/HermesInternal.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Intl.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Intl.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/IteratorPrototype.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/IteratorPrototype.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/JSLibInternal.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/JSLibInternal.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/JSON.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/JSON.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/JSONLexer.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/JSONLexer.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Map.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Map.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Math.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Math.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Number.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Number.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Object.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Object.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Proxy.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Proxy.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Reflect.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Reflect.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/RegExp.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/RegExp.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/RegExpStringIterator.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/RegExpStringIterator.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/RuntimeCommonStorage.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/RuntimeCommonStorage.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/RuntimeJSONUtils.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/RuntimeJSONUtils.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Set.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Set.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Sorting.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Sorting.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/String.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/String.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/StringIterator.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/StringIterator.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Symbol.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/Symbol.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/TypedArray.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/TypedArray.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/WeakMap.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/WeakMap.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/WeakRef.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/WeakRef.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/WeakSet.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/WeakSet.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/escape.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/escape.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/eval.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/eval.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/print.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/print.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/require.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSLib/require.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSMapImpl.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSMapImpl.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSNativeFunctions.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSNativeFunctions.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSObject.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSObject.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSProxy.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSProxy.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSRegExp.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSRegExp.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSRegExpStringIterator.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSRegExpStringIterator.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSTypedArray.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSTypedArray.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSWeakMapImpl.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSWeakMapImpl.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSWeakRef.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/JSWeakRef.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/LimitedStorageProvider.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/LimitedStorageProvider.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Metadata.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Metadata.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/NativeState.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/NativeState.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Operations.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Operations.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/OrderedHashMap.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/OrderedHashMap.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/PredefinedStringIDs.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/PredefinedStringIDs.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/PrimitiveBox.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/PrimitiveBox.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Profiler/ChromeTraceSerializer.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Profiler/ChromeTraceSerializer.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Profiler/CodeCoverageProfiler.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Profiler/CodeCoverageProfiler.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Profiler/InlineCacheProfiler.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Profiler/InlineCacheProfiler.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Profiler/SamplingProfiler.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Profiler/SamplingProfiler.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Profiler/SamplingProfilerPosix.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Profiler/SamplingProfilerPosix.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Profiler/SamplingProfilerSampler.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Profiler/SamplingProfilerSampler.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Profiler/SamplingProfilerWindows.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Profiler/SamplingProfilerWindows.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/PropertyAccessor.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/PropertyAccessor.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Runtime-profilers.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Runtime-profilers.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Runtime.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/Runtime.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/RuntimeFlags.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/RuntimeFlags.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/RuntimeModule.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/RuntimeModule.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/SegmentedArray.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/SegmentedArray.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/SerializedLiteralParser.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/SerializedLiteralParser.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/SingleObject.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/SingleObject.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/StackFrame.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/StackFrame.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/StackTracesTree.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/StackTracesTree.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/StaticH.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/StaticH.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/StaticHInit.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/StaticHInit.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/StaticHUnit.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/StaticHUnit.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/StorageProvider.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/StorageProvider.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/StringPrimitive.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/StringPrimitive.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/StringRefUtils.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/StringRefUtils.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/StringView.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/StringView.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/SymbolRegistry.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/SymbolRegistry.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/TimeLimitMonitor.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/TimeLimitMonitor.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/TwineChar16.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/TwineChar16.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/VTable.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/VTable.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/detail/IdentifierHashTable.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/detail/IdentifierHashTable.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/gcs/AlignedHeapSegment.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/gcs/AlignedHeapSegment.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/gcs/AlignedStorage.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/gcs/AlignedStorage.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/gcs/CardTableNC.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/gcs/CardTableNC.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/gcs/FillerCell.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/gcs/FillerCell.cpp.o.d"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/gcs/HadesGC.cpp.o"
+  "CMakeFiles/hermesVMRuntimeLean_obj.dir/gcs/HadesGC.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesVMRuntimeLean_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
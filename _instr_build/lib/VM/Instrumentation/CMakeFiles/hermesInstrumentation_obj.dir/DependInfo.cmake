@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/VM/Instrumentation/PerfEventsLinux.cpp" "lib/VM/Instrumentation/CMakeFiles/hermesInstrumentation_obj.dir/PerfEventsLinux.cpp.o" "gcc" "lib/VM/Instrumentation/CMakeFiles/hermesInstrumentation_obj.dir/PerfEventsLinux.cpp.o.d"
+  "/root/repo/lib/VM/Instrumentation/ProcessStats.cpp" "lib/VM/Instrumentation/CMakeFiles/hermesInstrumentation_obj.dir/ProcessStats.cpp.o" "gcc" "lib/VM/Instrumentation/CMakeFiles/hermesInstrumentation_obj.dir/ProcessStats.cpp.o.d"
+  "/root/repo/lib/VM/Instrumentation/StatSamplingThread.cpp" "lib/VM/Instrumentation/CMakeFiles/hermesInstrumentation_obj.dir/StatSamplingThread.cpp.o" "gcc" "lib/VM/Instrumentation/CMakeFiles/hermesInstrumentation_obj.dir/StatSamplingThread.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesPublic_obj.dir/rtti.cpp.o"
+  "CMakeFiles/hermesPublic_obj.dir/rtti.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesPublic_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
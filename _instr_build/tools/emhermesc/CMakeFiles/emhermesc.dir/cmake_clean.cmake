@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/emhermesc"
+  "../../bin/emhermesc.pdb"
+  "CMakeFiles/emhermesc.dir/emhermesc.cpp.o"
+  "CMakeFiles/emhermesc.dir/emhermesc.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/emhermesc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/hbcdump"
+  "../../bin/hbcdump.pdb"
+  "CMakeFiles/hbcdump.dir/HBCParser.cpp.o"
+  "CMakeFiles/hbcdump.dir/HBCParser.cpp.o.d"
+  "CMakeFiles/hbcdump.dir/ProfileAnalyzer.cpp.o"
+  "CMakeFiles/hbcdump.dir/ProfileAnalyzer.cpp.o.d"
+  "CMakeFiles/hbcdump.dir/hbcdump.cpp.o"
+  "CMakeFiles/hbcdump.dir/hbcdump.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hbcdump.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tools/hermes/hermes.cpp" "tools/hermes/CMakeFiles/hermes.dir/hermes.cpp.o" "gcc" "tools/hermes/CMakeFiles/hermes.dir/hermes.cpp.o.d"
+  "/root/repo/tools/hermes/repl.cpp" "tools/hermes/CMakeFiles/hermes.dir/repl.cpp.o" "gcc" "tools/hermes/CMakeFiles/hermes.dir/repl.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_instr_build/lib/CMakeFiles/hermesvm_a.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/jsi/CMakeFiles/jsi.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/hermesc"
+  "../../bin/hermesc.pdb"
+  "CMakeFiles/hermesc.dir/hermesc.cpp.o"
+  "CMakeFiles/hermesc.dir/hermesc.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/lexer-bench"
+  "../../bin/lexer-bench.pdb"
+  "CMakeFiles/lexer-bench.dir/lexer-bench.cpp.o"
+  "CMakeFiles/lexer-bench.dir/lexer-bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lexer-bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sh_api_use.dir/sh_api_use.c.o"
+  "CMakeFiles/sh_api_use.dir/sh_api_use.c.o.d"
+  "sh_api_use"
+  "sh_api_use.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sh_api_use.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sh_debug_skel.dir/sh_debug_skel.c.o"
+  "CMakeFiles/sh_debug_skel.dir/sh_debug_skel.c.o.d"
+  "sh_debug_skel"
+  "sh_debug_skel.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sh_debug_skel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tools/shermes/compile.cpp" "tools/shermes/CMakeFiles/shermes.dir/compile.cpp.o" "gcc" "tools/shermes/CMakeFiles/shermes.dir/compile.cpp.o.d"
+  "/root/repo/tools/shermes/shermes.cpp" "tools/shermes/CMakeFiles/shermes.dir/shermes.cpp.o" "gcc" "tools/shermes/CMakeFiles/shermes.dir/shermes.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_instr_build/lib/CMakeFiles/hermescompiler.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
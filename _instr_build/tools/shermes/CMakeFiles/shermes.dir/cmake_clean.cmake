@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/shermes"
+  "../../bin/shermes.pdb"
+  "CMakeFiles/shermes.dir/compile.cpp.o"
+  "CMakeFiles/shermes.dir/compile.cpp.o.d"
+  "CMakeFiles/shermes.dir/shermes.cpp.o"
+  "CMakeFiles/shermes.dir/shermes.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shermes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
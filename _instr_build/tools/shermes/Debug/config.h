@@ -0,0 +1,2 @@
+#define SHERMES_CC_INCLUDE_PATH       R"(/root/repo/_instr_build/lib/config:/root/repo/include)"
+#define SHERMES_CC_LIB_PATH           R"(/root/repo/_instr_build/lib)"
\ No newline at end of file
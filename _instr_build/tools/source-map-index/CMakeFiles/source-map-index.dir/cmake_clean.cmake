@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/source-map-index"
+  "../../bin/source-map-index.pdb"
+  "CMakeFiles/source-map-index.dir/source-map-index.cpp.o"
+  "CMakeFiles/source-map-index.dir/source-map-index.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/source-map-index.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
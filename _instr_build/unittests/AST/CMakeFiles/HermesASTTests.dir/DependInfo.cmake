@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/unittests/AST/ESTreeTest.cpp" "unittests/AST/CMakeFiles/HermesASTTests.dir/ESTreeTest.cpp.o" "gcc" "unittests/AST/CMakeFiles/HermesASTTests.dir/ESTreeTest.cpp.o.d"
+  "/root/repo/unittests/AST/JSONTest.cpp" "unittests/AST/CMakeFiles/HermesASTTests.dir/JSONTest.cpp.o" "gcc" "unittests/AST/CMakeFiles/HermesASTTests.dir/JSONTest.cpp.o.d"
+  "/root/repo/unittests/AST/ResolverTest.cpp" "unittests/AST/CMakeFiles/HermesASTTests.dir/ResolverTest.cpp.o" "gcc" "unittests/AST/CMakeFiles/HermesASTTests.dir/ResolverTest.cpp.o.d"
+  "/root/repo/unittests/AST/VisitorTest.cpp" "unittests/AST/CMakeFiles/HermesASTTests.dir/VisitorTest.cpp.o" "gcc" "unittests/AST/CMakeFiles/HermesASTTests.dir/VisitorTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_instr_build/external/llvh/utils/unittest/UnitTestMain/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/external/llvh/utils/unittest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/external/llvh/lib/Support/CMakeFiles/LLVHSupport.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/lib/Parser/CMakeFiles/hermesParser.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/lib/AST/CMakeFiles/hermesAST.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/lib/Sema/CMakeFiles/hermesSema.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/lib/Support/CMakeFiles/hermesSupport.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/lib/Regex/CMakeFiles/hermesRegex.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/external/dtoa/CMakeFiles/dtoa.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/unittests/IR/AttributesTest.cpp" "unittests/IR/CMakeFiles/HermesIRTests.dir/AttributesTest.cpp.o" "gcc" "unittests/IR/CMakeFiles/HermesIRTests.dir/AttributesTest.cpp.o.d"
+  "/root/repo/unittests/IR/BasicBlockTest.cpp" "unittests/IR/CMakeFiles/HermesIRTests.dir/BasicBlockTest.cpp.o" "gcc" "unittests/IR/CMakeFiles/HermesIRTests.dir/BasicBlockTest.cpp.o.d"
+  "/root/repo/unittests/IR/BuilderTest.cpp" "unittests/IR/CMakeFiles/HermesIRTests.dir/BuilderTest.cpp.o" "gcc" "unittests/IR/CMakeFiles/HermesIRTests.dir/BuilderTest.cpp.o.d"
+  "/root/repo/unittests/IR/IRUtilsTest.cpp" "unittests/IR/CMakeFiles/HermesIRTests.dir/IRUtilsTest.cpp.o" "gcc" "unittests/IR/CMakeFiles/HermesIRTests.dir/IRUtilsTest.cpp.o.d"
+  "/root/repo/unittests/IR/IRVerifierTest.cpp" "unittests/IR/CMakeFiles/HermesIRTests.dir/IRVerifierTest.cpp.o" "gcc" "unittests/IR/CMakeFiles/HermesIRTests.dir/IRVerifierTest.cpp.o.d"
+  "/root/repo/unittests/IR/InstrTest.cpp" "unittests/IR/CMakeFiles/HermesIRTests.dir/InstrTest.cpp.o" "gcc" "unittests/IR/CMakeFiles/HermesIRTests.dir/InstrTest.cpp.o.d"
+  "/root/repo/unittests/IR/LoopAnalysisTest.cpp" "unittests/IR/CMakeFiles/HermesIRTests.dir/LoopAnalysisTest.cpp.o" "gcc" "unittests/IR/CMakeFiles/HermesIRTests.dir/LoopAnalysisTest.cpp.o.d"
+  "/root/repo/unittests/IR/ScopeAnalysisTest.cpp" "unittests/IR/CMakeFiles/HermesIRTests.dir/ScopeAnalysisTest.cpp.o" "gcc" "unittests/IR/CMakeFiles/HermesIRTests.dir/ScopeAnalysisTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_instr_build/external/llvh/utils/unittest/UnitTestMain/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/external/llvh/utils/unittest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/external/llvh/lib/Support/CMakeFiles/LLVHSupport.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/lib/CMakeFiles/hermesFrontend.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/lib/CMakeFiles/hermesOptimizer.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/lib/Parser/CMakeFiles/hermesParser.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/lib/Support/CMakeFiles/hermesSupport.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/external/dtoa/CMakeFiles/dtoa.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/lib/FrontEndDefs/CMakeFiles/hermesFrontEndDefs.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/lib/Sema/CMakeFiles/hermesSema.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/lib/AST/CMakeFiles/hermesAST.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/lib/Regex/CMakeFiles/hermesRegex.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/unittests/PlatformUnicode/CharacterPropertyTest.cpp" "unittests/PlatformUnicode/CMakeFiles/PlatformUnicodeTests.dir/CharacterPropertyTest.cpp.o" "gcc" "unittests/PlatformUnicode/CMakeFiles/PlatformUnicodeTests.dir/CharacterPropertyTest.cpp.o.d"
+  "/root/repo/unittests/PlatformUnicode/PlatformUnicodeTest.cpp" "unittests/PlatformUnicode/CMakeFiles/PlatformUnicodeTests.dir/PlatformUnicodeTest.cpp.o" "gcc" "unittests/PlatformUnicode/CMakeFiles/PlatformUnicodeTests.dir/PlatformUnicodeTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_instr_build/external/llvh/utils/unittest/UnitTestMain/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/external/llvh/utils/unittest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/external/llvh/lib/Support/CMakeFiles/LLVHSupport.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
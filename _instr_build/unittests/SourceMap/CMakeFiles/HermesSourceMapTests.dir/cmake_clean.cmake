@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HermesSourceMapTests.dir/SourceMapTest.cpp.o"
+  "CMakeFiles/HermesSourceMapTests.dir/SourceMapTest.cpp.o.d"
+  "HermesSourceMapTests"
+  "HermesSourceMapTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/HermesSourceMapTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,48 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/unittests/Support/Algorithms.cpp" "unittests/Support/CMakeFiles/HermesSupportTests.dir/Algorithms.cpp.o" "gcc" "unittests/Support/CMakeFiles/HermesSupportTests.dir/Algorithms.cpp.o.d"
+  "/root/repo/unittests/Support/AllocatorTest.cpp" "unittests/Support/CMakeFiles/HermesSupportTests.dir/AllocatorTest.cpp.o" "gcc" "unittests/Support/CMakeFiles/HermesSupportTests.dir/AllocatorTest.cpp.o.d"
+  "/root/repo/unittests/Support/Base64Test.cpp" "unittests/Support/CMakeFiles/HermesSupportTests.dir/Base64Test.cpp.o" "gcc" "unittests/Support/CMakeFiles/HermesSupportTests.dir/Base64Test.cpp.o.d"
+  "/root/repo/unittests/Support/BigIntSupportTest.cpp" "unittests/Support/CMakeFiles/HermesSupportTests.dir/BigIntSupportTest.cpp.o" "gcc" "unittests/Support/CMakeFiles/HermesSupportTests.dir/BigIntSupportTest.cpp.o.d"
+  "/root/repo/unittests/Support/CheckedMalloc.cpp" "unittests/Support/CMakeFiles/HermesSupportTests.dir/CheckedMalloc.cpp.o" "gcc" "unittests/Support/CMakeFiles/HermesSupportTests.dir/CheckedMalloc.cpp.o.d"
+  "/root/repo/unittests/Support/ConversionsTest.cpp" "unittests/Support/CMakeFiles/HermesSupportTests.dir/ConversionsTest.cpp.o" "gcc" "unittests/Support/CMakeFiles/HermesSupportTests.dir/ConversionsTest.cpp.o.d"
+  "/root/repo/unittests/Support/CtorConfigTest.cpp" "unittests/Support/CMakeFiles/HermesSupportTests.dir/CtorConfigTest.cpp.o" "gcc" "unittests/Support/CMakeFiles/HermesSupportTests.dir/CtorConfigTest.cpp.o.d"
+  "/root/repo/unittests/Support/HashStringTest.cpp" "unittests/Support/CMakeFiles/HermesSupportTests.dir/HashStringTest.cpp.o" "gcc" "unittests/Support/CMakeFiles/HermesSupportTests.dir/HashStringTest.cpp.o.d"
+  "/root/repo/unittests/Support/JSONEmitterTest.cpp" "unittests/Support/CMakeFiles/HermesSupportTests.dir/JSONEmitterTest.cpp.o" "gcc" "unittests/Support/CMakeFiles/HermesSupportTests.dir/JSONEmitterTest.cpp.o.d"
+  "/root/repo/unittests/Support/LEB128Test.cpp" "unittests/Support/CMakeFiles/HermesSupportTests.dir/LEB128Test.cpp.o" "gcc" "unittests/Support/CMakeFiles/HermesSupportTests.dir/LEB128Test.cpp.o.d"
+  "/root/repo/unittests/Support/OSCompatTest.cpp" "unittests/Support/CMakeFiles/HermesSupportTests.dir/OSCompatTest.cpp.o" "gcc" "unittests/Support/CMakeFiles/HermesSupportTests.dir/OSCompatTest.cpp.o.d"
+  "/root/repo/unittests/Support/OptValueTest.cpp" "unittests/Support/CMakeFiles/HermesSupportTests.dir/OptValueTest.cpp.o" "gcc" "unittests/Support/CMakeFiles/HermesSupportTests.dir/OptValueTest.cpp.o.d"
+  "/root/repo/unittests/Support/PageAccessTrackerTest.cpp" "unittests/Support/CMakeFiles/HermesSupportTests.dir/PageAccessTrackerTest.cpp.o" "gcc" "unittests/Support/CMakeFiles/HermesSupportTests.dir/PageAccessTrackerTest.cpp.o.d"
+  "/root/repo/unittests/Support/PlatformLoggingTest.cpp" "unittests/Support/CMakeFiles/HermesSupportTests.dir/PlatformLoggingTest.cpp.o" "gcc" "unittests/Support/CMakeFiles/HermesSupportTests.dir/PlatformLoggingTest.cpp.o.d"
+  "/root/repo/unittests/Support/RegexTest.cpp" "unittests/Support/CMakeFiles/HermesSupportTests.dir/RegexTest.cpp.o" "gcc" "unittests/Support/CMakeFiles/HermesSupportTests.dir/RegexTest.cpp.o.d"
+  "/root/repo/unittests/Support/SNPrintfBufTest.cpp" "unittests/Support/CMakeFiles/HermesSupportTests.dir/SNPrintfBufTest.cpp.o" "gcc" "unittests/Support/CMakeFiles/HermesSupportTests.dir/SNPrintfBufTest.cpp.o.d"
+  "/root/repo/unittests/Support/SourceErrorManagerTest.cpp" "unittests/Support/CMakeFiles/HermesSupportTests.dir/SourceErrorManagerTest.cpp.o" "gcc" "unittests/Support/CMakeFiles/HermesSupportTests.dir/SourceErrorManagerTest.cpp.o.d"
+  "/root/repo/unittests/Support/StatsAccumulatorTest.cpp" "unittests/Support/CMakeFiles/HermesSupportTests.dir/StatsAccumulatorTest.cpp.o" "gcc" "unittests/Support/CMakeFiles/HermesSupportTests.dir/StatsAccumulatorTest.cpp.o.d"
+  "/root/repo/unittests/Support/StringSetVectorTest.cpp" "unittests/Support/CMakeFiles/HermesSupportTests.dir/StringSetVectorTest.cpp.o" "gcc" "unittests/Support/CMakeFiles/HermesSupportTests.dir/StringSetVectorTest.cpp.o.d"
+  "/root/repo/unittests/Support/UnicodeTest.cpp" "unittests/Support/CMakeFiles/HermesSupportTests.dir/UnicodeTest.cpp.o" "gcc" "unittests/Support/CMakeFiles/HermesSupportTests.dir/UnicodeTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_instr_build/external/llvh/utils/unittest/UnitTestMain/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/external/llvh/utils/unittest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/external/llvh/lib/Support/CMakeFiles/LLVHSupport.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/lib/Platform/CMakeFiles/hermesPlatform.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/lib/Regex/CMakeFiles/hermesRegex.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/lib/Support/CMakeFiles/hermesSupport.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/public/hermes/Public/CMakeFiles/hermesPublic.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/external/dtoa/CMakeFiles/dtoa.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
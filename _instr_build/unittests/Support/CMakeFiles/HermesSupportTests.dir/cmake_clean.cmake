@@ -0,0 +1,49 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HermesSupportTests.dir/Algorithms.cpp.o"
+  "CMakeFiles/HermesSupportTests.dir/Algorithms.cpp.o.d"
+  "CMakeFiles/HermesSupportTests.dir/AllocatorTest.cpp.o"
+  "CMakeFiles/HermesSupportTests.dir/AllocatorTest.cpp.o.d"
+  "CMakeFiles/HermesSupportTests.dir/Base64Test.cpp.o"
+  "CMakeFiles/HermesSupportTests.dir/Base64Test.cpp.o.d"
+  "CMakeFiles/HermesSupportTests.dir/BigIntSupportTest.cpp.o"
+  "CMakeFiles/HermesSupportTests.dir/BigIntSupportTest.cpp.o.d"
+  "CMakeFiles/HermesSupportTests.dir/CheckedMalloc.cpp.o"
+  "CMakeFiles/HermesSupportTests.dir/CheckedMalloc.cpp.o.d"
+  "CMakeFiles/HermesSupportTests.dir/ConversionsTest.cpp.o"
+  "CMakeFiles/HermesSupportTests.dir/ConversionsTest.cpp.o.d"
+  "CMakeFiles/HermesSupportTests.dir/CtorConfigTest.cpp.o"
+  "CMakeFiles/HermesSupportTests.dir/CtorConfigTest.cpp.o.d"
+  "CMakeFiles/HermesSupportTests.dir/HashStringTest.cpp.o"
+  "CMakeFiles/HermesSupportTests.dir/HashStringTest.cpp.o.d"
+  "CMakeFiles/HermesSupportTests.dir/JSONEmitterTest.cpp.o"
+  "CMakeFiles/HermesSupportTests.dir/JSONEmitterTest.cpp.o.d"
+  "CMakeFiles/HermesSupportTests.dir/LEB128Test.cpp.o"
+  "CMakeFiles/HermesSupportTests.dir/LEB128Test.cpp.o.d"
+  "CMakeFiles/HermesSupportTests.dir/OSCompatTest.cpp.o"
+  "CMakeFiles/HermesSupportTests.dir/OSCompatTest.cpp.o.d"
+  "CMakeFiles/HermesSupportTests.dir/OptValueTest.cpp.o"
+  "CMakeFiles/HermesSupportTests.dir/OptValueTest.cpp.o.d"
+  "CMakeFiles/HermesSupportTests.dir/PageAccessTrackerTest.cpp.o"
+  "CMakeFiles/HermesSupportTests.dir/PageAccessTrackerTest.cpp.o.d"
+  "CMakeFiles/HermesSupportTests.dir/PlatformLoggingTest.cpp.o"
+  "CMakeFiles/HermesSupportTests.dir/PlatformLoggingTest.cpp.o.d"
+  "CMakeFiles/HermesSupportTests.dir/RegexTest.cpp.o"
+  "CMakeFiles/HermesSupportTests.dir/RegexTest.cpp.o.d"
+  "CMakeFiles/HermesSupportTests.dir/SNPrintfBufTest.cpp.o"
+  "CMakeFiles/HermesSupportTests.dir/SNPrintfBufTest.cpp.o.d"
+  "CMakeFiles/HermesSupportTests.dir/SourceErrorManagerTest.cpp.o"
+  "CMakeFiles/HermesSupportTests.dir/SourceErrorManagerTest.cpp.o.d"
+  "CMakeFiles/HermesSupportTests.dir/StatsAccumulatorTest.cpp.o"
+  "CMakeFiles/HermesSupportTests.dir/StatsAccumulatorTest.cpp.o.d"
+  "CMakeFiles/HermesSupportTests.dir/StringSetVectorTest.cpp.o"
+  "CMakeFiles/HermesSupportTests.dir/StringSetVectorTest.cpp.o.d"
+  "CMakeFiles/HermesSupportTests.dir/UnicodeTest.cpp.o"
+  "CMakeFiles/HermesSupportTests.dir/UnicodeTest.cpp.o.d"
+  "HermesSupportTests"
+  "HermesSupportTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/HermesSupportTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HermesInstrumentationTests.dir/ApproxIntegralTest.cpp.o"
+  "CMakeFiles/HermesInstrumentationTests.dir/ApproxIntegralTest.cpp.o.d"
+  "CMakeFiles/HermesInstrumentationTests.dir/ProcessStatsTest.cpp.o"
+  "CMakeFiles/HermesInstrumentationTests.dir/ProcessStatsTest.cpp.o.d"
+  "HermesInstrumentationTests"
+  "HermesInstrumentationTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/HermesInstrumentationTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -16,6 +16,9 @@
 
 #include "llvh/ADT/StringRef.h"
 
+#include <memory>
+#include <vector>
+
 namespace hermes {
 
 namespace irdumper {
@@ -23,6 +26,7 @@ class Namer;
 }
 
 class BackendContext;
+class ExecutionProfile;
 class NativeContext;
 struct NativeSettings;
 
@@ -210,6 +214,14 @@ class Context {
   /// Whether to parse TypeScript syntax.
   bool parseTS_{false};
 
+  /// The maximum number of threads used to parse a single large buffer. 1
+  /// disables parallel parsing.
+  unsigned parseJobs_{1};
+
+  /// Contexts owning AST nodes which were spliced into ASTs of this context,
+  /// for example by the parallel parser. They live as long as this context.
+  std::vector<std::unique_ptr<Context>> adoptedContexts_{};
+
   /// If non-null, the resolution table which resolves static require().
   const std::unique_ptr<ResolutionTable> resolutionTable_;
 
@@ -235,6 +247,9 @@ class Context {
   /// The separate native context. It is automatically created on construction.
   std::unique_ptr<NativeContext> nativeContext_;
 
+  /// Execution profile used to guide optimizations, if any.
+  std::shared_ptr<const ExecutionProfile> executionProfile_{};
+
   std::unique_ptr<irdumper::Namer> persistentIRNamer_{};
 
  public:
@@ -383,6 +398,19 @@ class Context {
     return parseTS_;
   }
 
+  void setParseJobs(unsigned parseJobs) {
+    parseJobs_ = parseJobs ? parseJobs : 1;
+  }
+  unsigned getParseJobs() const {
+    return parseJobs_;
+  }
+
+  /// Take ownership of \p other, keeping the AST nodes and strings allocated
+  /// in it alive for the lifetime of this context.
+  void adoptContext(std::unique_ptr<Context> other) {
+    adoptedContexts_.push_back(std::move(other));
+  }
+
   /// \return true if either TS or Flow is being parsed.
   bool getParseTypes() const {
     return getParseFlow() || getParseTS();
@@ -468,6 +496,16 @@ class Context {
     return *nativeContext_;
   }
 
+  /// \return the execution profile used to guide optimizations, or nullptr if
+  /// no profile was supplied.
+  const ExecutionProfile *getExecutionProfile() const {
+    return executionProfile_.get();
+  }
+
+  void setExecutionProfile(std::shared_ptr<const ExecutionProfile> profile) {
+    executionProfile_ = std::move(profile);
+  }
+
   /// Create and install a new persistent namer for IR dumps.
   void createPersistentIRNamer();
   /// Clear and destroy the persistent namer for IR dumps.
@@ -47,6 +47,8 @@ struct CompileFlags {
   bool includeLibHermes{true};
   /// Enable generators.
   bool enableGenerator{true};
+  /// Maximum number of threads used to parse a large source buffer.
+  unsigned parseJobs{1};
   /// Define the output format of the generated bytecode. For instance, whether
   /// the bytecode is intended for execution or serialisation.
   OutputFormatKind format{Execute};
@@ -20,7 +20,7 @@ namespace hbc {
 
 // Bytecode version generated by this version of the compiler.
 // Updated: Sep 19, 2022
-const static uint32_t BYTECODE_VERSION = 90;
+const static uint32_t BYTECODE_VERSION = 91;
 
 } // namespace hbc
 } // namespace hermes
@@ -53,10 +53,22 @@ class LowerLoadStoreFrameInst : public FunctionPass {
 // Lower uses of the JS `arguments` array into HBC*Arguments* instructions.
 class LowerArgumentsArray : public FunctionPass {
  private:
+  /// Whether `fn.apply(thisArg, arguments)` is lowered to
+  /// HBCApplyArgumentsInst, which the HBC backend does not support.
+  bool lowerApply_;
+
   CreateArgumentsInst *getCreateArgumentsInst(Function *F);
 
+  /// \return true if \p user is a call of the form
+  ///   `fn.apply(thisArg, arguments)`, where \p createArguments is only used
+  ///   as the last argument.
+  static bool isApplyWithArguments(
+      Value *user,
+      CreateArgumentsInst *createArguments);
+
  public:
-  explicit LowerArgumentsArray() : FunctionPass("LowerArgumentsArray") {}
+  explicit LowerArgumentsArray(bool lowerApply = false)
+      : FunctionPass("LowerArgumentsArray"), lowerApply_(lowerApply) {}
   ~LowerArgumentsArray() override = default;
   bool runOnFunction(Function *F) override;
 };
@@ -21,6 +21,17 @@ void generateSH(
     llvh::raw_ostream &OS,
     const BytecodeGenerationOptions &options);
 
+/// Like generateSH(), but splits the C into the translation units \p units,
+/// so they can be compiled in parallel. The declarations shared by all units
+/// are written to \p header, which every unit includes as \p headerName.
+/// The first unit also contains the module data and the main function.
+void generateSHSplit(
+    Module *M,
+    llvh::raw_ostream &header,
+    llvh::StringRef headerName,
+    llvh::ArrayRef<llvh::raw_ostream *> units,
+    const BytecodeGenerationOptions &options);
+
 } // namespace sh
 } // namespace hermes
 
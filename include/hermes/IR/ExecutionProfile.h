@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_IR_EXECUTIONPROFILE_H
+#define HERMES_IR_EXECUTIONPROFILE_H
+
+#include "hermes/IR/IR.h"
+#include "hermes/Support/SourceErrorManager.h"
+
+#include "llvh/Support/MemoryBuffer.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+
+namespace hermes {
+
+class BaseCallInst;
+
+/// Execution counts collected by running a program compiled with profiling
+/// instrumentation (see _sh_write_profile()). Functions and call sites are
+/// identified by their source coordinates, so the profile can be applied to a
+/// later compilation of the same source.
+///
+/// The JSON format is:
+/// \code
+/// {
+///   "version": 1,
+///   "startupPageFaults": {"minor", "major"},
+///   "functions": [ {"name", "file", "line", "column", "count", "order",
+///                   "startup"} ...],
+///   "callsites": [ {"name", "file", "line", "column", "count", "order",
+///                   "startup"} ...]
+/// }
+/// \endcode
+/// where "order" is the 1-based order in which the site was first executed,
+/// or 0 if it was never executed, and "startup" is true if the site first ran
+/// while the global code of its unit was executing. "startupPageFaults" and
+/// "startup" are optional.
+class ExecutionProfile {
+ public:
+  /// The profile data recorded for a single site.
+  struct Counts {
+    /// Number of times the site was executed.
+    uint64_t count = 0;
+    /// Order of first execution, or 0 if never executed.
+    uint64_t order = 0;
+    /// Whether the site first executed during startup.
+    bool startup = false;
+  };
+
+  /// The only supported version of the format.
+  static constexpr uint32_t kVersion = 1;
+
+  /// Call sites executed at least this many times may be hot.
+  static constexpr uint64_t kMinHotCount = 100;
+  /// Call sites are hot only if they executed at least 1/kHotCountDivisor
+  /// times as often as the hottest call site in the profile.
+  static constexpr uint64_t kHotCountDivisor = 100;
+
+  /// Parse a JSON profile from \p buf, reporting errors to \p sm, which
+  /// takes ownership of the buffer.
+  /// \return the profile, or nullptr on error.
+  static std::shared_ptr<ExecutionProfile> parse(
+      std::unique_ptr<llvh::MemoryBuffer> buf,
+      SourceErrorManager &sm);
+
+  /// \return the counts of function \p F, or nullptr if the profile has no
+  ///   data for it.
+  const Counts *getFunction(Function *F) const;
+
+  /// \return the counts of call \p CI, or nullptr if the profile has no data
+  ///   for it.
+  const Counts *getCallSite(BaseCallInst *CI) const;
+
+  /// \return true if \p counts is executed often enough to justify exceeding
+  ///   the static optimization budget.
+  bool isHot(const Counts &counts) const {
+    return counts.count >= hotThreshold_;
+  }
+
+  /// \return true if \p counts was never executed during profiling.
+  static bool isCold(const Counts &counts) {
+    return counts.count == 0;
+  }
+
+  /// \return true if \p counts first executed during startup.
+  static bool isStartup(const Counts &counts) {
+    return counts.startup;
+  }
+
+ private:
+  /// Sites are keyed by (file, line, column).
+  using Key = std::tuple<std::string, uint32_t, uint32_t>;
+  using SiteMap = std::map<Key, Counts>;
+
+  /// Profile data of function entries, keyed by the function start location.
+  SiteMap functions_{};
+  /// Profile data of call instructions, keyed by the call location.
+  SiteMap callSites_{};
+
+  /// Minimal execution count of a hot call site.
+  uint64_t hotThreshold_ = kMinHotCount;
+
+  /// Look up location \p loc of module \p M in \p map.
+  /// \return the counts or nullptr if not found.
+  static const Counts *
+  lookup(const SiteMap &map, Module *M, SMLoc loc);
+};
+
+} // namespace hermes
+
+#endif // HERMES_IR_EXECUTIONPROFILE_H
@@ -543,6 +543,12 @@ class IRBuilder {
       AllocStackInst *lazyReg);
   HBCReifyArgumentsStrictInst *createHBCReifyArgumentsStrictInst(
       AllocStackInst *lazyReg);
+  HBCApplyArgumentsInst *createHBCApplyArgumentsInst(
+      Value *callee,
+      Value *target,
+      Value *thisArg,
+      AllocStackInst *lazyReg,
+      bool isStrict);
 
   CreateThisInst *createCreateThisInst(Value *prototype, Value *closure);
 
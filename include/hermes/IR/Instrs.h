@@ -3617,6 +3617,70 @@ class HBCReifyArgumentsLooseInst : public HBCReifyArgumentsInst {
   }
 };
 
+/// `callee(target, thisArg, arguments)`, where `callee` was loaded from
+/// `target.apply`. If `callee` is Function.prototype.apply and the arguments
+/// object has not been created, calls `target` directly with the arguments of
+/// the current function. Otherwise, creates the arguments object in the lazy
+/// register and performs the call as written.
+class HBCApplyArgumentsInst : public Instruction {
+  HBCApplyArgumentsInst(const HBCApplyArgumentsInst &) = delete;
+  void operator=(const HBCApplyArgumentsInst &) = delete;
+
+ public:
+  enum { CalleeIdx, TargetIdx, ThisArgIdx, LazyRegisterIdx, IsStrictIdx };
+
+  explicit HBCApplyArgumentsInst(
+      Value *callee,
+      Value *target,
+      Value *thisArg,
+      AllocStackInst *reg,
+      LiteralBool *isStrict)
+      : Instruction(ValueKind::HBCApplyArgumentsInstKind) {
+    pushOperand(callee);
+    pushOperand(target);
+    pushOperand(thisArg);
+    pushOperand(reg);
+    pushOperand(isStrict);
+  }
+  explicit HBCApplyArgumentsInst(
+      const HBCApplyArgumentsInst *src,
+      llvh::ArrayRef<Value *> operands)
+      : Instruction(src, operands) {}
+
+  Value *getCallee() const {
+    return getOperand(CalleeIdx);
+  }
+  Value *getTarget() const {
+    return getOperand(TargetIdx);
+  }
+  Value *getThisArg() const {
+    return getOperand(ThisArgIdx);
+  }
+  Value *getLazyRegister() const {
+    return getOperand(LazyRegisterIdx);
+  }
+  /// \return true if the arguments object is created in strict mode.
+  bool getIsStrict() const {
+    return llvh::cast<LiteralBool>(getOperand(IsStrictIdx))->getValue();
+  }
+
+  static bool hasOutput() {
+    return true;
+  }
+  static bool isTyped() {
+    return false;
+  }
+
+  SideEffect getSideEffectImpl() const {
+    return SideEffect::createExecute().setReadStack().setWriteStack();
+  }
+
+  static bool classof(const Value *V) {
+    ValueKind kind = V->getKind();
+    return kind == ValueKind::HBCApplyArgumentsInstKind;
+  }
+};
+
 /// Create a 'this' object to be filled in by a constructor.
 class CreateThisInst : public Instruction {
   CreateThisInst(const CreateThisInst &) = delete;
@@ -499,6 +499,10 @@ class JSLexer {
     strictMode_ = strictMode;
   }
 
+  bool getStoreComments() const {
+    return storeComments_;
+  }
+
   void setStoreComments(bool storeComments) {
     storeComments_ = storeComments;
   }
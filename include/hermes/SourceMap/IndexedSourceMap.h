@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_SOURCEMAP_INDEXEDSOURCEMAP_H
+#define HERMES_SOURCEMAP_INDEXEDSOURCEMAP_H
+
+#include "hermes/SourceMap/SourceMap.h"
+
+#include "llvh/ADT/ArrayRef.h"
+#include "llvh/Support/Endian.h"
+#include "llvh/Support/MemoryBuffer.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace hermes {
+
+/// A compact binary index of a JavaScript version 3 source map, meant to be
+/// memory-mapped. Queries binary search the fixed-width segments of a single
+/// generated line, so only the pages of that line are touched and nothing is
+/// decoded up front.
+///
+/// All integers are little-endian and 4-byte aligned. The layout is:
+///   Header
+///   uint32 sourceOffsets[numSources + 1]
+///       Offsets of the full source paths in the string table. Path \c i is
+///       [sourceOffsets[i], sourceOffsets[i + 1]).
+///   uint32 nameOffsets[numNames + 1]
+///       Offsets of the symbol names in the string table, indexed by
+///       Segment::nameIndex.
+///   uint32 lineOffsets[numLines + 1]
+///       Index of the first segment of each generated line. The segments of
+///       line \c i are [lineOffsets[i], lineOffsets[i + 1]).
+///   Segment segments[numSegments]
+///       Sorted by generated column within a line.
+///   char strings[stringTableSize]
+class IndexedSourceMap {
+ public:
+  /// "HSMI" when read as little-endian.
+  static constexpr uint32_t kMagic = 0x494d5348;
+  static constexpr uint32_t kVersion = 1;
+  /// Stored in place of a missing source index or name index.
+  static constexpr int32_t kNone = -1;
+
+  struct Header {
+    llvh::support::aligned_ulittle32_t magic;
+    llvh::support::aligned_ulittle32_t version;
+    llvh::support::aligned_ulittle32_t numSources;
+    llvh::support::aligned_ulittle32_t numNames;
+    llvh::support::aligned_ulittle32_t numLines;
+    llvh::support::aligned_ulittle32_t numSegments;
+    llvh::support::aligned_ulittle32_t stringTableSize;
+  };
+
+  /// A decoded SourceMap::Segment. A segment without a represented location
+  /// has sourceIndex set to kNone.
+  struct Segment {
+    llvh::support::aligned_little32_t generatedColumn;
+    llvh::support::aligned_little32_t sourceIndex;
+    llvh::support::aligned_little32_t lineIndex;
+    llvh::support::aligned_little32_t columnIndex;
+    llvh::support::aligned_little32_t nameIndex;
+  };
+
+  /// Validate the header, the source table and the name table of \p buffer
+  /// and wrap it. The buffer is copied if it is not suitably aligned.
+  /// \return the index, or nullptr and an error message.
+  static std::pair<std::unique_ptr<IndexedSourceMap>, std::string> create(
+      std::unique_ptr<llvh::MemoryBuffer> buffer);
+
+  /// \return true if \p data starts with the magic number of an index.
+  static bool isIndexedSourceMap(llvh::StringRef data);
+
+  /// Serialize \p sourceMap to \p os in the index format.
+  static void write(const SourceMap &sourceMap, llvh::raw_ostream &os);
+
+  /// Query source map text location for \p line and \p column.
+  /// In both the input and output of this function, line and column numbers
+  /// are 1-based.
+  llvh::Optional<SourceMapTextLocation> getLocationForAddress(
+      uint32_t line,
+      uint32_t column) const;
+
+  /// Query source map text location for \p line and \p column.
+  /// In both the input and output of this function, line and column numbers
+  /// are 1-based.
+  llvh::Optional<SourceMapTextLocationFIndex> getLocationForAddressFIndex(
+      uint32_t line,
+      uint32_t column) const;
+
+  /// Query source map segment for \p line and \p column.
+  /// The line and column arguments are 1-based (but note that the return value
+  /// has 0-based line and column indices).
+  llvh::Optional<SourceMap::Segment> getSegmentForAddress(
+      uint32_t line,
+      uint32_t column) const;
+
+  /// \return the number of source paths.
+  uint32_t getNumSourcePaths() const {
+    return sourceOffsets_.size() - 1;
+  }
+
+  /// \return source file path with root combined for source \p index.
+  llvh::StringRef getSourceFullPath(uint32_t index) const {
+    assert(index < getNumSourcePaths() && "index out-of-range for sources");
+    return strings_.slice(sourceOffsets_[index], sourceOffsets_[index + 1]);
+  }
+
+  /// \return the number of symbol names.
+  uint32_t getNumNames() const {
+    return nameOffsets_.size() - 1;
+  }
+
+  /// \return the symbol name at \p index, as referenced by a segment's
+  /// nameIndex.
+  llvh::StringRef getName(uint32_t index) const {
+    assert(index < getNumNames() && "index out-of-range for names");
+    return strings_.slice(nameOffsets_[index], nameOffsets_[index + 1]);
+  }
+
+ private:
+  explicit IndexedSourceMap(std::unique_ptr<llvh::MemoryBuffer> buffer)
+      : buffer_(std::move(buffer)) {}
+
+  /// The mapped index.
+  std::unique_ptr<llvh::MemoryBuffer> buffer_;
+
+  llvh::ArrayRef<llvh::support::aligned_ulittle32_t> sourceOffsets_;
+  llvh::ArrayRef<llvh::support::aligned_ulittle32_t> nameOffsets_;
+  llvh::ArrayRef<llvh::support::aligned_ulittle32_t> lineOffsets_;
+  llvh::ArrayRef<Segment> segments_;
+  llvh::StringRef strings_;
+};
+
+} // namespace hermes
+
+#endif // HERMES_SOURCEMAP_INDEXEDSOURCEMAP_H
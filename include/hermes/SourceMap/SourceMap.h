@@ -107,11 +107,13 @@ class SourceMap {
       const std::string &sourceRoot,
       std::vector<std::string> &&sources,
       std::vector<SegmentList> &&lines,
-      MetadataList &&sourcesMetadata)
+      MetadataList &&sourcesMetadata,
+      std::vector<std::string> &&names = {})
       : sourceRoot_(sourceRoot),
         sources_(std::move(sources)),
         lines_(std::move(lines)),
-        sourcesMetadata_(std::move(sourcesMetadata)) {}
+        sourcesMetadata_(std::move(sourcesMetadata)),
+        names_(std::move(names)) {}
 
   /// Query source map text location for \p line and \p column.
   /// In both the input and output of this function, line and column numbers
@@ -165,6 +167,23 @@ class SourceMap {
     return sourcesMetadata_[index];
   }
 
+  /// \return the number of entries in the "names" list.
+  uint32_t getNumNames() const {
+    assert(names_.size() <= UINT32_MAX);
+    return (uint32_t)names_.size();
+  }
+
+  /// \return the symbol name at \p index in the "names" list.
+  const std::string &getName(uint32_t index) const {
+    assert(index < names_.size() && "index out-of-range for names_");
+    return names_[index];
+  }
+
+  /// \return the decoded segments of every generated line.
+  const std::vector<SegmentList> &getLines() const {
+    return lines_;
+  }
+
  private:
   /// An optional source root, useful for relocating source files on a server or
   /// removing repeated values in the “sources” entry.  This value is prepended
@@ -181,6 +200,9 @@ class SourceMap {
   /// Metadata for each source keyed by source index. Represents the
   /// x_facebook_sources field in the JSON source map.
   MetadataList sourcesMetadata_;
+
+  /// The symbol names referenced by Segment::SourceLocation::nameIndex.
+  std::vector<std::string> names_;
 };
 
 } // namespace hermes
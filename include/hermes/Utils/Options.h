@@ -79,6 +79,14 @@ struct BytecodeGenerationOptions {
   // Emit #line directives in the resulting output.
   bool emitLineDirectives = false;
 
+  /// If non-empty, instrument the generated code to record an execution
+  /// profile, which the emitted main function writes to this file.
+  llvh::StringRef profileGenerateFile{};
+
+  /// Maximum number of threads used to compile independent functions in
+  /// parallel. The output does not depend on this value.
+  unsigned numJobs = 1;
+
   /* implicit */ BytecodeGenerationOptions(OutputFormatKind format)
       : format(format) {}
 
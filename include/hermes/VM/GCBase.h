@@ -333,6 +333,13 @@ class GCBase {
     /// Get a StackTraceTree which can be used to recover stack-traces from \c
     /// StackTraceTreeNode() as returned by \c getCurrentStackTracesTreeNode() .
     virtual StackTracesTree *getStackTracesTree() = 0;
+
+    /// \return an opaque key identifying the innermost JS function on the
+    /// stack (a CodeBlock or a Static Hermes function), or nullptr if there
+    /// is none. If \p name is non-null, store the function's name in it.
+    /// \post The implementation of this function must not perform any GC
+    ///   operations.
+    virtual const void *getCurrentFunctionForProfiling(std::string *name) = 0;
 #endif
 
 #ifdef HERMES_SLOW_DEBUG
@@ -414,6 +421,9 @@ class GCBase {
     StackTracesTree *getStackTracesTree() override {
       return runtime_.getStackTracesTree();
     }
+    const void *getCurrentFunctionForProfiling(std::string *name) override {
+      return runtime_.getCurrentFunctionForProfiling(name);
+    }
 #endif
 
 #ifdef HERMES_SLOW_DEBUG
@@ -621,6 +631,26 @@ class GCBase {
 
     void disable(llvh::raw_ostream &os);
 
+    /// Attribute every subsequent sample to the innermost JS function on the
+    /// stack, starting sampling with \p samplingInterval and \p seed first
+    /// if needed. Unlike enable(), this does not record stack traces.
+    void enableAttribution(size_t samplingInterval, int64_t seed);
+
+    /// \return true if samples are being attributed to functions.
+    bool isAttributing() const {
+      return attributing_;
+    }
+
+    /// Write the per-function allocation statistics gathered so far as JSON
+    /// to \p os. Estimated totals scale each sample by the sampling interval.
+    void emitAttribution(llvh::raw_ostream &os);
+
+    /// Must be called by GC implementations at the end of each young-gen
+    /// collection, after dead objects have been untracked. Samples taken
+    /// since the previous young-gen collection that are still alive are
+    /// counted as survivors.
+    void onYoungGenCollection();
+
    private:
     struct Sample final {
       size_t size;
@@ -628,6 +658,27 @@ class GCBase {
       /// This is the auto-incremented sample ID, not the ID of the object
       /// associated with the sample.
       uint64_t id;
+      /// Index into functionStats_, or UINT32_MAX if not attributed.
+      uint32_t function;
+    };
+
+    /// Allocation statistics for one function, in sampled units.
+    struct FunctionStats final {
+      std::string name;
+      /// Number of samples taken while the function was innermost.
+      uint64_t samples{0};
+      /// Sum of the sizes of the sampled allocations.
+      uint64_t sampledBytes{0};
+      /// Estimated number of allocations represented by the samples.
+      double estimatedCount{0};
+      /// Samples that were allocated directly in the old generation.
+      uint64_t allocatedOldGen{0};
+      /// Samples allocated in the young generation that survived the next
+      /// young-gen collection.
+      uint64_t survivedYoungGen{0};
+      /// Samples that are still alive.
+      uint64_t liveSamples{0};
+      uint64_t liveBytes{0};
     };
 
     /// This mutex protects stackMap_ and samples_. Not needed for enabling and
@@ -651,6 +702,34 @@ class GCBase {
     /// Used for ordering samples.
     uint64_t nextSampleID_{1};
 
+    /// The mean sampling interval, kept to scale attributed samples.
+    size_t samplingInterval_{0};
+
+    /// Whether samples are attributed to functions.
+    bool attributing_{false};
+
+    /// Whether samples record their stack trace, which is only needed by the
+    /// sampling heap profiler and not by attribution.
+    bool recordingStackTraces_{false};
+
+    /// Per-function statistics, indexed by Sample::function.
+    std::vector<FunctionStats> functionStats_;
+
+    /// Map from the key returned by getCurrentFunctionForProfiling to an
+    /// index into functionStats_.
+    llvh::DenseMap<const void *, uint32_t> functionIndex_;
+
+    /// IDs of attributed samples taken since the last young-gen collection.
+    std::vector<HeapSnapshot::NodeID> youngSamples_;
+
+    /// \return the index into functionStats_ for the current function,
+    ///   creating an entry if needed, or UINT32_MAX if there is none.
+    uint32_t currentFunction();
+
+    /// Start sampling about once every \p samplingInterval bytes, seeding the
+    /// random sampling mechanism with \p seed if it is non-negative.
+    void startSampling(size_t samplingInterval, int64_t seed);
+
     /// \return How many bytes should be waited until the next sample.
     size_t nextSample();
   };
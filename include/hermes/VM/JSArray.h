@@ -421,6 +421,13 @@ class JSArrayIterator : public JSObject {
       Handle<JSArrayIterator> self,
       Runtime &runtime);
 
+  /// Iterate to the next element and return its value, without wrapping it in
+  /// an iterator result object.
+  /// \return the empty value if the iteration is done.
+  static CallResult<HermesValue> nextValue(
+      Handle<JSArrayIterator> self,
+      Runtime &runtime);
+
  public:
   JSArrayIterator(
       Runtime &runtime,
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_VM_JSLIB_DATECACHE_H
+#define HERMES_VM_JSLIB_DATECACHE_H
+
+#include "llvh/ADT/SmallVector.h"
+#include "llvh/Support/Compiler.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace hermes {
+namespace vm {
+
+/// Caches the local time zone adjustments used to convert between UTC and
+/// local time, which localTZA() and daylightSavingTA() otherwise compute with a
+/// tzset() and a localtime() call per conversion.
+///
+/// The standard offset is computed once. Daylight saving time is cached per
+/// year: the first conversion in a year finds the instants in that year at
+/// which DST starts or ends, and later conversions in the year only search
+/// that table. daylightSavingTA() maps every year to an equivalent year in
+/// [1970, 2037], so there are at most kNumYears tables.
+///
+/// Checking the time zone on every conversion would cost as much as some of
+/// the conversions, so it is checked every kConversionsPerCheck conversions.
+/// The cache is discarded if the TZ environment variable has changed, or if it
+/// was filled more than kRevalidateInterval earlier, so that changes to the
+/// system time zone are eventually observed. Embedders that change the time
+/// zone can call reset() to observe the change right away.
+class LocalTimeOffsetCache {
+ public:
+  LocalTimeOffsetCache() = default;
+
+  /// LocalTimeOffsetCache is owned by a single Runtime and is not copied.
+  LocalTimeOffsetCache(const LocalTimeOffsetCache &) = delete;
+  void operator=(const LocalTimeOffsetCache &) = delete;
+
+  /// Discard all cached adjustments, which are recomputed on the next
+  /// conversion.
+  void reset() {
+    valid_ = false;
+    conversionsUntilCheck_ = 0;
+  }
+
+  /// Cached equivalent of localTZA().
+  double localTZA() {
+    ensureValid();
+    return ltza_;
+  }
+
+  /// Cached equivalent of daylightSavingTA(\p t).
+  double daylightSavingTA(double t) {
+    ensureValid();
+    return cachedDaylightSavingTA(t);
+  }
+
+  /// Cached equivalent of localTime(\p t).
+  double localTime(double t) {
+    ensureValid();
+    return t + ltza_ + cachedDaylightSavingTA(t);
+  }
+
+  /// Cached equivalent of utcTime(\p t).
+  double utcTime(double t) {
+    ensureValid();
+    return t - ltza_ - cachedDaylightSavingTA(t - ltza_);
+  }
+
+ private:
+  /// Number of equivalent years, 1970 through 2037.
+  static constexpr uint32_t kNumYears = 2037 - 1970 + 1;
+
+  /// Number of conversions between checks of the time zone.
+  static constexpr uint32_t kConversionsPerCheck = 256;
+
+  /// How long the cache is used before it is discarded.
+  static constexpr std::chrono::seconds kRevalidateInterval{60};
+
+  /// The DST transitions in one equivalent year.
+  struct YearTransitions {
+    /// Whether the transitions have been computed.
+    bool computed = false;
+    /// Whether DST is in effect at the start of the year.
+    bool dstAtStart = false;
+    /// The times, in seconds since Jan 1 1970 UTC, at which DST starts or
+    /// ends, in increasing order.
+    llvh::SmallVector<int32_t, 2> transitions{};
+  };
+
+  /// Check the time zone if it is due, which may discard the cache.
+  void ensureValid() {
+    if (LLVM_LIKELY(conversionsUntilCheck_ != 0)) {
+      --conversionsUntilCheck_;
+      return;
+    }
+    checkTimeZone();
+  }
+
+  /// Discard the cache if it is invalid, stale, or the TZ environment variable
+  /// has changed since it was filled, and recompute the standard offset.
+  void checkTimeZone();
+
+  /// daylightSavingTA(\p t), using the cached transitions of the year in which
+  /// its equivalent time falls. The cache must be valid.
+  double cachedDaylightSavingTA(double t);
+
+  /// \return the transitions of the equivalent year \p year, computing them
+  /// if needed.
+  const YearTransitions &getYearTransitions(int32_t year);
+
+  /// Whether ltza_ and years_ may be used.
+  bool valid_ = false;
+
+  /// Number of conversions left before the time zone is checked again.
+  uint32_t conversionsUntilCheck_ = 0;
+
+  /// The steady clock time after which the cache is revalidated.
+  std::chrono::steady_clock::time_point validUntil_{};
+
+  /// Whether the TZ environment variable was set when the cache was filled,
+  /// and its value.
+  bool hasTZ_ = false;
+  std::string tz_{};
+
+  /// The cached localTZA().
+  double ltza_ = 0;
+
+  /// The DST transitions of every equivalent year, indexed by year - 1970.
+  std::array<YearTransitions, kNumYears> years_{};
+};
+
+} // namespace vm
+} // namespace hermes
+
+#endif
@@ -24,6 +24,8 @@
 namespace hermes {
 namespace vm {
 
+class LocalTimeOffsetCache;
+
 //===----------------------------------------------------------------------===//
 // Conversion constants
 
@@ -100,7 +102,7 @@ int32_t weekDay(double t);
 // ES5.1 15.9.1.7
 
 /// Local time zone offset, explicitly not including DST offset.
-/// TODO: Cache this value to avoid recomputing every time.
+/// LocalTimeOffsetCache caches this value.
 double localTZA();
 
 //===----------------------------------------------------------------------===//
@@ -269,7 +271,8 @@ void timeTZString(double t, double tza, llvh::SmallVectorImpl<char> &buf);
 ///   - Date.parse(x.toISOString())
 /// We can extend this to support other formats as well, when the given str
 /// does not conform to the 15.9.1.15 format.
-double parseDate(StringView str);
+/// \param cache converts times without a time zone from local time.
+double parseDate(StringView str, LocalTimeOffsetCache &cache);
 
 } // namespace vm
 } // namespace hermes
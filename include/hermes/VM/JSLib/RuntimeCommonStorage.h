@@ -9,6 +9,7 @@
 #define HERMES_VM_JSLIB_RUNTIMECOMMONSTORAGE_H
 
 #include <random>
+#include "hermes/VM/JSLib/DateCache.h"
 #include "hermes/VM/MockedEnvironment.h"
 
 #include "llvh/ADT/Optional.h"
@@ -40,6 +41,9 @@ struct RuntimeCommonStorage {
   /// PRNG used by Math.random()
   std::minstd_rand randomEngine_;
   bool randomEngineSeeded_ = false;
+
+  /// Local time zone adjustments used by Date.
+  LocalTimeOffsetCache localTimeOffsetCache;
 };
 
 } // namespace vm
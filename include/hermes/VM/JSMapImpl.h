@@ -208,7 +208,16 @@ class JSMapIteratorImpl final : public JSObject {
   static CallResult<HermesValue> nextElement(
       Handle<JSMapIteratorImpl> self,
       Runtime &runtime) {
-    MutableHandle<> value{runtime};
+    return createIterResultFromNextValue(runtime, nextValue(self, runtime));
+  }
+
+  /// Iterate to the next element and return its value, without wrapping it in
+  /// an iterator result object.
+  /// \return the empty value if the iteration is done.
+  static CallResult<HermesValue> nextValue(
+      Handle<JSMapIteratorImpl> self,
+      Runtime &runtime) {
+    MutableHandle<> value{runtime, HermesValue::encodeEmptyValue()};
     if (!self->iterationFinished_) {
       // Iteration has not yet reached the end previously.
       assert(self->data_ && "Storage uninitialized");
@@ -252,8 +261,7 @@ class JSMapIteratorImpl final : public JSObject {
         self->data_.setNull(runtime.getHeap());
       }
     }
-    return createIterResultObject(runtime, value, self->iterationFinished_)
-        .getHermesValue();
+    return value.getHermesValue();
   }
 
   /// Build the metadata for this map implementation, and store it into \p mb.
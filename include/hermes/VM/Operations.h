@@ -330,6 +330,16 @@ CallResult<Handle<JSObject>> iteratorStep(
     Runtime &runtime,
     const IteratorRecord &iteratorRecord);
 
+/// IteratorStep followed by IteratorValue, for iterators whose next method is
+/// the builtin next() of an Array, String, Map or Set iterator. The next method
+/// is read once, when the iterator record is created, so checking its identity
+/// guards against user code replacing it.
+/// \return the next value, the empty value when the iteration is done, or None
+///   if the iterator must be stepped by calling its next method.
+llvh::Optional<CallResult<HermesValue>> builtinIteratorStepValue(
+    Runtime &runtime,
+    const IteratorRecord &iteratorRecord);
+
 /// ES sec-iteratorclose
 /// \param completion the thrown value to complete this operation with, empty if
 /// not thrown.
@@ -353,6 +363,12 @@ bool isUncatchableError(HermesValue value);
 Handle<JSObject>
 createIterResultObject(Runtime &runtime, Handle<> value, bool done);
 
+/// Wrap \p valueRes, returned by the nextValue() method of a builtin iterator,
+/// in an iterator result object. The empty value means the iteration is done.
+CallResult<HermesValue> createIterResultFromNextValue(
+    Runtime &runtime,
+    CallResult<HermesValue> valueRes);
+
 /// ES7 7.3.20
 CallResult<Handle<Callable>> speciesConstructor(
     Handle<JSObject> O,
@@ -151,6 +151,13 @@ class JSStringIterator : public JSObject {
       Handle<JSStringIterator> self,
       Runtime &runtime);
 
+  /// Iterate to the next element and return its value, without wrapping it in
+  /// an iterator result object.
+  /// \return the empty value if the iteration is done.
+  static CallResult<HermesValue> nextValue(
+      Handle<JSStringIterator> self,
+      Runtime &runtime);
+
   JSStringIterator(
       Runtime &runtime,
       Handle<JSObject> parent,
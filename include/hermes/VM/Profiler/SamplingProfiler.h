@@ -69,6 +69,7 @@ class SamplingProfiler {
       NativeFunction,
       FinalizableNativeFunction,
       SuspendFrame,
+      SHFunction,
     };
 
     // TODO: figure out how to store BoundFunction.
@@ -86,10 +87,27 @@ class SamplingProfiler {
       /// We can't directly use std::string here because it is
       /// inside a union.
       SuspendFrameInfo suspendFrame;
+      /// Function compiled by Static Hermes. The info lives in its SHUnit,
+      /// which is not freed while the runtime is alive.
+      const SHNativeFuncInfo *shFunction;
     };
     FrameKind kind;
   };
 
+  /// A node of the call tree that samples are merged into when aggregation is
+  /// enabled. Node 0 is the root and node kTruncatedNode counts the samples
+  /// that did not fit in the tree. Neither has a frame.
+  struct AggregatedNode {
+    /// The frame of this node. Undefined for the root.
+    StackFrame frame;
+    /// Index of the caller's node.
+    uint32_t parent;
+    /// Number of samples in which this node was the leaf.
+    uint64_t selfCount;
+  };
+  /// Index of the node counting samples that did not fit in the tree.
+  static constexpr uint32_t kTruncatedNode = 1;
+
   /// Represent stack trace captured by one sampling.
   struct StackTrace {
     /// Id of the thread that this stack trace is taken from.
@@ -143,6 +161,9 @@ class SamplingProfiler {
     return nativeFunctions_[stackFrame.nativeFrame]->getNameIfExists(runtime_);
   }
 
+  /// \returns the name of the Static Hermes function in \p stackFrame.
+  std::string getSHFunctionName(const StackFrame &stackFrame) const;
+
  private:
   friend struct sampling_profiler::Sampler;
 
@@ -169,6 +190,20 @@ class SamplingProfiler {
   /// JS stack captured at time of GC.
   StackTrace preSuspendStackStorage_{kMaxStackDepth};
 
+  /// Identifies a child of an aggregated node: (parent, frame kind) and the
+  /// two words that distinguish frames of that kind.
+  using AggregatedKey =
+      std::pair<std::pair<uint32_t, uint32_t>, std::pair<uintptr_t, uint64_t>>;
+
+  /// The aggregated call tree, empty unless aggregation is enabled. Protected
+  /// by runtimeDataLock_.
+  std::vector<AggregatedNode> aggregatedNodes_;
+  /// Maps a child key to its index in aggregatedNodes_.
+  llvh::DenseMap<AggregatedKey, uint32_t> aggregatedChildren_;
+  /// Maximum number of nodes in aggregatedNodes_, or 0 if every sample is
+  /// stored in sampledStacks_.
+  uint32_t maxAggregatedNodes_{0};
+
   /// Prellocated map that contains thread names mapping.
   ThreadNamesMap threadNames_;
 
@@ -223,6 +258,14 @@ class SamplingProfiler {
   /// runtimeDataLock_.
   void recordPreSuspendStack(std::string_view extraInfo);
 
+  /// Merge the \p depth frames of \p sample into the aggregated call tree.
+  /// Caller must hold runtimeDataLock_.
+  void aggregateSample(const StackTrace &sample, uint32_t depth);
+
+  /// Reset the aggregated call tree to just its root and the truncated node.
+  /// Caller must hold runtimeDataLock_.
+  void resetAggregatedTree();
+
  protected:
   /// Clear previous stored samples.
   /// Note: caller should take the lock before calling.
@@ -254,6 +297,34 @@ class SamplingProfiler {
   /// for a description.
   void serializeInDevToolsFormat(llvh::raw_ostream &OS);
 
+  /// Merge future samples into a call tree of at most \p maxNodes nodes
+  /// instead of storing each one, so that memory use stays bounded while the
+  /// profiler runs indefinitely. Samples with a frame that does not fit are
+  /// counted as truncated. A \p maxNodes of 0 restores the default of storing
+  /// every sample.
+  void setAggregation(uint32_t maxNodes);
+
+  /// Write the aggregated call tree to \p OS in the folded stack format, one
+  /// "root;...;leaf count" line per node with samples, then reset the tree.
+  /// Samples that did not fit in the tree are reported on a "[truncated]"
+  /// line.
+  /// This format is read by pprof converters and flame graph tools. Must be
+  /// called on the runtime thread since it reads function names from the heap.
+  void dumpAggregatedProfile(llvh::raw_ostream &OS);
+
+#ifdef UNIT_TEST
+  /// Merge \p sample into the aggregated call tree as if the profiler thread
+  /// had taken it.
+  void aggregateSampleForTesting(const StackTrace &sample) {
+    std::lock_guard<std::mutex> lk(runtimeDataLock_);
+    aggregateSample(sample, sample.stack.size());
+  }
+#endif // UNIT_TEST
+
+  /// Set the mean interval between samples taken by the profiler thread to
+  /// \p millis milliseconds. The interval is shared by all runtimes.
+  static void setSampleInterval(uint32_t millis);
+
   /// Static wrapper for dumpSampledStack.
   static void dumpSampledStackGlobal(llvh::raw_ostream &OS);
 
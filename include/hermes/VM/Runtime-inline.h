@@ -21,8 +21,8 @@ inline Callable *Runtime::getBuiltinCallable(unsigned builtinMethodID) {
   return builtins_[builtinMethodID];
 }
 
-inline void Runtime::enqueueJob(Callable *job) {
-  jobQueue_.push_back(job);
+inline void Runtime::enqueueJob(Callable *job, HermesValue arg) {
+  jobQueue_.push_back(Job{job, PinnedHermesValue(arg)});
 }
 
 inline Handle<HiddenClass> Runtime::getHiddenClassForPrototype(
@@ -407,7 +407,12 @@ class Runtime : public RuntimeBase, public HandleRootOwner {
 
   /// ES6-ES11 8.4.1 EnqueueJob ( queueName, job, arguments )
   /// See \c jobQueue_ for how the Jobs and Job Queues are set up in Hermes.
-  inline void enqueueJob(Callable *job);
+  /// Unless it is empty, \p arg is passed to \p job when it runs, which lets
+  /// callers share one function between many jobs instead of allocating a
+  /// closure for each.
+  inline void enqueueJob(
+      Callable *job,
+      HermesValue arg = HermesValue::encodeEmptyValue());
 
   /// ES6-ES11 8.6 RunJobs ( )
   /// Draining the job queue by invoking the queued jobs in FIFO order.
@@ -1285,19 +1290,29 @@ class Runtime : public RuntimeBase, public HandleRootOwner {
   /// True if the builtins are all frozen (non-writable, non-configurable).
   bool builtinsFrozen_{false};
 
+  /// A queued Job: the callable and the single argument it is invoked with,
+  /// or empty if it is invoked with no arguments.
+  struct Job {
+    Callable *callable;
+    PinnedHermesValue arg;
+  };
+
   /// ES6-ES11 8.4 Jobs and Job Queues.
-  /// A queue of pointers to callables that represent Jobs.
+  /// A queue of callables that represent Jobs, with their argument.
   ///
   /// Job: Since the ScriptJob is removed from ES12, the only type of Job from
   /// ECMA-262 are Promise Jobs (https://tc39.es/ecma262/#sec-promise-jobs).
   /// But it is also possible to implement the HTML defined `queueMicrotask`,
   /// which is polyfill-able via Promise, by directly enqueuing into this job.
   ///
-  /// Job are represented as callables with no parameters and would be invoked
-  /// via \c executeCall0 in Hermes. It's safe to do so because:
-  /// - Promise Jobs enqueued from Promise internal bytecode are thunks (or, in
-  /// the ES12 wording, Promise Jobs are Abstract Closure with no parameters).
-  /// - `queueMicrotask` take a JSFunction but only invoke it with 0 arguments.
+  /// Job are represented as callables with at most one parameter and would be
+  /// invoked via \c executeCall0 or \c executeCall1 in Hermes. It's safe to do
+  /// so because:
+  /// - Promise Jobs enqueued from Promise internal bytecode are a shared
+  /// reaction function applied to its reaction record, which is equivalent to
+  /// the ES12 Abstract Closure with no parameters capturing the record.
+  /// - `queueMicrotask` take a JSFunction but only invoke it with 0 arguments,
+  /// so it is enqueued with an empty argument.
   ///
   /// Although ES12 (9.4 Jobs and Host Operations to Enqueue Jobs) changed the
   /// meta-language to ask hosts to schedule Promise Job to integrate with the
@@ -1305,7 +1320,7 @@ class Runtime : public RuntimeBase, public HandleRootOwner {
   /// approach, similar to other engines, e.g. V8/JSC, which is more efficient
   /// (being able to batch the job invocations) and sufficient to express the
   /// HTML spec specified "perform a microtask checkpoint" algorithm.
-  std::deque<Callable *> jobQueue_{};
+  std::deque<Job> jobQueue_{};
 
 #ifdef HERMESVM_PROFILER_BB
   BasicBlockExecutionInfo basicBlockExecInfo_;
@@ -1546,10 +1561,29 @@ class Runtime : public RuntimeBase, public HandleRootOwner {
   /// Disable the heap sampling profiler and flush the results out to \p os.
   void disableSamplingHeapProfiler(llvh::raw_ostream &os);
 
+  /// Attribute sampled allocations to the innermost JS function on the stack,
+  /// sampling about every \p samplingInterval bytes. Unlike the stack traces
+  /// recorded by the sampling heap profiler, this also covers code compiled
+  /// by Static Hermes.
+  void enableAllocationAttribution(
+      size_t samplingInterval,
+      int64_t seed = -1);
+
+  /// Write the per-function allocation report as JSON to \p os.
+  void emitAllocationAttribution(llvh::raw_ostream &os);
+
+  /// \return an opaque key for the innermost CodeBlock or Static Hermes
+  ///   function on the stack, or nullptr. If \p name is non-null, store the
+  ///   function's name in it. Does not allocate.
+  const void *getCurrentFunctionForProfiling(std::string *name);
+
  private:
   void popCallStackImpl();
   void pushCallStackImpl(const CodeBlock *codeBlock, const inst::Inst *ip);
   std::unique_ptr<StackTracesTree> stackTracesTree_;
+  /// If non-empty, the allocation attribution report is written here when
+  /// the runtime is destroyed.
+  std::string allocationProfileFile_;
 #endif
 };
 
@@ -174,6 +174,21 @@ struct VMOnlyRuntimeFlags {
       llvh::cl::init(false),
       llvh::cl::cat(RuntimeCategory)};
 
+  llvh::cl::opt<unsigned> AllocationProfileInterval{
+      "Xalloc-profile-interval",
+      llvh::cl::desc(
+          "Attribute allocations to JS functions, sampling about once every "
+          "this many bytes (0 disables)"),
+      llvh::cl::init(0),
+      llvh::cl::cat(RuntimeCategory)};
+
+  llvh::cl::opt<std::string> AllocationProfileFile{
+      "Xalloc-profile-file",
+      llvh::cl::desc(
+          "Write the allocation profile as JSON to this file on exit"),
+      llvh::cl::init(""),
+      llvh::cl::cat(RuntimeCategory)};
+
   llvh::cl::opt<bool> RandomizeMemoryLayout{
       "Xrandomize-memory-layout",
       llvh::cl::desc("Randomize stack placement etc."),
@@ -81,6 +81,27 @@ class RuntimeModule final : public llvh::ilist_node<RuntimeModule> {
   /// SymbolID.
   std::vector<RootSymbolID> stringIDMap_;
 
+  /// A run of consecutive identifiers in the string table.
+  struct IdentifierRun {
+    /// The string ID of the first identifier in the run.
+    StringID firstStringID;
+    /// The number of identifiers in the run.
+    uint32_t count;
+    /// The index of the precomputed hash of the first identifier.
+    uint32_t firstHash;
+  };
+
+  /// The identifier runs of the string table, sorted by string ID. This is
+  /// only populated when identifiers are registered on first use, and lets
+  /// us find their precomputed hashes.
+  std::vector<IdentifierRun> identifierRuns_{};
+
+  /// The number of identifiers whose registration was deferred.
+  uint32_t numDeferredIdentifiers_{0};
+
+  /// The number of deferred identifiers that have since been registered.
+  uint32_t numMaterializedIdentifiers_{0};
+
   /// Weak pointer to a GC-managed Domain that owns this RuntimeModule.
   /// We use WeakRoot<Domain> here to express that the RuntimeModule does not
   /// own the Domain.
@@ -225,13 +246,15 @@ class RuntimeModule final : public llvh::ilist_node<RuntimeModule> {
 
   /// For opcodes that use a stringID as identifier explicitly, we know that
   /// the compiler would have marked the stringID as identifier, and hence
-  /// we should have created the symbol during identifier table initialization.
-  /// The symbol must already exist in the map. This is a fast path.
+  /// we should have created the symbol during identifier table initialization,
+  /// or, for persistent modules, can register it without allocating in the
+  /// GC heap. This is a fast path.
   SymbolID getSymbolIDMustExist(StringID stringID) {
-    assert(
-        stringIDMap_[stringID].isValid() &&
-        "Symbol must exist for this string ID");
-    return stringIDMap_[stringID];
+    SymbolID id = stringIDMap_[stringID];
+    if (LLVM_UNLIKELY(!id.isValid()))
+      id = materializeIdentifier(stringID);
+    assert(id.isValid() && "Symbol must exist for this string ID");
+    return id;
   }
 
   /// \return the \c SymbolID for a string by string index. The symbol may not
@@ -242,7 +265,10 @@ class RuntimeModule final : public llvh::ilist_node<RuntimeModule> {
     if (LLVM_UNLIKELY(!id.isValid())) {
       // Materialize this lazily created symbol.
       auto entry = bcProvider_->getStringTableEntry(stringID);
-      id = createSymbolFromStringIDMayAllocate(stringID, entry, llvh::None);
+      OptValue<uint32_t> hash = getIdentifierHash(stringID);
+      if (hash)
+        ++numMaterializedIdentifiers_;
+      id = createSymbolFromStringIDMayAllocate(stringID, entry, hash);
     }
     assert(id.isValid() && "Failed to create symbol for stringID");
     return id;
@@ -268,6 +294,17 @@ class RuntimeModule final : public llvh::ilist_node<RuntimeModule> {
     return functionMap_.size();
   }
 
+  /// \return the number of identifiers whose registration was deferred until
+  /// first use.
+  uint32_t getNumDeferredIdentifiers() const {
+    return numDeferredIdentifiers_;
+  }
+
+  /// \return the number of deferred identifiers that have been registered.
+  uint32_t getNumMaterializedIdentifiers() const {
+    return numMaterializedIdentifiers_;
+  }
+
   /// \return the CodeBlock for a function by function index.
   inline CodeBlock *getCodeBlockMayAllocate(unsigned index) {
     if (LLVM_LIKELY(functionMap_[index])) {
@@ -407,9 +444,19 @@ class RuntimeModule final : public llvh::ilist_node<RuntimeModule> {
   }
 
  private:
-  /// Import the string table from the supplied module.
+  /// Import the string table from the supplied module. Identifiers of
+  /// persistent modules are only recorded here, and registered in the
+  /// identifier table the first time they are used.
   void importStringIDMapMayAllocate();
 
+  /// \return the precomputed hash of \p stringID if it is an identifier whose
+  /// registration was deferred by importStringIDMapMayAllocate().
+  OptValue<uint32_t> getIdentifierHash(StringID stringID) const;
+
+  /// Register the deferred identifier \p stringID of a persistent module.
+  /// This does not allocate in the GC heap. \return the new symbol.
+  SymbolID materializeIdentifier(StringID stringID);
+
   /// Initialize functionMap_, without actually creating the code blocks.
   /// They will be created lazily when needed.
   void initializeFunctionMap();
@@ -609,15 +609,37 @@ class ExternalStringPrimitive final : public SymbolStringPrimitive {
   static const VTable vt;
 
   size_t calcExternalMemorySize() const {
+    if (hostData_)
+      return getStringLength() * sizeof(T);
     return contents_.capacity() * sizeof(T);
   }
 
  public:
+  /// Called with the context passed to createFromHost() when the GC frees a
+  /// string backed by host memory.
+  using ReleaseCallback = void (*)(void *context);
+
   /// Construct an ExternalStringPrimitive from the given string \p contents,
   /// non-uniqued.
   template <class BasicString>
   ExternalStringPrimitive(BasicString &&contents);
 
+  /// Construct an ExternalStringPrimitive that refers to the host memory
+  /// \p hostData without copying it.
+  ExternalStringPrimitive(Ref hostData, ReleaseCallback release, void *context);
+
+  /// Create a string whose characters are stored in host memory \p data,
+  /// which must stay valid and unchanged until \p release is called with
+  /// \p context after the GC frees the string. The length of \p data must
+  /// satisfy isExternalLength(). Throw \c RangeError if the string is longer
+  /// than \c MAX_STRING_LENGTH characters, in which case \p release is not
+  /// called.
+  static CallResult<HermesValue> createFromHost(
+      Runtime &runtime,
+      Ref data,
+      ReleaseCallback release,
+      void *context);
+
  private:
   /// Destructor deallocates the contents_ string.
   ~ExternalStringPrimitive() = default;
@@ -642,6 +664,8 @@ class ExternalStringPrimitive final : public SymbolStringPrimitive {
   static CallResult<HermesValue> create(Runtime &runtime, uint32_t length);
 
   const T *getRawPointer() const {
+    if (hostData_)
+      return hostData_;
     // C++11 defines this to be valid even if the string is empty.
     return &contents_[0];
   }
@@ -651,6 +675,7 @@ class ExternalStringPrimitive final : public SymbolStringPrimitive {
   /// normally be done, but for those rare cases, this method gives access to
   /// the writable buffer.
   T *getRawPointerForWrite() {
+    assert(!hostData_ && "Host memory of a string cannot be written");
     // C++11 defines this to be valid even if the string is empty.
     return &contents_[0];
   }
@@ -669,7 +694,16 @@ class ExternalStringPrimitive final : public SymbolStringPrimitive {
 
   /// The backing storage of this string. Note that the string's length is fixed
   /// and must always be equal to StringPrimitive::getStringLength().
+  /// Empty if the string is backed by host memory.
   CopyableStdString contents_{};
+
+  /// The characters of a string created by createFromHost(), or nullptr if the
+  /// string owns its contents_.
+  const T *hostData_ = nullptr;
+  /// Releases hostData_ when the string is finalized.
+  ReleaseCallback hostRelease_ = nullptr;
+  /// The argument passed to hostRelease_.
+  void *hostContext_ = nullptr;
 };
 
 /// An immutable JavaScript primitive consisting of a pointer to an
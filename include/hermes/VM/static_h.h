@@ -55,6 +55,25 @@ typedef struct SHNativeFuncInfo {
   uint32_t arg_count;
 } SHNativeFuncInfo;
 
+/// Kinds of execution profile counters emitted by the SH backend.
+typedef enum SHProfileSiteKind {
+  /// Counts invocations of a function. The location is the function start.
+  SHProfileSiteFunction = 0,
+  /// Counts executions of a call instruction.
+  SHProfileSiteCall = 1,
+} SHProfileSiteKind;
+
+/// Describes a single execution profile counter in an instrumented SHUnit.
+typedef struct SHProfileSite {
+  /// One of SHProfileSiteKind.
+  uint32_t kind;
+  /// The index in the global string table of the name of the function
+  /// containing this site.
+  uint32_t name_index;
+  /// The index in the unit's source location table of this site.
+  uint32_t src_location_idx;
+} SHProfileSite;
+
 /// SHUnit describes a compilation unit.
 ///
 /// <h2>Restrictions</h2>
@@ -136,6 +155,20 @@ typedef struct SHUnit {
   /// Unit name.
   const char *unit_name;
 
+  /// Number of execution profile counters. Zero if the unit was not compiled
+  /// with profiling instrumentation.
+  uint32_t num_profile_sites;
+  /// Description of each profile counter. Points to an array with
+  /// `num_profile_sites` elements.
+  const SHProfileSite *profile_sites;
+  /// Execution count of each profile site. Must be zeroed initially.
+  uint64_t *profile_counts;
+  /// The order in which each profile site was first executed (1-based), or 0
+  /// if it was never executed. Must be zeroed initially.
+  uint64_t *profile_order;
+  /// The last assigned first-execution order.
+  uint64_t profile_seq;
+
   /// Data managed by the runtime. Field populated by the runtime.
   SHUnitExt *runtime_ext;
 } SHUnit;
@@ -161,6 +194,32 @@ typedef struct SHLocals {
 /// A dummy export to ensure correct library is linked.
 SHERMES_EXPORT void _SH_MODEL(void);
 
+/// Marks generated functions that never executed while profiling, so the C
+/// compiler optimizes them for size and moves them away from hot code.
+#if defined(__GNUC__) || defined(__clang__)
+#define SH_COLD __attribute__((cold))
+#else
+#define SH_COLD
+#endif
+
+/// Marks generated functions that first ran during the startup of the
+/// profiled program. On ELF targets they are placed in .text.startup, which
+/// linkers keep contiguous, so startup touches fewer code pages.
+#if defined(__ELF__) && (defined(__GNUC__) || defined(__clang__))
+#define SH_STARTUP __attribute__((section(".text.startup")))
+#else
+#define SH_STARTUP
+#endif
+
+/// Marks generated functions and tables that are shared between the C files
+/// of a unit split into several translation units, but are not exported from
+/// the final binary.
+#if defined(__GNUC__) || defined(__clang__)
+#define SH_HIDDEN __attribute__((visibility("hidden")))
+#else
+#define SH_HIDDEN
+#endif
+
 #ifndef HERMES_IS_MOBILE_BUILD
 /// Parse the command line flags, if provided. If not provided, the VM command
 /// line options receive their default values specified in cli::RuntimeFlags.
@@ -215,6 +274,21 @@ _sh_unit_init_guarded(SHRuntime *shr, SHUnit *unit, SHLegacyValue *resultOrExc);
 /// \return false if a unit threw an exception.
 SHERMES_EXPORT bool _sh_initialize_units(SHRuntime *shr, uint32_t count, ...);
 
+/// Increment the execution profile counter \p idx of \p unit, recording the
+/// order in which it was first reached. Emitted by the SH backend when
+/// compiling with profiling instrumentation.
+static inline void _sh_profile_count(SHUnit *unit, uint32_t idx) {
+  if (unit->profile_counts[idx]++ == 0)
+    unit->profile_order[idx] = ++unit->profile_seq;
+}
+
+/// Write the execution profile of all instrumented units registered with the
+/// runtime as JSON to the file at \p path. The output can be passed to the
+/// compiler with -profile-use.
+///
+/// \return false if the file could not be written.
+SHERMES_EXPORT bool _sh_write_profile(SHRuntime *shr, const char *path);
+
 /// ES6.0 12.2.9.3 Runtime Semantics: GetTemplateObject ( templateLiteral )
 ///
 /// Given a template literal, return a template object that looks like this:
@@ -312,6 +386,25 @@ SHERMES_EXPORT void _sh_ljs_reify_arguments_strict(
     SHLegacyValue *frame,
     SHLegacyValue *lazyReg);
 
+/// Call \p callee, loaded from `target.apply`, as in
+/// `target.apply(thisArg, arguments)`. If \p callee is Function.prototype.apply
+/// and the arguments object in \p lazyReg has not been created, the arguments
+/// of \p frame are passed to \p target without creating it.
+SHERMES_EXPORT SHLegacyValue _sh_ljs_apply_arguments_loose(
+    SHRuntime *shr,
+    SHLegacyValue *frame,
+    SHLegacyValue *callee,
+    SHLegacyValue *target,
+    SHLegacyValue *thisArg,
+    SHLegacyValue *lazyReg);
+SHERMES_EXPORT SHLegacyValue _sh_ljs_apply_arguments_strict(
+    SHRuntime *shr,
+    SHLegacyValue *frame,
+    SHLegacyValue *callee,
+    SHLegacyValue *target,
+    SHLegacyValue *thisArg,
+    SHLegacyValue *lazyReg);
+
 /// Allocate an empty, uninitialized object (immediately before a constructor).
 SHERMES_EXPORT SHLegacyValue _sh_ljs_create_this(
     SHRuntime *shr,
@@ -169,6 +169,7 @@ BCProviderFromSrc::createBCProviderFromSrcImpl(
   }
 
   context->setGeneratorEnabled(compileFlags.enableGenerator);
+  context->setParseJobs(compileFlags.parseJobs);
   context->setDebugInfoSetting(
       compileFlags.debug ? DebugInfoSetting::ALL : DebugInfoSetting::THROWING);
   context->setEmitAsyncBreakCheck(compileFlags.emitAsyncBreakCheck);
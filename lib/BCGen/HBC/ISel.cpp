@@ -1502,6 +1502,11 @@ void HBCISel::generateHBCReifyArgumentsStrictInst(
   auto reg = encodeValue(Inst->getLazyRegister());
   BCFGen_->emitReifyArgumentsStrict(reg);
 }
+void HBCISel::generateHBCApplyArgumentsInst(
+    hermes::HBCApplyArgumentsInst *Inst,
+    hermes::BasicBlock *next) {
+  hermes_fatal("HBCApplyArgumentsInst unsupported in HBC");
+}
 void HBCISel::generateCreateThisInst(CreateThisInst *Inst, BasicBlock *next) {
   auto output = encodeValue(Inst);
   auto proto = encodeValue(Inst->getPrototype());
@@ -211,6 +211,11 @@ bool LoadConstants::operandMustBeLiteral(Instruction *Inst, unsigned opIndex) {
     return true;
   }
 
+  if (llvh::isa<HBCApplyArgumentsInst>(Inst) &&
+      opIndex == HBCApplyArgumentsInst::IsStrictIdx) {
+    return true;
+  }
+
   if (llvh::isa<GetTemplateObjectInst>(Inst) &&
       (opIndex == GetTemplateObjectInst::TemplateObjIDIdx ||
        opIndex == GetTemplateObjectInst::DupIdx)) {
@@ -410,6 +415,27 @@ CreateArgumentsInst *LowerArgumentsArray::getCreateArgumentsInst(Function *F) {
   return nullptr;
 }
 
+bool LowerArgumentsArray::isApplyWithArguments(
+    Value *user,
+    CreateArgumentsInst *createArguments) {
+  auto *call = llvh::dyn_cast<CallInst>(user);
+  if (!call || call->getNumArguments() != 3 ||
+      call->getArgument(2) != createArguments ||
+      !llvh::isa<LiteralUndefined>(call->getNewTarget()))
+    return false;
+  // `arguments` must not escape through any other operand.
+  if (call->getCallee() == createArguments ||
+      call->getThis() == createArguments ||
+      call->getArgument(1) == createArguments)
+    return false;
+  // The callee must be loaded from the function being called.
+  auto *load = llvh::dyn_cast<BaseLoadPropertyInst>(call->getCallee());
+  if (!load || load->getObject() != call->getThis())
+    return false;
+  auto *prop = llvh::dyn_cast<LiteralString>(load->getProperty());
+  return prop && prop->getValue().str() == "apply";
+}
+
 bool LowerArgumentsArray::runOnFunction(Function *F) {
   IRBuilder builder(F);
   updateToEntryInsertionPoint(builder, F);
@@ -458,6 +484,19 @@ bool LowerArgumentsArray::runOnFunction(Function *F) {
         load->replaceAllUsesWith(get);
         load->eraseFromParent();
       }
+    } else if (lowerApply_ && isApplyWithArguments(user, createArguments)) {
+      // For `fn.apply(thisArg, arguments)`, pass the arguments directly.
+      auto *call = llvh::cast<CallInst>(user);
+      builder.setInsertionPoint(call);
+      builder.setLocation(call->getLocation());
+      auto *apply = builder.createHBCApplyArgumentsInst(
+          call->getCallee(),
+          call->getThis(),
+          call->getArgument(1),
+          lazyReg,
+          isStrict);
+      call->replaceAllUsesWith(apply);
+      call->eraseFromParent();
     }
   }
 
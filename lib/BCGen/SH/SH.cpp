@@ -20,6 +20,7 @@
 #include "hermes/BCGen/RemoveMovs.h"
 #include "hermes/BCGen/SerializedLiteralGenerator.h"
 #include "hermes/IR/Analysis.h"
+#include "hermes/IR/ExecutionProfile.h"
 #include "hermes/IR/IR.h"
 #include "hermes/IR/IRVerifier.h"
 #include "hermes/IR/Instrs.h"
@@ -31,6 +32,10 @@
 
 #include "llvh/ADT/BitVector.h"
 #include "llvh/ADT/SetVector.h"
+#include "llvh/Support/Path.h"
+
+#include <atomic>
+#include <thread>
 
 using namespace hermes;
 
@@ -91,8 +96,9 @@ class SHStringTable {
   }
 
   /// Turn the table of strings into the SH C data structures that are necessary
-  /// to provide strings for the module.
-  void generate(llvh::raw_ostream &os) const {
+  /// to provide strings for the module. The symbol table is declared with the
+  /// storage class specifier \p symbolsStorage.
+  void generate(llvh::raw_ostream &os, llvh::StringRef symbolsStorage) const {
     struct StringEntry {
       uint32_t offset, length, hash;
     };
@@ -164,7 +170,7 @@ class SHStringTable {
        << asciiStr << "};\n"
        << "static const char16_t s_u16_pool[] = {\n"
        << u16Str << "};\n"
-       << "static SHSymbolID s_symbols[" << size() << "];\n"
+       << symbolsStorage << "SHSymbolID s_symbols[" << size() << "];\n"
        << "static const uint32_t s_strings[] = {";
     for (const auto &entry : stringEntries)
       os << entry.offset << "," << entry.length << "," << entry.hash << ",";
@@ -389,10 +395,33 @@ class SHNativeJSFunctionTable {
   llvh::DenseMap<Function *, unsigned> funcMap_{};
   /// A reference to the global string table. Used for function names.
   SHStringTable &stringTable_;
+  /// Prefix of all function labels.
+  std::string labelPrefix_;
+  /// The source location of each function other than the top level function,
+  /// indexed by function index, as a label suffix "__<file>_<line>". Empty if
+  /// the location is unknown.
+  std::vector<std::string> locationSuffixes_;
+
+  /// Write \p str to \p OS, replacing characters that aren't allowed in C
+  /// identifiers with '_'.
+  static void writeIdentifierChars(llvh::StringRef str, llvh::raw_ostream &OS) {
+    for (auto c : str) {
+      if (('0' <= c && c <= '9') || ('a' <= c && c <= 'z') ||
+          ('A' <= c && c <= 'Z')) {
+        OS << c;
+      } else {
+        // Replace illegal identifier characters with '_'.
+        OS << '_';
+      }
+    }
+  }
 
  public:
-  explicit SHNativeJSFunctionTable(Module *M, SHStringTable &stringTable)
-      : stringTable_(stringTable) {
+  explicit SHNativeJSFunctionTable(
+      Module *M,
+      SHStringTable &stringTable,
+      std::string labelPrefix)
+      : stringTable_(stringTable), labelPrefix_(std::move(labelPrefix)) {
     // Ensure that the top level function has an id of 0.
     auto topLevelFunc = M->getTopLevelFunction();
     funcMap_[topLevelFunc] = 0;
@@ -404,6 +433,23 @@ class SHNativeJSFunctionTable {
         funcMap_[&F] = funcCounter++;
       }
     }
+
+    // Name the source location of each function in its label, so that native
+    // profilers and debuggers, which only see the symbol, can attribute the
+    // code to the JS source.
+    SourceErrorManager &sm = M->getContext().getSourceErrorManager();
+    locationSuffixes_.resize(funcCounter);
+    for (auto &F : *M) {
+      SourceErrorManager::SourceCoords coords;
+      if (&F == topLevelFunc ||
+          !sm.findBufferLineAndLoc(F.getSourceRange().Start, coords))
+        continue;
+      llvh::raw_string_ostream OS(locationSuffixes_[funcMap_[&F]]);
+      OS << "__";
+      writeIdentifierChars(
+          llvh::sys::path::filename(sm.getSourceUrl(coords.bufId)), OS);
+      OS << '_' << coords.line;
+    }
   }
 
   /// \return the unique index for the given \p F.
@@ -416,33 +462,26 @@ class SHNativeJSFunctionTable {
     return funcMap_.size();
   }
 
-  /// Generates the correct label for Function \p F, and outputs it to \p OS. If
-  /// the JS function name contains characters that aren't allowed in C
-  /// identifiers, they will be replaced by '_'.
+  /// Generates the correct label for Function \p F, and outputs it to \p OS.
+  /// The label is followed by the file name and line of the function, if
+  /// known. If the JS function name or the file name contains characters that
+  /// aren't allowed in C identifiers, they will be replaced by '_'.
   void generateFunctionLabel(Function *F, llvh::raw_ostream &OS) const {
-    OS << '_' << getIndex(F) << '_';
-
-    auto name = F->getInternalNameStr();
-    for (auto c : name) {
-      if (('0' <= c && c <= '9') || ('a' <= c && c <= 'z') ||
-          ('A' <= c && c <= 'Z')) {
-        OS << c;
-      } else {
-        // Replace illegal identifier characters with '_'.
-        OS << '_';
-      }
-    }
+    uint32_t index = getIndex(F);
+    OS << labelPrefix_ << '_' << index << '_';
+    writeIdentifierChars(F->getInternalNameStr(), OS);
+    OS << locationSuffixes_[index];
   }
 
   /// Turn the table of function information into the corresponding SH C data
-  /// structures.
-  void generate(llvh::raw_ostream &OS) const {
+  /// structures, declared with the storage class specifier \p storage.
+  void generate(llvh::raw_ostream &OS, llvh::StringRef storage) const {
     // Sort the keys by function index.
     std::vector<const Function *> sortedKeys{funcMap_.size()};
     for (auto &entry : funcMap_)
       sortedKeys[entry.second] = entry.first;
 
-    OS << "\nstatic SHNativeFuncInfo s_function_info_table[] = {\n";
+    OS << '\n' << storage << "SHNativeFuncInfo s_function_info_table[] = {\n";
     for (const Function *F : sortedKeys) {
       uint32_t nameIdx = stringTable_.add(F->getOriginalOrInferredName().str());
       uint32_t argCount = F->getExpectedParamCountIncludingThis() - 1;
@@ -454,6 +493,65 @@ class SHNativeJSFunctionTable {
   }
 };
 
+/// Table of execution profile counters, populated when compiling with
+/// profiling instrumentation. Every function entry and call gets a counter,
+/// identified at runtime by its source location.
+class SHProfileSiteTable {
+  struct Site {
+    /// Name of the SHProfileSiteKind enumerator.
+    const char *kind;
+    /// Index of the function name in the global string table.
+    uint32_t nameIdx;
+    /// Index of the location in the source location table.
+    SHSrcLocationTable::IdxTy srcLocIdx;
+  };
+  std::vector<Site> sites_{};
+
+  /// A reference to the global string table. Used for function names.
+  SHStringTable &stringTable_;
+  /// A reference to the source location table. Used for site locations.
+  SHSrcLocationTable &srcLocationTable_;
+
+ public:
+  SHProfileSiteTable(
+      SHStringTable &stringTable,
+      SHSrcLocationTable &srcLocationTable)
+      : stringTable_(stringTable), srcLocationTable_(srcLocationTable) {}
+
+  /// Add a counter of kind \p kind for location \p loc in function \p F.
+  /// \return the index of the counter.
+  uint32_t add(const char *kind, Function *F, SMLoc loc) {
+    auto &sm = F->getContext().getSourceErrorManager();
+    SHSrcLocationTable::IdxTy locIdx = SHSrcLocationTable::kInvalidLocIdx;
+    hermes::SourceErrorManager::SourceCoords coords;
+    if (loc.isValid() && sm.findBufferLineAndLoc(loc, coords))
+      locIdx = srcLocationTable_.getIndex(sm, coords);
+    sites_.push_back(
+        {kind,
+         stringTable_.add(F->getOriginalOrInferredName().str()),
+         locIdx});
+    return sites_.size() - 1;
+  }
+
+  /// \return the number of counters.
+  uint32_t size() const {
+    return sites_.size();
+  }
+
+  /// Turn the table of counters into the corresponding SH C data structures.
+  void generate(llvh::raw_ostream &OS) const {
+    OS << "\nstatic const SHProfileSite s_profile_sites[] = {\n";
+    for (const Site &site : sites_) {
+      OS.indent(2);
+      OS << "{ .kind = " << site.kind << ", .name_index = " << site.nameIdx
+         << ", .src_location_idx = " << site.srcLocIdx << " },\n";
+    }
+    OS << "};\n"
+       << "static uint64_t s_profile_counts[" << sites_.size() << "];\n"
+       << "static uint64_t s_profile_order[" << sites_.size() << "];\n";
+  }
+};
+
 struct ModuleGen {
   /// Table containing uniqued strings for the current module.
   SHStringTable stringTable{};
@@ -471,10 +569,22 @@ struct ModuleGen {
   /// Table of JS native functions
   SHNativeJSFunctionTable nativeFunctionTable;
 
-  explicit ModuleGen(Module *M)
+  /// Execution profile counters. Empty unless profiling instrumentation was
+  /// requested.
+  SHProfileSiteTable profileSiteTable;
+
+  /// Set when the module is split into several C translation units, so
+  /// functions and tables referenced by the code are shared between units.
+  bool split;
+
+  /// \p symbolPrefix is prepended to the names of functions, and must be
+  ///   non-empty when splitting the module.
+  explicit ModuleGen(Module *M, std::string symbolPrefix)
       : literalBuffers{stringTable},
         srcLocationTable{stringTable},
-        nativeFunctionTable{M, stringTable} {}
+        nativeFunctionTable{M, stringTable, symbolPrefix},
+        profileSiteTable{stringTable, srcLocationTable},
+        split(!symbolPrefix.empty()) {}
 };
 
 class InstrGen {
@@ -695,6 +805,11 @@ class InstrGen {
   }
   void generateMovInst(MovInst &inst) {
     sh::Register dstReg = ra_.getRegister(&inst);
+    // The register allocator tries to give a MOV the register of its operand,
+    // in which case there is nothing to copy.
+    if (auto srcReg = ra_.getOptionalRegister(inst.getSingleOperand());
+        srcReg && *srcReg == dstReg)
+      return;
     os_.indent(2);
     generateRegister(dstReg);
     os_ << " = ";
@@ -831,6 +946,20 @@ class InstrGen {
     generateRegisterPtr(*inst.getLazyRegister());
     os_ << ");\n";
   }
+  void generateHBCApplyArgumentsInst(HBCApplyArgumentsInst &inst) {
+    os_.indent(2);
+    generateRegister(inst);
+    os_ << " = _sh_ljs_apply_arguments_"
+        << (inst.getIsStrict() ? "strict" : "loose") << "(shr, frame, ";
+    generateRegisterPtr(*inst.getCallee());
+    os_ << ", ";
+    generateRegisterPtr(*inst.getTarget());
+    os_ << ", ";
+    generateRegisterPtr(*inst.getThisArg());
+    os_ << ", ";
+    generateRegisterPtr(*inst.getLazyRegister());
+    os_ << ");\n";
+  }
   void generateHBCSpillMovInst(HBCSpillMovInst &inst) {
     os_.indent(2);
     generateRegister(inst);
@@ -2282,7 +2411,7 @@ void lowerModuleIR(Module *M, bool optimize) {
   PM.addPass(new LowerBuiltinCalls());
   PM.addPass(new LowerNumericProperties());
   PM.addPass(sh::createLowerAllocObjectLiteral());
-  PM.addPass(new hbc::LowerArgumentsArray());
+  PM.addPass(new hbc::LowerArgumentsArray(/* lowerApply */ true));
   PM.addPass(new LimitAllocArray(UINT16_MAX));
   PM.addPass(new hbc::DedupReifyArguments());
   // TODO Consider supporting LowerSwitchIntoJumpTables for optimization
@@ -2323,20 +2452,109 @@ void lowerAllocatedFunctionIR(
   PM.run(F);
 }
 
-/// Converts Function \p F into valid C code and outputs it through \p OS.
+/// \return true if the execution profile shows that \p F never executed.
+bool isColdFunction(Function *F) {
+  const ExecutionProfile *profile = F->getContext().getExecutionProfile();
+  if (!profile)
+    return false;
+  const ExecutionProfile::Counts *counts = profile->getFunction(F);
+  return counts && ExecutionProfile::isCold(*counts);
+}
+
+/// \return true if the execution profile shows that \p F first ran during
+/// startup.
+bool isStartupFunction(Function *F) {
+  const ExecutionProfile *profile = F->getContext().getExecutionProfile();
+  if (!profile)
+    return false;
+  const ExecutionProfile::Counts *counts = profile->getFunction(F);
+  return counts && ExecutionProfile::isStartup(*counts);
+}
+
+/// \return the functions of \p M in the order they should be emitted. If an
+/// execution profile is available, functions are placed in the order they
+/// were first executed, so that startup code is contiguous in the binary,
+/// followed by the remaining functions in module order.
+std::vector<Function *> layoutFunctions(Module *M) {
+  std::vector<Function *> order{};
+  for (Function &F : *M)
+    order.push_back(&F);
+
+  const ExecutionProfile *profile = M->getContext().getExecutionProfile();
+  if (!profile)
+    return order;
+
+  auto firstExecution = [profile](Function *F) -> uint64_t {
+    const ExecutionProfile::Counts *counts = profile->getFunction(F);
+    return counts && counts->order ? counts->order : UINT64_MAX;
+  };
+  std::stable_sort(
+      order.begin(), order.end(), [&firstExecution](Function *a, Function *b) {
+        return firstExecution(a) < firstExecution(b);
+      });
+  return order;
+}
+
+/// A function whose registers have been allocated, ready for final lowering
+/// and code generation.
+struct AllocatedFunction {
+  /// The basic blocks of the function in reverse post order.
+  llvh::SmallVector<BasicBlock *, 16> order{};
+  /// The register allocation of the function.
+  std::unique_ptr<sh::SHRegisterAllocator> RA{};
+};
+
+/// Allocate the registers of function \p F.
+/// This only modifies the IR of \p F itself (PHI lowering), so it can run
+/// concurrently for different functions of the same module, as long as no
+/// other thread is modifying the module.
+AllocatedFunction allocateFunction(Function *F) {
+  AllocatedFunction result{};
+  PostOrderAnalysis PO(F);
+  result.order.assign(PO.rbegin(), PO.rend());
+  result.RA = std::make_unique<sh::SHRegisterAllocator>(F);
+  result.RA->allocate(result.order);
+  return result;
+}
+
+/// Allocate the registers of all \p functions using up to \p numJobs threads.
+/// \return the allocations in the same order as \p functions, so the result
+///   does not depend on the number of threads.
+std::vector<AllocatedFunction> allocateFunctions(
+    llvh::ArrayRef<Function *> functions,
+    unsigned numJobs) {
+  std::vector<AllocatedFunction> allocated(functions.size());
+  std::atomic<size_t> nextFunc{0};
+  auto worker = [&]() {
+    for (size_t i; (i = nextFunc.fetch_add(1, std::memory_order_relaxed)) <
+         functions.size();) {
+      allocated[i] = allocateFunction(functions[i]);
+    }
+  };
+
+  std::vector<std::thread> threads{};
+  size_t numThreads = std::min<size_t>(numJobs, functions.size());
+  for (size_t i = 1; i < numThreads; ++i)
+    threads.emplace_back(worker);
+  // The current thread participates too.
+  worker();
+  for (std::thread &t : threads)
+    t.join();
+  return allocated;
+}
+
+/// Converts Function \p F, whose registers were allocated in \p allocated,
+/// into valid C code and outputs it through \p OS.
 void generateFunction(
     Function &F,
+    AllocatedFunction &allocated,
     hermes::sh::LineDirectiveEmitter &OS,
     ModuleGen &moduleGen,
     FunctionScopeAnalysis &scopeAnalysis,
     uint32_t &nextCacheIdx,
     BytecodeGenerationOptions options) {
-  PostOrderAnalysis PO(&F);
-
-  llvh::SmallVector<BasicBlock *, 16> order(PO.rbegin(), PO.rend());
-
-  sh::SHRegisterAllocator RA(&F);
-  RA.allocate(order);
+  llvh::ArrayRef<BasicBlock *> order = allocated.order;
+  sh::SHRegisterAllocator &RA = *allocated.RA;
 
   if (options.format == DumpRA) {
     RA.dump(order);
@@ -2399,7 +2617,13 @@ void generateFunction(
   // Number of registers stored in the `locals` struct below.
   uint32_t localsSize = RA.getMaxRegisterUsage(sh::RegClass::LocalPtr);
 
-  OS << "static SHLegacyValue ";
+  if (!moduleGen.split)
+    OS << "static ";
+  OS << "SHLegacyValue ";
+  if (isColdFunction(&F))
+    OS << "SH_COLD ";
+  else if (isStartupFunction(&F))
+    OS << "SH_STARTUP ";
   moduleGen.nativeFunctionTable.generateFunctionLabel(&F, OS);
   OS << "(SHRuntime *shr) {\n";
 
@@ -2479,6 +2703,14 @@ void generateFunction(
        << " = _sh_ljs_native_pointer(&locals.head);\n";
   }
 
+  bool emitProfileCounters = !options.profileGenerateFile.empty();
+  if (emitProfileCounters) {
+    OS << "  _sh_profile_count(&THIS_UNIT, "
+       << moduleGen.profileSiteTable.add(
+              "SHProfileSiteFunction", &F, F.getSourceRange().Start)
+       << ");\n";
+  }
+
   // The most recent index into the source location table that was used by a
   // throwing instruction.
   SHSrcLocationTable::IdxTy prevSrcLocationIdx =
@@ -2543,6 +2775,13 @@ void generateFunction(
           prevSrcLocationIdx = idx;
         }
       }
+      if (emitProfileCounters &&
+          (llvh::isa<CallInst>(I) || llvh::isa<HBCCallNInst>(I))) {
+        OS << "  _sh_profile_count(&THIS_UNIT, "
+           << moduleGen.profileSiteTable.add(
+                  "SHProfileSiteCall", &F, I.getLocation())
+           << ");\n";
+      }
       instrGen.generate(I);
     }
   }
@@ -2582,12 +2821,48 @@ void generateExternC(Module *M, llvh::raw_ostream &OS) {
     OS << '\n';
 }
 
-/// Converts Module \p M into valid C code and outputs it through \p OS.
-/// Returns the cache size necessary to store all the cache indexes used.
+/// Partition \p functions, in order, into at most \p numUnits contiguous
+/// chunks of roughly equal instruction counts.
+/// \return the index of the unit of each function.
+std::vector<size_t> partitionFunctions(
+    llvh::ArrayRef<Function *> functions,
+    size_t numUnits) {
+  std::vector<size_t> sizes{};
+  size_t total = 0;
+  for (Function *F : functions) {
+    size_t size = 0;
+    for (BasicBlock &BB : *F)
+      size += BB.getInstList().size();
+    sizes.push_back(size);
+    total += size;
+  }
+
+  std::vector<size_t> unitOf{};
+  size_t unit = 0, cumulative = 0;
+  for (size_t size : sizes) {
+    // Move on to the next unit once this one has its share of the total.
+    if (unit + 1 < numUnits && cumulative * numUnits >= total * (unit + 1))
+      ++unit;
+    unitOf.push_back(unit);
+    cumulative += size;
+  }
+  return unitOf;
+}
+
+/// Converts Module \p M into valid C code and outputs it through \p units.
+/// If \p header is null, everything is emitted into a single unit. Otherwise
+/// the declarations shared by all units are emitted into \p header, which
+/// every unit includes as \p headerName, the functions are distributed among
+/// \p units, and the module data is emitted into the first unit.
 void generateModule(
     Module *M,
-    hermes::sh::LineDirectiveEmitter &OS,
+    llvh::ArrayRef<hermes::sh::LineDirectiveEmitter *> units,
+    llvh::raw_ostream *header,
+    llvh::StringRef headerName,
     const BytecodeGenerationOptions &options) {
+  assert(!units.empty() && "no output unit");
+  hermes::sh::LineDirectiveEmitter &OS = *units[0];
+
   lowerModuleIR(M, options.optimizationEnabled);
 
   if (options.verifyIR) {
@@ -2607,7 +2882,11 @@ void generateModule(
   // TODO: Share cache indices where the property name is the same and
   // -reuse-prop-cache is passed in.
   uint32_t nextCacheIdx = 0;
-  ModuleGen moduleGen{M};
+  // When splitting, symbols shared between units get the unit name as a
+  // prefix, so separately compiled units don't collide when linked together.
+  bool split = header != nullptr;
+  ModuleGen moduleGen{
+      M, split ? ("sh_export_" + options.unitName).str() : std::string()};
 
   auto topLevelFunc = M->getTopLevelFunction();
   FunctionScopeAnalysis scopeAnalysis{topLevelFunc};
@@ -2615,50 +2894,113 @@ void generateModule(
   if (options.format == DumpBytecode || options.format == EmitBundle) {
     if (!isValidSHUnitName(options.unitName))
       hermes_fatal("Invalid unit name passed to SH backend.");
+    llvh::raw_ostream &declOS = split ? *header : OS;
     // Note that we prefix the unit name with sh_export_ to avoid potential
     // conflicts.
-    OS << "#define THIS_UNIT sh_export_" << options.unitName << R"(
+    declOS << "#define THIS_UNIT sh_export_" << options.unitName << R"(
 #include "hermes/VM/static_h.h"
 
 #include <stdlib.h>
 
 )";
 
-    generateExternCIncludes(M, OS);
+    generateExternCIncludes(M, declOS);
 
-    OS << R"(SHUnit THIS_UNIT;
+    if (!split) {
+      OS << R"(SHUnit THIS_UNIT;
 
 static SHSymbolID s_symbols[];
 static SHPropertyCacheEntry s_prop_cache[];
 static const SHSrcLoc s_source_locations[];
 static SHNativeFuncInfo s_function_info_table[];
 )";
+    } else {
+      *header << "extern SHUnit THIS_UNIT;\n\n";
+      for (const char *name : {"symbols", "prop_cache", "function_info_table"})
+        *header << "#define s_" << name << " sh_export_" << options.unitName
+                << '_' << name << '\n';
+      *header << R"(
+SH_HIDDEN extern SHSymbolID s_symbols[];
+SH_HIDDEN extern SHPropertyCacheEntry s_prop_cache[];
+SH_HIDDEN extern SHNativeFuncInfo s_function_info_table[];
+)";
+    }
 
     // Declare extern functions.
-    generateExternC(M, OS);
+    generateExternC(M, declOS);
 
     // Forward declare every JS function.
     for (auto &F : *M) {
-      OS << "static SHLegacyValue ";
-      moduleGen.nativeFunctionTable.generateFunctionLabel(&F, OS);
-      OS << "(SHRuntime *shr);\n";
+      declOS << (split ? "SH_HIDDEN " : "static ") << "SHLegacyValue ";
+      if (isColdFunction(&F))
+        declOS << "SH_COLD ";
+      else if (isStartupFunction(&F))
+        declOS << "SH_STARTUP ";
+      moduleGen.nativeFunctionTable.generateFunctionLabel(&F, declOS);
+      declOS << "(SHRuntime *shr);\n";
+    }
+
+    if (split) {
+      for (hermes::sh::LineDirectiveEmitter *unit : units) {
+        *unit << "#include \"";
+        unit->write_escaped(headerName);
+        *unit << "\"\n";
+      }
     }
   }
 
-  for (auto &F : *M)
-    generateFunction(F, OS, moduleGen, scopeAnalysis, nextCacheIdx, options);
+  std::vector<Function *> functions = layoutFunctions(M);
+  std::vector<size_t> unitOf = split
+      ? partitionFunctions(functions, units.size())
+      : std::vector<size_t>(functions.size(), 0);
+  if (options.numJobs > 1) {
+    // Register allocation is the most expensive per-function step and does
+    // not depend on other functions, so do it in parallel up front. The rest
+    // of code generation updates module-wide tables and stays serial, in
+    // order, which keeps the output deterministic.
+    std::vector<AllocatedFunction> allocated =
+        allocateFunctions(functions, options.numJobs);
+    for (size_t i = 0, e = functions.size(); i < e; ++i) {
+      generateFunction(
+          *functions[i],
+          allocated[i],
+          *units[unitOf[i]],
+          moduleGen,
+          scopeAnalysis,
+          nextCacheIdx,
+          options);
+      // Free the allocation as soon as the function has been emitted.
+      allocated[i] = AllocatedFunction{};
+    }
+  } else {
+    for (size_t i = 0, e = functions.size(); i < e; ++i) {
+      AllocatedFunction allocated = allocateFunction(functions[i]);
+      generateFunction(
+          *functions[i],
+          allocated,
+          *units[unitOf[i]],
+          moduleGen,
+          scopeAnalysis,
+          nextCacheIdx,
+          options);
+    }
+  }
 
   if (options.format == DumpBytecode || options.format == EmitBundle) {
+    const char *storage = split ? "" : "static ";
     moduleGen.literalBuffers.generate(OS);
     moduleGen.objectLiteralClassCache.generate(OS);
     moduleGen.srcLocationTable.generate(
         OS, M->getContext().getSourceErrorManager());
-    moduleGen.nativeFunctionTable.generate(OS);
+    moduleGen.nativeFunctionTable.generate(OS, storage);
+    if (moduleGen.profileSiteTable.size())
+      moduleGen.profileSiteTable.generate(OS);
     // String table should be generated last, because the generate calls to
     // other module components may add new entries to the string table.
-    moduleGen.stringTable.generate(OS);
+    moduleGen.stringTable.generate(OS, storage);
 
-    OS << "static SHPropertyCacheEntry s_prop_cache[" << nextCacheIdx << "];\n"
+    OS << storage << "SHPropertyCacheEntry s_prop_cache[" << nextCacheIdx
+       << "];\n"
        << "SHUnit THIS_UNIT = { .num_symbols = " << moduleGen.stringTable.size()
        << ", .num_prop_cache_entries = " << nextCacheIdx
        << ", .ascii_pool = s_ascii_pool, .u16_pool = s_u16_pool,"
@@ -2676,15 +3018,29 @@ static SHNativeFuncInfo s_function_info_table[];
        << ".source_locations = s_source_locations, "
        << ".source_locations_size = " << moduleGen.srcLocationTable.size()
        << ", "
-       << ".unit_main = _0_global, "
-       << ".unit_main_info = &s_function_info_table[0], "
+       << ".unit_main = ";
+    moduleGen.nativeFunctionTable.generateFunctionLabel(topLevelFunc, OS);
+    OS << ", ";
+    if (moduleGen.profileSiteTable.size()) {
+      OS << ".num_profile_sites = " << moduleGen.profileSiteTable.size()
+         << ", .profile_sites = s_profile_sites, "
+         << ".profile_counts = s_profile_counts, "
+         << ".profile_order = s_profile_order, ";
+    }
+    OS << ".unit_main_info = &s_function_info_table[0], "
        << ".unit_name = \"sh_compiled\" };\n";
     if (options.emitMain) {
       OS << R"(
 int main(int argc, char **argv) {
   SHRuntime *shr = _sh_init(argc, argv);
   bool success = _sh_initialize_units(shr, 1, &THIS_UNIT);
-  _sh_done(shr);
+)";
+      if (!options.profileGenerateFile.empty()) {
+        OS << "  _sh_write_profile(shr, \"";
+        OS.write_escaped(options.profileGenerateFile);
+        OS << "\");\n";
+      }
+      OS << R"(  _sh_done(shr);
   return success ? 0 : 1;
 }
 )";
@@ -2699,5 +3055,21 @@ void sh::generateSH(
     llvh::raw_ostream &OS,
     const BytecodeGenerationOptions &options) {
   LineDirectiveEmitter emitter{OS};
-  generateModule(M, emitter, options);
+  LineDirectiveEmitter *units[] = {&emitter};
+  generateModule(M, units, nullptr, {}, options);
+}
+
+void sh::generateSHSplit(
+    Module *M,
+    llvh::raw_ostream &header,
+    llvh::StringRef headerName,
+    llvh::ArrayRef<llvh::raw_ostream *> units,
+    const BytecodeGenerationOptions &options) {
+  std::vector<std::unique_ptr<LineDirectiveEmitter>> emitters{};
+  std::vector<LineDirectiveEmitter *> emitterPtrs{};
+  for (llvh::raw_ostream *unit : units) {
+    emitters.push_back(std::make_unique<LineDirectiveEmitter>(*unit));
+    emitterPtrs.push_back(emitters.back().get());
+  }
+  generateModule(M, emitterPtrs, &header, headerName, options);
 }
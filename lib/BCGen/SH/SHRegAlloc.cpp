@@ -10,6 +10,7 @@
 #include "hermes/IR/CFG.h"
 #include "hermes/IR/IRBuilder.h"
 #include "hermes/Support/PerfSection.h"
+#include "hermes/Support/Statistic.h"
 #include "hermes/Utils/Dumper.h"
 
 #include "llvh/Support/Debug.h"
@@ -21,6 +22,10 @@
 
 #define DEBUG_TYPE "regalloc"
 
+STATISTIC(NumRegsAllocated, "Number of frame registers allocated");
+STATISTIC(NumHintedAllocs, "Number of intervals that took a hinted register");
+STATISTIC(NumHoleAllocs, "Number of intervals placed in a lifetime hole");
+
 namespace hermes::sh {
 
 bool RegisterFile::isUsed(Register r) {
@@ -614,114 +619,204 @@ void RegisterAllocator::allocate(ArrayRef<BasicBlock *> order) {
 
   coalesce(coalesced, order);
 
-  // Compare two intervals and return the one that starts first.
-  auto startsFirst = [&](unsigned a, unsigned b) {
-    Interval &IA = instructionInterval_[a];
-    Interval &IB = instructionInterval_[b];
-    return IA.start() < IB.start() || (IA.start() == IB.start() && a < b);
-  };
-
-  // Compare two intervals and return the one that starts first. If two
-  // intervals end at the same place, schedule the instruction before the
-  // operands.
-
-  auto endsFirst = [&](unsigned a, unsigned b) {
-    auto &aInterval = instructionInterval_[a];
-    auto &bInterval = instructionInterval_[b];
-    if (bInterval.end() == aInterval.end()) {
-      return bInterval.start() > aInterval.start() ||
-          (bInterval.start() == aInterval.start() && b > a);
-    }
-    return bInterval.end() > aInterval.end();
-  };
-
-  using InstList = llvh::SmallVector<unsigned, 32>;
+  allocateLinearScan(coalesced);
 
-  std::priority_queue<unsigned, InstList, decltype(endsFirst)> intervals(
-      endsFirst);
+  // Allocate registers for the coalesced registers.
+  for (auto &RP : coalesced) {
+    assert(!isAllocated(RP.first) && "Register should not be allocated");
+    Instruction *dest = RP.second;
+    updateRegister(RP.first, getRegister(dest));
+  }
+}
 
-  for (int i = 0, e = getMaxInstrIndex(); i < e; i++) {
-    intervals.push(i);
+void RegisterAllocator::allocateLinearScan(
+    const llvh::DenseMap<Instruction *, Instruction *> &coalesced) {
+  unsigned numInsts = getMaxInstrIndex();
+
+  // Collect the instructions that own an interval (everything that was not
+  // merged into another interval) and cache the interval bounds.
+  llvh::SmallVector<unsigned, 32> worklist;
+  llvh::SmallVector<size_t, 32> starts(numInsts);
+  llvh::SmallVector<size_t, 32> ends(numInsts);
+  for (unsigned i = 0; i < numInsts; ++i) {
+    if (coalesced.count(instructionsByNumbers_[i]))
+      continue;
+    worklist.push_back(i);
+    starts[i] = instructionInterval_[i].start();
+    ends[i] = instructionInterval_[i].end();
   }
 
-  std::priority_queue<unsigned, InstList, decltype(startsFirst)>
-      liveIntervalsQueue(startsFirst);
+  // Visit the intervals in the order in which they start. Ties are broken by
+  // the instruction number to make the allocation deterministic.
+  std::sort(worklist.begin(), worklist.end(), [&](unsigned a, unsigned b) {
+    return starts[a] < starts[b] || (starts[a] == starts[b] && a < b);
+  });
+
+  // Map each interval root to the instructions that were coalesced into it,
+  // so that MOVs anywhere in the merged interval can contribute hints.
+  llvh::DenseMap<Instruction *, llvh::SmallVector<Instruction *, 2>> members;
+  for (auto &RP : coalesced)
+    members[RP.second].push_back(RP.first);
+
+  /// The allocation state of a single register class.
+  struct ClassState {
+    /// The registers handed out by the scan, indexed by slot.
+    llvh::SmallVector<Register, 16> regs{};
+    /// The union of the intervals assigned to each slot.
+    llvh::SmallVector<Interval, 16> occupied{};
+    /// The end of the occupied interval of each slot.
+    llvh::SmallVector<size_t, 16> occupiedEnd{};
+    /// Slots whose occupied interval ends before the current position.
+    llvh::BitVector free{};
+    /// Busy slots ordered by the end of their occupied interval. Entries whose
+    /// end no longer matches occupiedEnd are stale and skipped.
+    std::priority_queue<
+        std::pair<size_t, unsigned>,
+        std::vector<std::pair<size_t, unsigned>>,
+        std::greater<std::pair<size_t, unsigned>>>
+        busy{};
+    /// Maps a register back to its slot.
+    llvh::DenseMap<Register, unsigned> slotOf{};
+  };
+  ClassState classes[(size_t)RegClass::_last];
+
+  // The number of busy slots that we are willing to probe for a lifetime hole
+  // before growing the frame. This bounds the compile time on huge functions.
+  static constexpr unsigned kMaxHoleProbes = 32;
+
+  // Finds the register of the interval that contains \p V, if it has already
+  // been assigned.
+  auto assignedRegister = [&](Value *V) -> OptValue<Register> {
+    auto *I = llvh::dyn_cast<Instruction>(V);
+    if (!I)
+      return llvh::None;
+    if (auto it = coalesced.find(I); it != coalesced.end())
+      I = it->second;
+    return getOptionalRegister(I);
+  };
+
+  // Collect the registers that would turn a MOV into or out of the interval
+  // owned by \p inst into a no-op.
+  auto collectHints = [&](Instruction *inst,
+                          llvh::SmallVectorImpl<Register> &hints) {
+    auto visit = [&](Instruction *I) {
+      if (auto *mov = llvh::dyn_cast<MovInst>(I)) {
+        if (auto R = assignedRegister(mov->getSingleOperand()))
+          hints.push_back(*R);
+      }
+      for (auto *U : I->getUsers()) {
+        if (llvh::isa<MovInst>(U) || llvh::isa<PhiInst>(U)) {
+          if (auto R = assignedRegister(U))
+            hints.push_back(*R);
+        }
+      }
+    };
+    visit(inst);
+    if (auto it = members.find(inst); it != members.end()) {
+      for (auto *I : it->second)
+        visit(I);
+    }
+  };
 
-  // Perform the register allocation:
-  while (!intervals.empty()) {
-    unsigned instIdx = intervals.top();
-    intervals.pop();
+  llvh::SmallVector<Register, 4> hints;
+  llvh::SmallVector<Register, 4> preallocated;
+  for (unsigned instIdx : worklist) {
     Instruction *inst = instructionsByNumbers_[instIdx];
     Interval &instInterval = instructionInterval_[instIdx];
-    unsigned currentIndex = instInterval.end();
 
     LLVM_DEBUG(
-        llvh::dbgs() << "Looking at index " << currentIndex << ": "
+        llvh::dbgs() << "Looking at index " << starts[instIdx] << ": "
                      << instInterval << " " << inst->getName() << "\n");
 
-    // Free all of the intervals that start after the current index.
-    while (!liveIntervalsQueue.empty()) {
-      LLVM_DEBUG(
-          llvh::dbgs() << "\t Cleaning up for index " << currentIndex << " PQ("
-                       << liveIntervalsQueue.size() << ")\n");
+    // Intervals that were assigned before the allocation (for example by
+    // reserve()) keep their register.
+    if (isAllocated(inst)) {
+      preallocated.push_back(getRegister(inst));
+      continue;
+    }
+
+    ClassState &CS = classes[(size_t)getRegClass(inst)];
 
-      unsigned topIdx = liveIntervalsQueue.top();
-      Interval &range = instructionInterval_[topIdx];
-      LLVM_DEBUG(llvh::dbgs() << "\t Earliest interval: " << range << "\n");
+    // Expire the slots whose intervals ended before this one starts.
+    while (!CS.busy.empty() && CS.busy.top().first <= starts[instIdx]) {
+      auto [end, slot] = CS.busy.top();
+      CS.busy.pop();
+      if (CS.occupiedEnd[slot] == end)
+        CS.free.set(slot);
+    }
 
-      // Flush empty intervals and intervals that finished after our index.
-      bool nonEmptyInterval = range.size();
-      if (range.start() < currentIndex && nonEmptyInterval) {
+    auto fits = [&](unsigned slot) {
+      return CS.free.test(slot) || !CS.occupied[slot].intersects(instInterval);
+    };
+
+    // Prefer a register that lets a MOV be elided, then the lowest free
+    // register, then a lifetime hole in a busy register. Only grow the frame
+    // if all of these fail.
+    OptValue<unsigned> chosen{};
+    hints.clear();
+    collectHints(inst, hints);
+    for (Register hint : hints) {
+      auto it = CS.slotOf.find(hint);
+      if (it != CS.slotOf.end() && fits(it->second)) {
+        chosen = it->second;
+        ++NumHintedAllocs;
         break;
       }
-
-      liveIntervalsQueue.pop();
-
-      Instruction *I = instructionsByNumbers_[topIdx];
-      Register R = getRegister(I);
-      LLVM_DEBUG(
-          llvh::dbgs() << "\t Reached idx #" << currentIndex
-                       << " deleting inverval " << range
-                       << " that's allocated to register " << R
-                       << " used by instruction " << I->getName() << "\n");
-      file.killRegister(R);
-
-      handleInstruction(I);
     }
-
-    // Don't try to allocate registers that were merged into other live
-    // intervals.
-    if (coalesced.count(inst)) {
-      continue;
+    if (!chosen) {
+      int slot = CS.free.find_first();
+      if (slot >= 0)
+        chosen = (unsigned)slot;
     }
-
-    // Allocate a register for the live interval that we are currently handling.
-    if (!isAllocated(inst)) {
+    if (!chosen) {
+      unsigned probes = 0;
+      for (unsigned slot = 0, e = CS.regs.size();
+           slot < e && probes < kMaxHoleProbes;
+           ++slot, ++probes) {
+        if (fits(slot)) {
+          chosen = slot;
+          ++NumHoleAllocs;
+          break;
+        }
+      }
+    }
+    if (!chosen) {
+      // All slots are kept busy in the register file during the scan, so this
+      // always creates a new register.
       Register R = allocateInstruction(inst);
-      updateRegister(inst, R);
+      chosen = (unsigned)CS.regs.size();
+      CS.regs.push_back(R);
+      CS.occupied.emplace_back();
+      CS.occupiedEnd.push_back(0);
+      CS.free.resize(CS.regs.size(), true);
+      CS.slotOf[R] = *chosen;
+      ++NumRegsAllocated;
     }
 
-    // Mark the current instruction as live and remember to perform target
-    // specific calls when we are done with the bundle.
-    liveIntervalsQueue.push(instIdx);
-  } // For each instruction in the function.
-
-  // Free the remaining intervals.
-  while (!liveIntervalsQueue.empty()) {
-    Instruction *I = instructionsByNumbers_[liveIntervalsQueue.top()];
-    LLVM_DEBUG(
-        llvh::dbgs() << "Free register used by instruction " << I->getName()
-                     << "\n");
-    file.killRegister(getRegister(I));
-    handleInstruction(I);
-    liveIntervalsQueue.pop();
+    // A slot that was free has no live entry in the busy queue, and a busy
+    // slot whose end moved has a stale one, so both need a new entry.
+    unsigned slot = *chosen;
+    bool wasFree = CS.free.test(slot);
+    CS.free.reset(slot);
+    CS.occupied[slot].add(instInterval);
+    if (wasFree || ends[instIdx] > CS.occupiedEnd[slot]) {
+      CS.occupiedEnd[slot] = std::max(CS.occupiedEnd[slot], ends[instIdx]);
+      CS.busy.push({CS.occupiedEnd[slot], slot});
+    }
+    updateRegister(inst, CS.regs[slot]);
   }
 
-  // Allocate registers for the coalesced registers.
-  for (auto &RP : coalesced) {
-    assert(!isAllocated(RP.first) && "Register should not be allocated");
-    Instruction *dest = RP.second;
-    updateRegister(RP.first, getRegister(dest));
+  // Release all registers and notify the target about every interval that
+  // owns a register.
+  for (unsigned instIdx : worklist)
+    handleInstruction(instructionsByNumbers_[instIdx]);
+  for (auto &CS : classes) {
+    for (Register R : CS.regs)
+      file.killRegister(R);
+  }
+  for (Register R : preallocated) {
+    if (file.isUsed(R))
+      file.killRegister(R);
   }
 }
 
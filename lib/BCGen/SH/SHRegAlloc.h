@@ -378,6 +378,14 @@ class RegisterAllocator {
       llvh::DenseMap<Instruction *, Instruction *> &map,
       llvh::ArrayRef<BasicBlock *> order);
 
+  /// Assign registers to the live intervals with a linear scan over their
+  /// start points. An interval prefers a register that turns a MOV into a
+  /// no-op, then the lowest free register, then a lifetime hole in a register
+  /// that is still live. Intervals that were merged into other intervals in
+  /// \p coalesced are skipped.
+  void allocateLinearScan(
+      const llvh::DenseMap<Instruction *, Instruction *> &coalesced);
+
  protected:
   /// Keeps track of the already allocated values.
   llvh::DenseMap<Value *, Register> allocated{};
@@ -17,6 +17,7 @@
 #include "hermes/BCGen/SH/SH.h"
 #include "hermes/ConsoleHost/ConsoleHost.h"
 #include "hermes/IR/Analysis.h"
+#include "hermes/IR/ExecutionProfile.h"
 #include "hermes/IR/IR.h"
 #include "hermes/IR/IRBuilder.h"
 #include "hermes/IR/IRVerifier.h"
@@ -53,6 +54,7 @@
 #include "zip/src/zip.h"
 
 #include <sstream>
+#include <thread>
 
 #define DEBUG_TYPE "hermes"
 
@@ -452,6 +454,15 @@ static opt<bool> ParseTS(
     cat(CompilerCategory));
 #endif
 
+static opt<unsigned> ParseJobs(
+    "parse-jobs",
+    desc(
+        "Number of threads used to parse a large input file "
+        "(0 means one per hardware thread)"),
+    value_desc("N"),
+    init(1),
+    cat(CompilerCategory));
+
 static CLFlag StaticRequire(
     'f',
     "static-require",
@@ -504,6 +515,14 @@ static opt<bool> ReusePropCache(
 static CLFlag
     Inline('f', "inline", true, "inlining of functions", CompilerCategory);
 
+static opt<std::string> ProfileUse(
+    "profile-use",
+    desc(
+        "Use the execution profile in the given file to guide inlining and "
+        "function layout"),
+    llvh::cl::value_desc("filename"),
+    cat(CompilerCategory));
+
 static CLFlag StripFunctionNames(
     'f',
     "strip-function-names",
@@ -1103,6 +1122,10 @@ std::shared_ptr<Context> createContext(
   }
 #endif
 
+  context->setParseJobs(
+      cl::ParseJobs ? (unsigned)cl::ParseJobs
+                    : std::max(1u, std::thread::hardware_concurrency()));
+
   if (cl::DebugInfoLevel >= cl::DebugLevel::g3) {
     context->setDebugInfoSetting(DebugInfoSetting::ALL);
   } else if (cl::DebugInfoLevel == cl::DebugLevel::g2) {
@@ -1112,6 +1135,19 @@ std::shared_ptr<Context> createContext(
     context->setDebugInfoSetting(DebugInfoSetting::THROWING);
   }
   context->setEmitAsyncBreakCheck(cl::EmitAsyncBreakCheck);
+
+  if (!cl::ProfileUse.empty()) {
+    std::unique_ptr<llvh::MemoryBuffer> profileBuf =
+        memoryBufferFromFile(cl::ProfileUse);
+    if (!profileBuf)
+      return nullptr;
+    std::shared_ptr<ExecutionProfile> profile = ExecutionProfile::parse(
+        std::move(profileBuf), context->getSourceErrorManager());
+    if (!profile)
+      return nullptr;
+    context->setExecutionProfile(std::move(profile));
+  }
+
   return context;
 }
 
@@ -2180,6 +2216,8 @@ CompileResult compileFromCommandLineOptions() {
   } else {
     std::shared_ptr<Context> context =
         createContext(std::move(resolutionTable), std::move(segments));
+    if (!context)
+      return InputFileError;
     return processSourceFiles(context, std::move(fileBufs));
   }
 }
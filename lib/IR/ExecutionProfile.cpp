@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "hermes/IR/ExecutionProfile.h"
+
+#include "hermes/AST/Context.h"
+#include "hermes/IR/Instrs.h"
+#include "hermes/Parser/JSONParser.h"
+
+using namespace hermes::parser;
+
+namespace hermes {
+
+/// Parse the array of sites \p sites into \p map, summing the counts of
+/// duplicate locations.
+/// \return false if the array is malformed.
+template <typename Map>
+static bool parseSites(const JSONArray *sites, Map &map) {
+  for (const JSONValue *val : *sites) {
+    auto *site = llvh::dyn_cast<JSONObject>(val);
+    if (!site)
+      return false;
+    auto *file = llvh::dyn_cast_or_null<JSONString>(site->get("file"));
+    auto *line = llvh::dyn_cast_or_null<JSONNumber>(site->get("line"));
+    auto *column = llvh::dyn_cast_or_null<JSONNumber>(site->get("column"));
+    auto *count = llvh::dyn_cast_or_null<JSONNumber>(site->get("count"));
+    if (!file || !line || !column || !count)
+      return false;
+    // The order and the startup flag are optional.
+    auto *order = llvh::dyn_cast_or_null<JSONNumber>(site->get("order"));
+    auto *startup = llvh::dyn_cast_or_null<JSONBoolean>(site->get("startup"));
+
+    auto &counts = map[{file->str().str(),
+                        (uint32_t)line->getValue(),
+                        (uint32_t)column->getValue()}];
+    counts.count += (uint64_t)count->getValue();
+    if (order && order->getValue() != 0) {
+      uint64_t siteOrder = (uint64_t)order->getValue();
+      if (counts.order == 0 || siteOrder < counts.order)
+        counts.order = siteOrder;
+    }
+    if (startup && startup->getValue())
+      counts.startup = true;
+  }
+  return true;
+}
+
+std::shared_ptr<ExecutionProfile> ExecutionProfile::parse(
+    std::unique_ptr<llvh::MemoryBuffer> buf,
+    SourceErrorManager &sm) {
+  // The buffer is owned by the SourceErrorManager after this.
+  SMLoc genericLoc = SMLoc::getFromPointer(buf->getBufferStart());
+
+  JSLexer::Allocator alloc{};
+  JSONFactory factory(alloc);
+  JSONParser jsonParser(factory, std::move(buf), sm);
+
+  llvh::Optional<JSONValue *> parsed = jsonParser.parse();
+  if (!parsed.hasValue()) {
+    // This does not need an error since `parse` should have emitted one.
+    return nullptr;
+  }
+
+  auto *json = llvh::dyn_cast_or_null<JSONObject>(parsed.getValue());
+  if (json == nullptr) {
+    sm.error(genericLoc, "Expected an execution profile object");
+    return nullptr;
+  }
+
+  auto *version = llvh::dyn_cast_or_null<JSONNumber>(json->get("version"));
+  if (version == nullptr || (uint32_t)version->getValue() != kVersion) {
+    sm.error(genericLoc, "Unsupported execution profile version");
+    return nullptr;
+  }
+
+  auto profile = std::make_shared<ExecutionProfile>();
+
+  auto *functions = llvh::dyn_cast_or_null<JSONArray>(json->get("functions"));
+  if (functions == nullptr || !parseSites(functions, profile->functions_)) {
+    sm.error(genericLoc, "Malformed 'functions' in execution profile");
+    return nullptr;
+  }
+  auto *callSites = llvh::dyn_cast_or_null<JSONArray>(json->get("callsites"));
+  if (callSites == nullptr || !parseSites(callSites, profile->callSites_)) {
+    sm.error(genericLoc, "Malformed 'callsites' in execution profile");
+    return nullptr;
+  }
+
+  // Call sites are considered hot relative to the hottest one, so that the
+  // threshold scales with the length of the profiling run.
+  uint64_t maxCount = 0;
+  for (const auto &entry : profile->callSites_)
+    maxCount = std::max(maxCount, entry.second.count);
+  profile->hotThreshold_ =
+      std::max(kMinHotCount, maxCount / kHotCountDivisor);
+
+  return profile;
+}
+
+const ExecutionProfile::Counts *
+ExecutionProfile::lookup(const SiteMap &map, Module *M, SMLoc loc) {
+  if (!loc.isValid())
+    return nullptr;
+  SourceErrorManager &sm = M->getContext().getSourceErrorManager();
+  SourceErrorManager::SourceCoords coords;
+  if (!sm.findBufferLineAndLoc(loc, coords))
+    return nullptr;
+  auto it = map.find(
+      {sm.getSourceUrl(coords.bufId).str(), coords.line, coords.col});
+  return it != map.end() ? &it->second : nullptr;
+}
+
+const ExecutionProfile::Counts *ExecutionProfile::getFunction(
+    Function *F) const {
+  return lookup(functions_, F->getParent(), F->getSourceRange().Start);
+}
+
+const ExecutionProfile::Counts *ExecutionProfile::getCallSite(
+    BaseCallInst *CI) const {
+  return lookup(
+      callSites_, CI->getParent()->getParent()->getParent(), CI->getLocation());
+}
+
+} // namespace hermes
@@ -917,6 +917,17 @@ HBCReifyArgumentsStrictInst *IRBuilder::createHBCReifyArgumentsStrictInst(
   insert(inst);
   return inst;
 }
+HBCApplyArgumentsInst *IRBuilder::createHBCApplyArgumentsInst(
+    Value *callee,
+    Value *target,
+    Value *thisArg,
+    AllocStackInst *lazyReg,
+    bool isStrict) {
+  auto inst = new HBCApplyArgumentsInst(
+      callee, target, thisArg, lazyReg, getLiteralBool(isStrict));
+  insert(inst);
+  return inst;
+}
 CreateThisInst *IRBuilder::createCreateThisInst(
     Value *prototype,
     Value *closure) {
@@ -884,6 +884,15 @@ void Verifier::visitHBCReifyArgumentsStrictInst(
     const HBCReifyArgumentsStrictInst &Inst) {
   // Nothing to verify at this point.
 }
+void Verifier::visitHBCApplyArgumentsInst(const HBCApplyArgumentsInst &Inst) {
+  Assert(
+      llvh::isa<AllocStackInst>(Inst.getLazyRegister()),
+      "HBCApplyArgumentsInst lazy register must be an AllocStackInst");
+  Assert(
+      llvh::isa<LiteralBool>(
+          Inst.getOperand(HBCApplyArgumentsInst::IsStrictIdx)),
+      "HBCApplyArgumentsInst::IsStrict must be a LiteralBool");
+}
 void Verifier::visitCreateThisInst(const CreateThisInst &Inst) {}
 void Verifier::visitGetConstructedObjectInst(
     const GetConstructedObjectInst &Inst) {}
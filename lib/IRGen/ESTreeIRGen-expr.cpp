@@ -659,6 +659,15 @@ Value *ESTreeIRGen::genSHBuiltinExternC(ESTree::CallExpressionNode *call) {
   return Builder.getLiteralNativeExtern(nativeExtern);
 }
 
+/// \return the spread element if it is the only element of \p args, as in
+///   `fn(...args)`, nullptr otherwise.
+static ESTree::SpreadElementNode *getSoleSpreadArgument(
+    ESTree::NodeList &args) {
+  if (args.size() != 1)
+    return nullptr;
+  return llvh::dyn_cast<ESTree::SpreadElementNode>(&args.front());
+}
+
 Value *ESTreeIRGen::emitCall(
     ESTree::CallExpressionLikeNode *call,
     Value *callee,
@@ -690,6 +699,13 @@ Value *ESTreeIRGen::emitCall(
 
   // Otherwise, there exists a spread argument, so the number of arguments
   // is variable.
+  // A lone spread argument, as in `fn(...args)`, is passed to
+  // HermesBuiltin.applySpread, which avoids copying arrays twice.
+  if (auto *spread = getSoleSpreadArgument(getArguments(call))) {
+    return genBuiltinCall(
+        BuiltinMethod::HermesBuiltin_applySpread,
+        {callee, genExpression(spread->_argument), thisVal});
+  }
   // Generate IR for this by creating an array and populating it with the
   // arguments, then calling HermesInternal.apply.
   auto *args = genArrayFromElements(getArguments(call));
@@ -2102,6 +2118,11 @@ Value *ESTreeIRGen::genNewExpr(ESTree::NewExpressionNode *N) {
 
   // Otherwise, there exists a spread argument, so the number of arguments
   // is variable.
+  if (auto *spread = getSoleSpreadArgument(N->_arguments)) {
+    return genBuiltinCall(
+        BuiltinMethod::HermesBuiltin_applySpread,
+        {callee, genExpression(spread->_argument)});
+  }
   // Generate IR for this by creating an array and populating it with the
   // arguments, then calling HermesInternal.apply.
   auto *args = genArrayFromElements(N->_arguments);
@@ -109,23 +109,34 @@
   }
 
   function handleResolved(self, deferred) {
-    (useEngineQueue ? HermesInternal.enqueueJob : setImmediate)(function() {
-      var cb = self._i === 1 ? deferred.onFulfilled : deferred.onRejected;
-      if (cb === null) {
-        if (self._i === 1) {
-          resolve(deferred.promise, self._j);
-        } else {
-          reject(deferred.promise, self._j);
-        }
-        return;
-      }
-      var ret = tryCallOne(cb, self._j);
-      if (ret === IS_ERROR) {
-        reject(deferred.promise, LAST_ERROR);
+    deferred.source = self;
+    if (useEngineQueue) {
+      // The engine queue passes the handler to the job, so that no closure is
+      // allocated per reaction.
+      HermesInternal.enqueueJob(runReaction, deferred);
+    } else {
+      setImmediate(function() {
+        runReaction(deferred);
+      });
+    }
+  }
+  function runReaction(deferred) {
+    var self = deferred.source;
+    var cb = self._i === 1 ? deferred.onFulfilled : deferred.onRejected;
+    if (cb === null) {
+      if (self._i === 1) {
+        resolve(deferred.promise, self._j);
       } else {
-        resolve(deferred.promise, ret);
+        reject(deferred.promise, self._j);
       }
-    });
+      return;
+    }
+    var ret = tryCallOne(cb, self._j);
+    if (ret === IS_ERROR) {
+      reject(deferred.promise, LAST_ERROR);
+    } else {
+      resolve(deferred.promise, ret);
+    }
   }
   function resolve(self, newValue) {
     // Promise Resolution Procedure: https://github.com/promises-aplus/promises-spec#the-promise-resolution-procedure
@@ -186,6 +197,8 @@
     this.onFulfilled = typeof onFulfilled === 'function' ? onFulfilled : null;
     this.onRejected = typeof onRejected === 'function' ? onRejected : null;
     this.promise = promise;
+    // The settled promise, set when the reaction is scheduled.
+    this.source = null;
   }
 
   /**
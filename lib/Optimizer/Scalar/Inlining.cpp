@@ -9,19 +9,36 @@
 #include "hermes/Optimizer/Scalar/Inlining.h"
 
 #include "hermes/IR/CFG.h"
+#include "hermes/IR/ExecutionProfile.h"
 #include "hermes/IR/IRBuilder.h"
 #include "hermes/Optimizer/Scalar/Utils.h"
 #include "hermes/Support/Statistic.h"
 
 #include "llvh/ADT/DenseSet.h"
+#include "llvh/ADT/STLExtras.h"
 #include "llvh/ADT/SetVector.h"
 #include "llvh/ADT/SmallVector.h"
 #include "llvh/Support/Debug.h"
 
 STATISTIC(NumInlinedCalls, "Number of inlined calls");
+STATISTIC(NumHotInlinedCalls, "Number of calls inlined because they are hot");
+STATISTIC(NumColdCallsSkipped, "Number of cold calls not inlined");
 
 namespace hermes {
 
+/// When an execution profile is available, functions with more than one call
+/// site are inlined into their hot call sites if they contain at most this
+/// many instructions.
+static constexpr unsigned kMaxHotInlineInstructions = 64;
+
+/// \return the number of instructions in \p F.
+static unsigned countInstructions(Function *F) {
+  unsigned count = 0;
+  for (BasicBlock &BB : *F)
+    count += BB.getInstList().size();
+  return count;
+}
+
 /// Generate a list of basic blocks in simple depth-first-search order.
 static llvh::SmallSetVector<BasicBlock *, 4> orderDFS(Function *F) {
   llvh::SmallSetVector<BasicBlock *, 4> order{};
@@ -425,6 +442,8 @@ bool Inlining::runOnModule(Module *M) {
 
   bool changed = false;
 
+  const ExecutionProfile *profile = M->getContext().getExecutionProfile();
+
   std::vector<Function *> functionOrder = orderFunctions(M);
 
   for (Function *FC : functionOrder) {
@@ -433,6 +452,8 @@ bool Inlining::runOnModule(Module *M) {
                      << "'\n");
 
     llvh::SmallVector<BaseCallInst *, 2> callsites;
+    // Whether the call sites were selected by the execution profile.
+    bool hotCallsites = false;
 
     if (FC->getAlwaysInline()) {
       callsites = getKnownCallsites(FC);
@@ -440,10 +461,12 @@ bool Inlining::runOnModule(Module *M) {
       // Heuristic to determine whether to inline.
       // Applied when the "inline" directive isn't specified.
 
-      // Check for allCallsitesKnownExceptErrorStructuredStackTrace here because
-      // we're only ever inlining functions with one callsites right now, which
-      // means that the function will be DCE'd completely and it won't ever be
-      // populated in the structured stack trace at runtime.
+      // Check for allCallsitesKnownExceptErrorStructuredStackTrace here
+      // because the structured stack trace is the only unknown use it allows.
+      // A function with one callsite is DCE'd completely after inlining, so
+      // it never shows up there. When the profile lets us inline into several
+      // hot callsites, the function survives for its other callsites, and only
+      // the inlined calls are missing from structured stack traces.
       // This allows us to inline loose mode functions.
       if (!FC->allCallsitesKnownExceptErrorStructuredStackTrace()) {
         LLVM_DEBUG(
@@ -456,13 +479,43 @@ bool Inlining::runOnModule(Module *M) {
       callsites = getKnownCallsites(FC);
 
       if (callsites.size() != 1) {
-        LLVM_DEBUG(
-            llvh::dbgs() << "Cannot inline function '"
-                         << FC->getInternalNameStr()
-                         << llvh::format(
-                                "': has %u callsites (requires 1)\n",
-                                callsites.size()));
-        continue;
+        if (!profile) {
+          LLVM_DEBUG(
+              llvh::dbgs() << "Cannot inline function '"
+                           << FC->getInternalNameStr()
+                           << llvh::format(
+                                  "': has %u callsites (requires 1)\n",
+                                  callsites.size()));
+          continue;
+        }
+
+        // The profile lets us go beyond the single callsite budget: inline a
+        // small function into the callsites that are executed often, even
+        // though the function itself can't be deleted afterwards.
+        if (countInstructions(FC) > kMaxHotInlineInstructions) {
+          LLVM_DEBUG(
+              llvh::dbgs() << "Cannot inline function '"
+                           << FC->getInternalNameStr()
+                           << "': too large for hot inlining\n");
+          continue;
+        }
+        llvh::erase_if(callsites, [profile](BaseCallInst *CI) {
+          const ExecutionProfile::Counts *counts = profile->getCallSite(CI);
+          return !counts || !profile->isHot(*counts);
+        });
+        hotCallsites = true;
+      } else if (profile) {
+        // Don't grow the caller with code that never ran while profiling.
+        const ExecutionProfile::Counts *counts =
+            profile->getCallSite(callsites[0]);
+        if (counts && ExecutionProfile::isCold(*counts)) {
+          LLVM_DEBUG(
+              llvh::dbgs() << "Not inlining function '"
+                           << FC->getInternalNameStr()
+                           << "': callsite is cold\n");
+          ++NumColdCallsSkipped;
+          continue;
+        }
       }
     }
 
@@ -512,6 +565,8 @@ bool Inlining::runOnModule(Module *M) {
       CI->eraseFromParent();
 
       ++NumInlinedCalls;
+      if (hotCallsites)
+        ++NumHotInlinedCalls;
       changed = true;
     }
   }
@@ -525,6 +525,9 @@ class TypeInferenceImpl {
     // Does not return a value, uses a lazy register instead.
     return Type::createNoType();
   }
+  Type inferHBCApplyArgumentsInst(HBCApplyArgumentsInst *inst) {
+    return Type::createAnyType();
+  }
   Type inferHBCSpillMovInst(HBCSpillMovInst *inst) {
     return inst->getSingleOperand()->getType();
   }
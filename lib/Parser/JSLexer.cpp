@@ -14,6 +14,14 @@
 #include "llvh/ADT/ScopeExit.h"
 #include "llvh/ADT/StringSwitch.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define HERMES_LEXER_SIMD 1
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define HERMES_LEXER_SIMD 1
+#endif
+
 namespace hermes {
 namespace parser {
 
@@ -33,6 +41,144 @@ inline bool matchUnicodeLineTerminatorOffset1(const char *curCharPtr_) {
       ((unsigned char)curCharPtr_[2] == 0xa8 ||
        (unsigned char)curCharPtr_[2] == 0xa9);
 }
+
+// The skip*Blocks() helpers below step over whole blocks of input which
+// contain nothing the caller has to look at, comparing a block of bytes at a
+// time. They stop at the first block that needs attention, or when fewer than
+// a block's worth of bytes remain before \p end, and leave the rest to the
+// caller's scalar loop. Non-ASCII bytes always need attention, so UTF-8 input
+// is handled entirely by the scalar code.
+
+#ifdef HERMES_LEXER_SIMD
+
+/// Number of bytes compared at once.
+constexpr ptrdiff_t kBlockSize = 16;
+
+#if defined(__SSE2__)
+using Block = __m128i;
+
+inline Block loadBlock(const char *p) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+}
+inline Block eq(Block v, char c) {
+  return _mm_cmpeq_epi8(v, _mm_set1_epi8(c));
+}
+/// Lanes of \p v between ASCII characters \p lo and \p hi inclusive.
+/// Non-ASCII bytes compare as negative, so they are never in range.
+inline Block inRange(Block v, char lo, char hi) {
+  return _mm_and_si128(
+      _mm_cmpgt_epi8(v, _mm_set1_epi8(lo - 1)),
+      _mm_cmplt_epi8(v, _mm_set1_epi8(hi + 1)));
+}
+inline Block toLower(Block v) {
+  return _mm_or_si128(v, _mm_set1_epi8(32));
+}
+inline Block nonASCII(Block v) {
+  return _mm_cmplt_epi8(v, _mm_setzero_si128());
+}
+inline Block either(Block a, Block b) {
+  return _mm_or_si128(a, b);
+}
+inline bool anyLane(Block m) {
+  return _mm_movemask_epi8(m) != 0;
+}
+inline bool allLanes(Block m) {
+  return _mm_movemask_epi8(m) == 0xffff;
+}
+#else
+using Block = uint8x16_t;
+
+inline Block loadBlock(const char *p) {
+  return vld1q_u8(reinterpret_cast<const uint8_t *>(p));
+}
+inline Block eq(Block v, char c) {
+  return vceqq_u8(v, vdupq_n_u8((uint8_t)c));
+}
+/// Lanes of \p v between ASCII characters \p lo and \p hi inclusive.
+inline Block inRange(Block v, char lo, char hi) {
+  return vandq_u8(
+      vcgeq_u8(v, vdupq_n_u8((uint8_t)lo)),
+      vcleq_u8(v, vdupq_n_u8((uint8_t)hi)));
+}
+inline Block toLower(Block v) {
+  return vorrq_u8(v, vdupq_n_u8(32));
+}
+inline Block nonASCII(Block v) {
+  return vcgeq_u8(v, vdupq_n_u8(0x80));
+}
+inline Block either(Block a, Block b) {
+  return vorrq_u8(a, b);
+}
+inline bool anyLane(Block m) {
+  return vmaxvq_u8(m) != 0;
+}
+inline bool allLanes(Block m) {
+  return vminvq_u8(m) == 0xff;
+}
+#endif
+
+/// Step over blocks containing none of \p c0 to \p c3, NUL or non-ASCII
+/// bytes.
+inline const char *skipPlainBlocks(
+    const char *cur,
+    const char *end,
+    char c0,
+    char c1,
+    char c2,
+    char c3) {
+  while (end - cur >= kBlockSize) {
+    Block v = loadBlock(cur);
+    Block special = either(
+        either(either(eq(v, c0), eq(v, c1)), either(eq(v, c2), eq(v, c3))),
+        either(eq(v, 0), nonASCII(v)));
+    if (anyLane(special))
+      break;
+    cur += kBlockSize;
+  }
+  return cur;
+}
+
+/// Step over blocks consisting of ASCII identifier characters, letting
+/// \p extra be part of an identifier too.
+inline const char *
+skipIdentifierBlocks(const char *cur, const char *end, char extra) {
+  while (end - cur >= kBlockSize) {
+    Block v = loadBlock(cur);
+    Block ident = either(
+        either(inRange(toLower(v), 'a', 'z'), inRange(v, '0', '9')),
+        either(either(eq(v, '_'), eq(v, '$')), eq(v, extra)));
+    if (!allLanes(ident))
+      break;
+    cur += kBlockSize;
+  }
+  return cur;
+}
+
+/// Step over blocks consisting of spaces and tabs.
+inline const char *skipWhitespaceBlocks(const char *cur, const char *end) {
+  while (end - cur >= kBlockSize) {
+    Block v = loadBlock(cur);
+    if (!allLanes(either(eq(v, ' '), eq(v, '\t'))))
+      break;
+    cur += kBlockSize;
+  }
+  return cur;
+}
+
+#else
+
+inline const char *
+skipPlainBlocks(const char *cur, const char *, char, char, char, char) {
+  return cur;
+}
+inline const char *skipIdentifierBlocks(const char *cur, const char *, char) {
+  return cur;
+}
+inline const char *skipWhitespaceBlocks(const char *cur, const char *) {
+  return cur;
+}
+
+#endif
 } // namespace
 
 const char *tokenKindStr(TokenKind kind) {
@@ -376,9 +522,9 @@ const Token *JSLexer::advance(GrammarContext grammarContext) {
       case '\t':
       case ' ':
         // Spaces frequently come in groups, so use a tight inner loop to skip.
-        do
+        curCharPtr_ = skipWhitespaceBlocks(curCharPtr_ + 1, bufferEnd_);
+        while (*curCharPtr_ == '\t' || *curCharPtr_ == ' ')
           ++curCharPtr_;
-        while (*curCharPtr_ == '\t' || *curCharPtr_ == ' ');
         continue;
 
       // No-break space \u00A0 is UTF8 encoded as: c2 a0
@@ -825,9 +971,9 @@ bool JSLexer::isCurrentTokenADirective() {
       case '\t':
       case ' ':
         // Spaces frequently come in groups, so use a tight inner loop to skip.
-        do
+        ptr = skipWhitespaceBlocks(ptr + 1, bufferEnd_);
+        while (*ptr == '\t' || *ptr == ' ')
           ++ptr;
-        while (*ptr == '\t' || *ptr == ' ');
         continue;
 
       // No-break space \u00A0 is UTF8 encoded as: c2 a0
@@ -1227,6 +1373,7 @@ llvh::StringRef JSLexer::lineCommentHelper(const char *start) {
   const char *cur = start + 2;
 
   for (;;) {
+    cur = skipPlainBlocks(cur, bufferEnd_, '\n', '\r', '\n', '\r');
     switch ((unsigned char)*cur) {
       case 0:
         if (cur == bufferEnd_) {
@@ -1300,6 +1447,7 @@ const char *JSLexer::skipBlockComment(const char *start) {
   const char *cur = start + 2;
 
   for (;;) {
+    cur = skipPlainBlocks(cur, bufferEnd_, '*', '\n', '\r', '*');
     switch ((unsigned char)*cur) {
       case 0:
         if (cur == bufferEnd_) {
@@ -1661,9 +1809,14 @@ TokenKind JSLexer::scanReservedWord(const char *start, unsigned length) {
 
 template <JSLexer::IdentifierMode Mode>
 void JSLexer::scanIdentifierFastPath(const char *start) {
-  const char *end = start;
+  // Quickly consume the ASCII identifier part, whole blocks at a time first.
+  constexpr char extraIdentChar = Mode == IdentifierMode::JSX
+      ? '-'
+      : Mode == IdentifierMode::Flow ? '@'
+                                     : '_';
+  const char *end =
+      skipIdentifierBlocks(start + 1, bufferEnd_, extraIdentChar) - 1;
 
-  // Quickly consume the ASCII identifier part.
   char ch;
   do
     ch = (unsigned char)*++end;
@@ -1752,6 +1905,15 @@ void JSLexer::scanString() {
   tmpStorage_.clear();
 
   for (;;) {
+    if (!JSX) {
+      // Copy runs of characters which need no processing in bulk.
+      const char *plainEnd = skipPlainBlocks(
+          curCharPtr_, bufferEnd_, quoteCh, '\\', '\n', '\r');
+      if (plainEnd != curCharPtr_) {
+        tmpStorage_.append(curCharPtr_, plainEnd);
+        curCharPtr_ = plainEnd;
+      }
+    }
     if (*curCharPtr_ == quoteCh) {
       ++curCharPtr_;
       break;
@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "JSParserImpl.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace hermes {
+namespace parser {
+namespace detail {
+
+namespace {
+
+/// Buffers smaller than this are always parsed serially.
+constexpr size_t kMinParallelBufferSize = 64 * 1024;
+
+/// The smallest range worth handing to a separate parser.
+constexpr size_t kMinChunkSize = 16 * 1024;
+
+/// Finds the places where a buffer can be split into ranges of top-level
+/// statements, using a private lexer and without building an AST.
+/// Only the start of a statement which follows a semicolon at nesting depth 0
+/// is considered, because such a semicolon can only terminate a statement.
+/// The scan is a heuristic: if it guesses wrong, for example by mistaking a
+/// division for a regexp, parsing one of the ranges fails and the caller falls
+/// back to a serial parse.
+class TopLevelSplitter {
+  /// Diagnostics are only counted, the serial parse reports them.
+  SourceErrorManager sm_{};
+  JSLexer::Allocator allocator_{};
+  StringTable strTab_{allocator_};
+  JSLexer lexer_;
+
+  /// Set if the directive prologue of the program contains "use strict".
+  bool useStrict_{false};
+
+ public:
+  TopLevelSplitter(llvh::MemoryBufferRef input, bool strictMode)
+      : lexer_(input, sm_, allocator_, &strTab_, strictMode) {
+    sm_.setDiagHandler([](const llvh::SMDiagnostic &, void *) {});
+  }
+
+  SourceErrorManager &getSourceErrorManager() {
+    return sm_;
+  }
+  uint32_t getBufferId() {
+    return lexer_.getBufferId();
+  }
+  bool getUseStrict() const {
+    return useStrict_;
+  }
+
+  /// Scan the whole buffer and append to \p splits the start of every
+  /// statement that begins a new range, aiming for ranges of at least
+  /// \p chunkSize bytes.
+  /// \return false if the buffer could not be scanned.
+  bool scan(size_t chunkSize, std::vector<const char *> &splits);
+
+ private:
+  /// \return whether a '/' following a token of kind \p kind starts a
+  /// division rather than a regexp.
+  static bool allowDivAfter(TokenKind kind);
+};
+
+bool TopLevelSplitter::allowDivAfter(TokenKind kind) {
+  switch (kind) {
+    case TokenKind::identifier:
+    case TokenKind::private_identifier:
+    case TokenKind::numeric_literal:
+    case TokenKind::bigint_literal:
+    case TokenKind::string_literal:
+    case TokenKind::regexp_literal:
+    case TokenKind::no_substitution_template:
+    case TokenKind::template_tail:
+    case TokenKind::r_paren:
+    case TokenKind::r_square:
+    case TokenKind::r_brace:
+    case TokenKind::plusplus:
+    case TokenKind::minusminus:
+    case TokenKind::rw_this:
+    case TokenKind::rw_super:
+    case TokenKind::rw_null:
+    case TokenKind::rw_true:
+    case TokenKind::rw_false:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool TopLevelSplitter::scan(
+    size_t chunkSize,
+    std::vector<const char *> &splits) {
+  const Token *tok = lexer_.advance();
+
+  // Recognize "use strict" in the directive prologue, since it changes how
+  // the rest of the program is lexed.
+  while (lexer_.isCurrentTokenADirective()) {
+    if (tok->getStringLiteral()->str() == "use strict") {
+      useStrict_ = true;
+      lexer_.setStrictMode(true);
+    }
+    tok = lexer_.advance(JSLexer::AllowDiv);
+    if (tok->getKind() == TokenKind::semi)
+      tok = lexer_.advance();
+  }
+
+  // Open brackets. True entries are template substitutions, whose closing
+  // brace has to be rescanned as the rest of the template.
+  llvh::SmallVector<bool, 16> nesting{};
+  const char *chunkStart = lexer_.getBufferStart();
+
+  for (;;) {
+    if (sm_.getErrorCount())
+      return false;
+
+    TokenKind kind = tok->getKind();
+    switch (kind) {
+      case TokenKind::eof:
+        return nesting.empty();
+
+      case TokenKind::l_paren:
+      case TokenKind::l_square:
+      case TokenKind::l_brace:
+      case TokenKind::l_bracepipe:
+        nesting.push_back(false);
+        break;
+      case TokenKind::template_head:
+        nesting.push_back(true);
+        break;
+
+      case TokenKind::r_paren:
+      case TokenKind::r_square:
+      case TokenKind::piper_brace:
+        if (nesting.empty() || nesting.back())
+          return false;
+        nesting.pop_back();
+        break;
+
+      case TokenKind::r_brace:
+        if (nesting.empty())
+          return false;
+        if (nesting.back()) {
+          tok = lexer_.rescanRBraceInTemplateLiteral();
+          if (tok->getKind() == TokenKind::template_tail)
+            nesting.pop_back();
+          tok = lexer_.advance(
+              tok->getKind() == TokenKind::template_tail ? JSLexer::AllowDiv
+                                                         : JSLexer::AllowRegExp);
+          continue;
+        }
+        nesting.pop_back();
+        break;
+
+      case TokenKind::semi:
+        if (nesting.empty()) {
+          tok = lexer_.advance();
+          const char *start = tok->getStartLoc().getPointer();
+          // 'else' and 'while' may continue the statement ended by the
+          // semicolon: "if (a) b; else c;" and "do a; while (b);".
+          if ((size_t)(start - chunkStart) >= chunkSize &&
+              tok->getKind() != TokenKind::eof &&
+              tok->getKind() != TokenKind::rw_else &&
+              tok->getKind() != TokenKind::rw_while) {
+            splits.push_back(start);
+            chunkStart = start;
+          }
+          continue;
+        }
+        break;
+
+      default:
+        break;
+    }
+
+    tok = lexer_.advance(
+        allowDivAfter(kind) ? JSLexer::AllowDiv : JSLexer::AllowRegExp);
+  }
+}
+
+/// Replaces the strings referenced by an AST with the equivalent strings of
+/// another string table.
+class ReinternVisitor {
+  StringTable &strTab_;
+
+ public:
+  explicit ReinternVisitor(StringTable &strTab) : strTab_(strTab) {}
+
+  bool shouldVisit(ESTree::Node *) {
+    return true;
+  }
+  void enter(ESTree::Node *) {}
+  void leave(ESTree::Node *) {}
+
+  void reintern(const ESTree::NodeLabel &label) {
+    if (label)
+      const_cast<ESTree::NodeLabel &>(label) = strTab_.getString(label->str());
+  }
+};
+
+/// Found by ADL in preference to the generic overload, which skips labels.
+/// NodeString is the same type, so string values are handled here too.
+void ESTreeVisit(ReinternVisitor &V, const ESTree::NodeLabel &label) {
+  V.reintern(label);
+}
+
+/// The result of parsing one range of the buffer.
+struct ParsedRange {
+  /// Owns the AST nodes and strings of the range.
+  std::unique_ptr<Context> context{};
+  ESTree::NodeList body{};
+  /// Start of the first token of the range.
+  SMLoc startLoc{};
+  bool useStaticBuiltin{false};
+  /// Set if the range parsed without diagnostics and ended where expected.
+  bool ok{false};
+};
+
+} // namespace
+
+bool JSParserImpl::parseTopLevelRange(
+    bool parseDirectives,
+    const char *end,
+    ESTree::NodeList &stmtList) {
+  if (parseDirectives) {
+    ESTree::ExpressionStatementNode *dirStmt;
+    while (check(TokenKind::string_literal) &&
+           (dirStmt = parseDirective()) != nullptr) {
+      stmtList.push_back(*dirStmt);
+    }
+  }
+
+  while (!check(TokenKind::eof) && tok_->getStartLoc().getPointer() < end) {
+    if (!parseStatementListItem(Param{}, AllowImportExport::Yes, stmtList))
+      return false;
+  }
+  return true;
+}
+
+Optional<ESTree::ProgramNode *> JSParserImpl::parseParallel() {
+  // JSX text can't be tokenized without parsing, and stored comments and
+  // tokens have to be collected in order by a single lexer.
+  if (context_.getParseJSX() || lexer_.getStoreComments() ||
+      lexer_.getStoreTokens())
+    return None;
+
+  uint32_t bufId = lexer_.getBufferId();
+  llvh::MemoryBufferRef input = sm_.getSourceBuffer(bufId)->getMemBufferRef();
+  size_t size = input.getBufferSize();
+  if (size < kMinParallelBufferSize)
+    return None;
+
+  unsigned numJobs = context_.getParseJobs();
+  TopLevelSplitter splitter{input, isStrictMode()};
+  // Several ranges per thread even out ranges which are slower to parse.
+  std::vector<const char *> splits{input.getBufferStart()};
+  if (!splitter.scan(std::max(size / (numJobs * 4), kMinChunkSize), splits) ||
+      splits.size() < 2)
+    return None;
+
+  bool strictMode = isStrictMode() || splitter.getUseStrict();
+  ParseFlowSetting parseFlow = context_.getParseFlowAmbiguous()
+      ? ParseFlowSetting::ALL
+      : context_.getParseFlow() ? ParseFlowSetting::UNAMBIGUOUS
+                                : ParseFlowSetting::NONE;
+
+  std::vector<ParsedRange> ranges(splits.size());
+  auto parseRange = [&](size_t i) {
+    ParsedRange &range = ranges[i];
+    range.context = std::make_unique<Context>();
+    Context &ctx = *range.context;
+    ctx.setStrictMode(strictMode);
+    ctx.setParseFlow(parseFlow);
+    ctx.setParseFlowComponentSyntax(context_.getParseFlowComponentSyntax());
+    ctx.setParseTS(context_.getParseTS());
+
+    SourceErrorManager &sm = ctx.getSourceErrorManager();
+    sm.setDiagHandler([](const llvh::SMDiagnostic &, void *) {});
+    // The buffer is shared, so locations in the range's AST are valid in the
+    // main buffer too.
+    uint32_t rangeBufId =
+        sm.addNewSourceBuffer(llvh::MemoryBuffer::getMemBuffer(input));
+
+    JSParserImpl parser{ctx, rangeBufId, FullParse};
+    if (i == 0)
+      parser.tok_ = parser.lexer_.advance();
+    else
+      parser.seek(SMLoc::getFromPointer(splits[i]));
+    range.startLoc = parser.tok_->getStartLoc();
+
+    bool last = i + 1 == splits.size();
+    const char *end = last ? input.getBufferEnd() : splits[i + 1];
+    if (!parser.parseTopLevelRange(i == 0, end, range.body))
+      return;
+    range.useStaticBuiltin = parser.getUseStaticBuiltin();
+    range.ok = sm.getErrorCount() == 0 && sm.getWarningCount() == 0 &&
+        (last ? parser.check(TokenKind::eof)
+              : parser.tok_->getStartLoc().getPointer() == end);
+  };
+
+  std::atomic<size_t> nextRange{0};
+  auto worker = [&]() {
+    for (size_t i; (i = nextRange.fetch_add(1, std::memory_order_relaxed)) <
+         ranges.size();) {
+      parseRange(i);
+    }
+  };
+  std::vector<std::thread> threads{};
+  size_t numThreads = std::min<size_t>(numJobs, ranges.size());
+  for (size_t i = 1; i < numThreads; ++i)
+    threads.emplace_back(worker);
+  // The current thread participates too.
+  worker();
+  for (std::thread &t : threads)
+    t.join();
+
+  for (const ParsedRange &range : ranges) {
+    if (!range.ok)
+      return None;
+  }
+
+  // Splice the ranges together, moving their strings into our string table.
+  ReinternVisitor reintern{context_.getStringTable()};
+  ESTree::NodeList stmtList;
+  for (ParsedRange &range : ranges) {
+    for (ESTree::Node &stmt : range.body)
+      ESTreeVisit(reintern, &stmt);
+    stmtList.splice(stmtList.end(), range.body);
+    if (range.useStaticBuiltin)
+      setUseStaticBuiltin();
+    context_.adoptContext(std::move(range.context));
+  }
+
+  // Magic comments were only seen by the splitter's lexer.
+  SourceErrorManager &splitSm = splitter.getSourceErrorManager();
+  uint32_t splitBufId = splitter.getBufferId();
+  llvh::StringRef sourceMappingUrl = splitSm.getSourceMappingUrl(splitBufId);
+  if (!sourceMappingUrl.empty())
+    sm_.setSourceMappingUrl(bufId, sourceMappingUrl);
+  llvh::StringRef sourceUrl = splitSm.getSourceUrl(splitBufId);
+  if (sourceUrl != splitSm.getBufferFileName(splitBufId))
+    sm_.setSourceUrl(bufId, sourceUrl);
+
+  SMLoc startLoc = ranges.front().startLoc;
+  SMLoc endLoc = startLoc;
+  if (!stmtList.empty())
+    endLoc = stmtList.back().getEndLoc();
+  return setLocation(
+      startLoc,
+      endLoc,
+      new (context_) ESTree::ProgramNode(std::move(stmtList)));
+}
+
+} // namespace detail
+} // namespace parser
+} // namespace hermes
@@ -151,6 +151,10 @@ void JSParserImpl::initializeIdentifiers() {
 
 Optional<ESTree::ProgramNode *> JSParserImpl::parse() {
   PerfSection parsing("Parsing JavaScript");
+  if (context_.getParseJobs() > 1 && pass_ == FullParse) {
+    if (auto res = parseParallel())
+      return res;
+  }
   tok_ = lexer_.advance();
   auto res = parseProgram();
   if (!res)
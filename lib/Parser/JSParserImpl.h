@@ -174,6 +174,25 @@ class JSParserImpl {
     useStaticBuiltin_ = true;
   }
 
+  /// Split the buffer into ranges of top-level statements and parse them
+  /// concurrently on up to Context::getParseJobs() threads, splicing the
+  /// results into a single program.
+  /// \return None if the buffer is not worth splitting, could not be split, or
+  ///   any range failed to parse cleanly. The caller must then parse the buffer
+  ///   serially, which also reports any errors.
+  Optional<ESTree::ProgramNode *> parseParallel();
+
+  /// Parse top-level statements into \p stmtList, starting with the current
+  /// token and stopping at the first token starting at or after \p end, or
+  /// at EOF.
+  /// \param parseDirectives whether the range begins the directive prologue
+  ///   of the program.
+  /// \return false on error.
+  bool parseTopLevelRange(
+      bool parseDirectives,
+      const char *end,
+      ESTree::NodeList &stmtList);
+
   /// Called during construction to initialize Identifiers used for parsing,
   /// such as "var". The lexer and parser uses these to avoid passing strings
   /// around.
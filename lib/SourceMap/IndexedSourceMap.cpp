@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "hermes/SourceMap/IndexedSourceMap.h"
+
+#include <algorithm>
+
+using llvh::support::aligned_ulittle32_t;
+
+namespace hermes {
+
+namespace {
+
+/// Write the raw bytes of \p value to \p os.
+template <typename T>
+void writeRaw(llvh::raw_ostream &os, const T &value) {
+  os.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+void writeU32(llvh::raw_ostream &os, uint32_t value) {
+  writeRaw(os, aligned_ulittle32_t(value));
+}
+
+/// \return true if \p offsets are ascending offsets into a string table of
+/// \p size bytes.
+bool isValidStringTable(
+    llvh::ArrayRef<aligned_ulittle32_t> offsets,
+    uint64_t size) {
+  for (size_t i = 0, e = offsets.size() - 1; i < e; ++i) {
+    if (offsets[i] > offsets[i + 1] || offsets[i + 1] > size)
+      return false;
+  }
+  return true;
+}
+
+} // namespace
+
+std::pair<std::unique_ptr<IndexedSourceMap>, std::string>
+IndexedSourceMap::create(std::unique_ptr<llvh::MemoryBuffer> buffer) {
+  if (reinterpret_cast<uintptr_t>(buffer->getBufferStart()) %
+          alignof(Header) !=
+      0) {
+    buffer = llvh::MemoryBuffer::getMemBufferCopy(
+        buffer->getBuffer(), buffer->getBufferIdentifier());
+  }
+
+  llvh::StringRef data = buffer->getBuffer();
+  if (data.size() < sizeof(Header) || !isIndexedSourceMap(data))
+    return {nullptr, "Not an indexed source map"};
+  const auto *header = reinterpret_cast<const Header *>(data.data());
+  if (header->version != kVersion) {
+    return {
+        nullptr,
+        "Unsupported indexed source map version " +
+            std::to_string(header->version)};
+  }
+
+  // Compute the size in 64 bits so that bogus counts cannot overflow.
+  uint64_t numSources = header->numSources;
+  uint64_t numNames = header->numNames;
+  uint64_t numLines = header->numLines;
+  uint64_t numSegments = header->numSegments;
+  uint64_t stringTableSize = header->stringTableSize;
+  uint64_t expectedSize = sizeof(Header) +
+      (numSources + 1) * sizeof(aligned_ulittle32_t) +
+      (numNames + 1) * sizeof(aligned_ulittle32_t) +
+      (numLines + 1) * sizeof(aligned_ulittle32_t) +
+      numSegments * sizeof(Segment) + stringTableSize;
+  if (expectedSize != data.size())
+    return {nullptr, "Indexed source map is truncated or corrupt"};
+
+  std::unique_ptr<IndexedSourceMap> result{
+      new IndexedSourceMap(std::move(buffer))};
+  const char *cur = data.data() + sizeof(Header);
+  result->sourceOffsets_ = llvh::makeArrayRef(
+      reinterpret_cast<const aligned_ulittle32_t *>(cur),
+      (size_t)numSources + 1);
+  cur += result->sourceOffsets_.size() * sizeof(aligned_ulittle32_t);
+  result->nameOffsets_ = llvh::makeArrayRef(
+      reinterpret_cast<const aligned_ulittle32_t *>(cur), (size_t)numNames + 1);
+  cur += result->nameOffsets_.size() * sizeof(aligned_ulittle32_t);
+  result->lineOffsets_ = llvh::makeArrayRef(
+      reinterpret_cast<const aligned_ulittle32_t *>(cur), (size_t)numLines + 1);
+  cur += result->lineOffsets_.size() * sizeof(aligned_ulittle32_t);
+  result->segments_ = llvh::makeArrayRef(
+      reinterpret_cast<const Segment *>(cur), (size_t)numSegments);
+  cur += result->segments_.size() * sizeof(Segment);
+  result->strings_ = llvh::StringRef(cur, (size_t)stringTableSize);
+
+  // The source and name tables are small, so validate them eagerly. Line
+  // offsets and segments are validated when they are queried.
+  if (!isValidStringTable(result->sourceOffsets_, stringTableSize))
+    return {nullptr, "Indexed source map has an invalid source table"};
+  if (!isValidStringTable(result->nameOffsets_, stringTableSize))
+    return {nullptr, "Indexed source map has an invalid name table"};
+  return {std::move(result), ""};
+}
+
+bool IndexedSourceMap::isIndexedSourceMap(llvh::StringRef data) {
+  return data.size() >= sizeof(aligned_ulittle32_t) &&
+      llvh::support::endian::read32le(data.data()) == kMagic;
+}
+
+void IndexedSourceMap::write(
+    const SourceMap &sourceMap,
+    llvh::raw_ostream &os) {
+  const std::vector<SourceMap::SegmentList> &lines = sourceMap.getLines();
+  std::string strings;
+  std::vector<uint32_t> sourceOffsets{0};
+  for (uint32_t i = 0, e = sourceMap.getNumSourcePaths(); i < e; ++i) {
+    strings += sourceMap.getSourceFullPath(i);
+    sourceOffsets.push_back(strings.size());
+  }
+  std::vector<uint32_t> nameOffsets{(uint32_t)strings.size()};
+  for (uint32_t i = 0, e = sourceMap.getNumNames(); i < e; ++i) {
+    strings += sourceMap.getName(i);
+    nameOffsets.push_back(strings.size());
+  }
+  uint32_t numSegments = 0;
+  for (const SourceMap::SegmentList &segments : lines)
+    numSegments += segments.size();
+
+  Header header;
+  header.magic = kMagic;
+  header.version = kVersion;
+  header.numSources = sourceMap.getNumSourcePaths();
+  header.numNames = sourceMap.getNumNames();
+  header.numLines = lines.size();
+  header.numSegments = numSegments;
+  header.stringTableSize = strings.size();
+  writeRaw(os, header);
+
+  for (uint32_t offset : sourceOffsets)
+    writeU32(os, offset);
+  for (uint32_t offset : nameOffsets)
+    writeU32(os, offset);
+
+  uint32_t lineOffset = 0;
+  writeU32(os, lineOffset);
+  for (const SourceMap::SegmentList &segments : lines) {
+    lineOffset += segments.size();
+    writeU32(os, lineOffset);
+  }
+
+  for (const SourceMap::SegmentList &segments : lines) {
+    for (const SourceMap::Segment &seg : segments) {
+      Segment out;
+      out.generatedColumn = seg.generatedColumn;
+      out.sourceIndex = kNone;
+      out.lineIndex = 0;
+      out.columnIndex = 0;
+      out.nameIndex = kNone;
+      if (const auto &loc = seg.representedLocation) {
+        out.sourceIndex = loc->sourceIndex;
+        out.lineIndex = loc->lineIndex;
+        out.columnIndex = loc->columnIndex;
+        // Keep the index valid even if the JSON referred to a missing name.
+        if (loc->nameIndex &&
+            (uint32_t)*loc->nameIndex < sourceMap.getNumNames())
+          out.nameIndex = *loc->nameIndex;
+      }
+      writeRaw(os, out);
+    }
+  }
+
+  os << strings;
+}
+
+llvh::Optional<SourceMapTextLocationFIndex>
+IndexedSourceMap::getLocationForAddressFIndex(uint32_t line, uint32_t column)
+    const {
+  auto seg = this->getSegmentForAddress(line, column);
+  // Unmapped location
+  if (!seg.hasValue() || !seg->representedLocation.hasValue()) {
+    return llvh::None;
+  }
+  return SourceMapTextLocationFIndex{
+      (uint32_t)seg->representedLocation->sourceIndex,
+      (uint32_t)seg->representedLocation->lineIndex + 1,
+      (uint32_t)seg->representedLocation->columnIndex + 1};
+}
+
+llvh::Optional<SourceMapTextLocation> IndexedSourceMap::getLocationForAddress(
+    uint32_t line,
+    uint32_t column) const {
+  auto loc = getLocationForAddressFIndex(line, column);
+  if (!loc)
+    return llvh::None;
+
+  return SourceMapTextLocation{
+      getSourceFullPath(loc->fileIndex).str(), loc->line, loc->column};
+}
+
+llvh::Optional<SourceMap::Segment> IndexedSourceMap::getSegmentForAddress(
+    uint32_t line,
+    uint32_t column) const {
+  if (line == 0 || line >= lineOffsets_.size()) {
+    return llvh::None;
+  }
+
+  // line is 1-based.
+  uint32_t lineIndex = line - 1;
+  uint32_t begin = lineOffsets_[lineIndex];
+  uint32_t end = lineOffsets_[lineIndex + 1];
+  if (begin >= end || end > segments_.size()) {
+    return llvh::None;
+  }
+  llvh::ArrayRef<Segment> segments = segments_.slice(begin, end - begin);
+  assert(column >= 1 && "the column argument to this function is 1-based");
+  uint32_t columnIndex = column - 1;
+  // Find the first segment strictly after the column, and step back to the
+  // one covering it, as in SourceMap::getSegmentForAddress().
+  auto segIter = std::upper_bound(
+      segments.begin(),
+      segments.end(),
+      columnIndex,
+      [](uint32_t column, const Segment &seg) {
+        return column < (uint32_t)(int32_t)seg.generatedColumn;
+      });
+  if (segIter == segments.begin()) {
+    return llvh::None;
+  }
+  const Segment &target = *(--segIter);
+
+  SourceMap::Segment result;
+  result.generatedColumn = target.generatedColumn;
+  int32_t sourceIndex = target.sourceIndex;
+  if (sourceIndex == kNone)
+    return result;
+  // Don't trust the mapped file with an out-of-range source.
+  if (sourceIndex < 0 || (uint32_t)sourceIndex >= getNumSourcePaths())
+    return llvh::None;
+  result.representedLocation = SourceMap::Segment::SourceLocation(
+      sourceIndex, target.lineIndex, target.columnIndex);
+  int32_t nameIndex = target.nameIndex;
+  if (nameIndex != kNone) {
+    if (nameIndex < 0 || (uint32_t)nameIndex >= getNumNames())
+      return llvh::None;
+    result.representedLocation->nameIndex = nameIndex;
+  }
+  return result;
+}
+
+} // namespace hermes
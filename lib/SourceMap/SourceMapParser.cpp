@@ -36,10 +36,9 @@ std::unique_ptr<SourceMap> SourceMapParser::parse(
   // Parse for JavaScript version 3 source map https://sourcemaps.info/spec.html
   // Not yet implemented:
   //  1. 'file' field
-  //  2. 'names' field
-  //  3. 'sourcesContent' field.
-  //  4. Index map.
-  //  5. Facebook segments extension.
+  //  2. 'sourcesContent' field.
+  //  3. Index map.
+  //  4. Facebook segments extension.
   auto *json = llvh::dyn_cast_or_null<JSONObject>(parsedMap.getValue());
   if (json == nullptr) {
     sm.error(genericLoc, "Expected a source map object");
@@ -91,6 +90,23 @@ std::unique_ptr<SourceMap> SourceMapParser::parse(
     sources[i] = file->str();
   }
 
+  // names is optional.
+  std::vector<std::string> names;
+  if (auto *namesJson =
+          llvh::dyn_cast_or_null<JSONArray>(json->get("names"))) {
+    names.resize(namesJson->size());
+    for (unsigned i = 0, e = names.size(); i < e; ++i) {
+      auto *name = llvh::dyn_cast_or_null<JSONString>(namesJson->at(i));
+      if (name == nullptr) {
+        sm.error(
+            genericLoc,
+            "Name #" + std::to_string(i) + " not found or not string");
+        return nullptr;
+      }
+      names[i] = name->str();
+    }
+  }
+
   auto *mappings = llvh::dyn_cast_or_null<JSONString>(json->get("mappings"));
   if (mappings == nullptr) {
     sm.error(genericLoc, "'mappings' key missing from source map");
@@ -107,7 +123,8 @@ std::unique_ptr<SourceMap> SourceMapParser::parse(
       sourceRoot,
       std::move(sources),
       std::move(lines),
-      std::move(sourcesMetadata));
+      std::move(sourcesMetadata),
+      std::move(names));
 }
 
 bool SourceMapParser::parseMappings(
@@ -16,9 +16,11 @@
 #include "llvh/Support/MathExtras.h"
 #include "llvh/Support/raw_ostream.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <string>
+#include <vector>
 
 namespace hermes {
 namespace bigint {
@@ -1056,18 +1058,38 @@ std::string toString(ImmutableBigIntRef src, uint8_t radix) {
   // returned by this function. The "1" below is to account for a possible "-"
   // sign.
   digits.reserve(1 + src.numDigits * maxCharsPerDigitInRadix(radix));
+
+  // Dividing the number by the radix once per character is quadratic in the
+  // number of characters, with a large constant. Instead, divide it by the
+  // largest power of radix that fits in a uint64_t, and convert each remainder
+  // to charsPerChunk characters with cheap 64-bit arithmetic.
+  uint64_t chunkDivisor = radix;
+  uint32_t charsPerChunk = 1;
+  while (chunkDivisor <= std::numeric_limits<uint64_t>::max() / radix) {
+    chunkDivisor *= radix;
+    ++charsPerChunk;
+  }
+
   do {
     llvh::APInt quoc;
     uint64_t rem;
-    llvh::APInt::udivrem(tmp, static_cast<uint64_t>(radix), quoc, rem);
+    llvh::APInt::udivrem(tmp, chunkDivisor, quoc, rem);
+    tmp = std::move(quoc);
 
-    if (rem < 10) {
-      digits.push_back('0' + rem);
-    } else {
-      digits.push_back('a' + rem - 10);
+    // All chunks but the most significant one are padded with zeros, and
+    // every chunk has at least one character.
+    const bool isLastChunk = tmp == 0;
+    for (uint32_t i = 0;
+         i < charsPerChunk && (i == 0 || !isLastChunk || rem != 0);
+         ++i) {
+      const uint64_t charValue = rem % radix;
+      rem /= radix;
+      if (charValue < 10) {
+        digits.push_back('0' + charValue);
+      } else {
+        digits.push_back('a' + charValue - 10);
+      }
     }
-
-    tmp = std::move(quoc);
   } while (tmp != 0);
 
   if (sign) {
@@ -1654,6 +1676,125 @@ uint32_t multiplyResultSize(ImmutableBigIntRef lhs, ImmutableBigIntRef rhs) {
                                             : lhs.numDigits + rhs.numDigits + 1;
 }
 
+namespace {
+/// Operands with fewer digits than this are multiplied with the schoolbook
+/// algorithm, which is faster for small sizes than Karatsuba's.
+static constexpr uint32_t KaratsubaThresholdInDigits = 32;
+
+/// dst[0, dstSize) += src[0, srcSize), where srcSize <= dstSize.
+/// \return the carry out of dst.
+static BigIntDigitType addInPlace(
+    BigIntDigitType *dst,
+    uint32_t dstSize,
+    const BigIntDigitType *src,
+    uint32_t srcSize) {
+  assert(srcSize <= dstSize && "src is larger than dst");
+  BigIntDigitType carry = llvh::APInt::tcAdd(dst, src, 0, srcSize);
+  for (uint32_t i = srcSize; carry && i < dstSize; ++i) {
+    carry = ++dst[i] == 0;
+  }
+  return carry;
+}
+
+/// dst[0, dstSize) -= src[0, srcSize), where srcSize <= dstSize and the
+/// result is not negative.
+static void subtractInPlace(
+    BigIntDigitType *dst,
+    uint32_t dstSize,
+    const BigIntDigitType *src,
+    uint32_t srcSize) {
+  assert(srcSize <= dstSize && "src is larger than dst");
+  BigIntDigitType borrow = llvh::APInt::tcSubtract(dst, src, 0, srcSize);
+  for (uint32_t i = srcSize; borrow && i < dstSize; ++i) {
+    borrow = dst[i]-- == 0;
+  }
+  assert(!borrow && "subtraction result is negative");
+}
+
+/// dst[0, lhsSize + rhsSize) = lhs * rhs, for unsigned lhs and rhs. dst must
+/// not overlap the operands. Large operands are multiplied with Karatsuba's
+/// algorithm, which splits each operand in two halves, x = x1 * B^m + x0, and
+/// computes the product with three half-sized multiplications:
+///
+///   z0 = lhs0 * rhs0
+///   z2 = lhs1 * rhs1
+///   z1 = (lhs0 + lhs1) * (rhs0 + rhs1) - z0 - z2
+///   lhs * rhs = z2 * B^2m + z1 * B^m + z0
+static void multiplyUnsigned(
+    BigIntDigitType *dst,
+    const BigIntDigitType *lhs,
+    uint32_t lhsSize,
+    const BigIntDigitType *rhs,
+    uint32_t rhsSize) {
+  if (lhsSize < rhsSize) {
+    std::swap(lhs, rhs);
+    std::swap(lhsSize, rhsSize);
+  }
+
+  if (rhsSize < KaratsubaThresholdInDigits) {
+    llvh::APInt::tcFullMultiply(dst, lhs, rhs, lhsSize, rhsSize);
+    return;
+  }
+
+  const uint32_t dstSize = lhsSize + rhsSize;
+  const uint32_t m = (lhsSize + 1) / 2;
+
+  if (rhsSize <= m) {
+    // The operands are unbalanced, so split lhs into rhsSize-digit slices and
+    // accumulate their products with rhs.
+    memset(dst, 0, dstSize * BigIntDigitSizeInBytes);
+    std::vector<BigIntDigitType> partial(2 * rhsSize);
+    for (uint32_t i = 0; i < lhsSize; i += rhsSize) {
+      const uint32_t sliceSize = std::min(rhsSize, lhsSize - i);
+      multiplyUnsigned(partial.data(), lhs + i, sliceSize, rhs, rhsSize);
+      BigIntDigitType carry = addInPlace(
+          dst + i, dstSize - i, partial.data(), sliceSize + rhsSize);
+      assert(!carry && "partial product overflowed");
+      (void)carry;
+    }
+    return;
+  }
+
+  const uint32_t lhs1Size = lhsSize - m;
+  const uint32_t rhs1Size = rhsSize - m;
+
+  // z0 goes in dst[0, 2m), and z2 in dst[2m, dstSize).
+  multiplyUnsigned(dst, lhs, m, rhs, m);
+  multiplyUnsigned(dst + 2 * m, lhs + m, lhs1Size, rhs + m, rhs1Size);
+
+  // The sums of the halves need one extra digit for the carry, and so does
+  // their product.
+  const uint32_t sumSize = m + 1;
+  const uint32_t z1Size = 2 * sumSize;
+  std::vector<BigIntDigitType> tmp(2 * sumSize + z1Size);
+  BigIntDigitType *lhsSum = tmp.data();
+  BigIntDigitType *rhsSum = lhsSum + sumSize;
+  BigIntDigitType *z1 = rhsSum + sumSize;
+
+  std::copy(lhs, lhs + m, lhsSum);
+  lhsSum[m] = addInPlace(lhsSum, m, lhs + m, lhs1Size);
+  std::copy(rhs, rhs + m, rhsSum);
+  rhsSum[m] = addInPlace(rhsSum, m, rhs + m, rhs1Size);
+
+  multiplyUnsigned(z1, lhsSum, sumSize, rhsSum, sumSize);
+  subtractInPlace(z1, z1Size, dst, 2 * m);
+  subtractInPlace(z1, z1Size, dst + 2 * m, lhs1Size + rhs1Size);
+
+  // z1 = lhs0 * rhs1 + lhs1 * rhs0 fits in dstSize - m digits, so any digits
+  // of z1 above that are zero.
+  const uint32_t z1UsedSize = std::min(z1Size, dstSize - m);
+  assert(
+      std::all_of(
+          z1 + z1UsedSize,
+          z1 + z1Size,
+          [](BigIntDigitType d) { return d == 0; }) &&
+      "z1 is larger than the product");
+  BigIntDigitType carry = addInPlace(dst + m, dstSize - m, z1, z1UsedSize);
+  assert(!carry && "product overflowed");
+  (void)carry;
+}
+} // namespace
+
 OperationStatus
 multiply(MutableBigIntRef dst, ImmutableBigIntRef lhs, ImmutableBigIntRef rhs) {
   const uint32_t oldDstSize = multiplyResultSize(lhs, rhs);
@@ -1724,10 +1865,11 @@ multiply(MutableBigIntRef dst, ImmutableBigIntRef lhs, ImmutableBigIntRef rhs) {
 
   // if dstSize is zero, then there's no need to perform the multiplication.
   if (dstSize > 0) {
-    // tcFullMultiply returns a result with lhs.numDigits + rhs.numDigits. Thus,
-    // there could be extraneous digits in dst that are not initialized by it.
-    llvh::APInt::tcFullMultiply(
-        dst.digits, lhs.digits, rhs.digits, lhs.numDigits, rhs.numDigits);
+    // multiplyUnsigned returns a result with lhs.numDigits + rhs.numDigits.
+    // Thus, there could be extraneous digits in dst that are not initialized by
+    // it.
+    multiplyUnsigned(
+        dst.digits, lhs.digits, lhs.numDigits, rhs.digits, rhs.numDigits);
 
     // Zero out extranous digits in dst. These digits are used to simulate
     // infinite precision when multiplying negative and positive numbers.
@@ -1786,7 +1928,7 @@ static OperationStatus compute(
     return OperationStatus::DIVISION_BY_ZERO;
   }
 
-  // tcDivide operates on unsigned number, so just like multiply, the operands
+  // udivrem operates on unsigned number, so just like multiply, the operands
   // must be negated (and the result as well, if appropriate) if they are
   // negative.
   const bool isLhsNegative = isNegative(lhs);
@@ -1801,18 +1943,15 @@ static OperationStatus compute(
   const bool needTmpRem = rem.digits == nullptr;
   const bool needTmpRhs = isRhsNegative || needToResizeRhs;
 
-  uint32_t tmpStorageSizeScratch = resultSize;
   uint32_t tmpStorageSizeQuoc = needTmpQuoc ? resultSize : 0;
   uint32_t tmpStorageSizeRem = needTmpRem ? resultSize : 0;
   uint32_t tmpStorageSizeRhs = needTmpRhs ? resultSize : 0;
 
-  const uint32_t tmpStorageSize = tmpStorageSizeScratch + tmpStorageSizeQuoc +
-      tmpStorageSizeRem + tmpStorageSizeRhs;
+  const uint32_t tmpStorageSize =
+      tmpStorageSizeQuoc + tmpStorageSizeRem + tmpStorageSizeRhs;
 
   TmpStorage tmpStorage(tmpStorageSize);
 
-  BigIntDigitType *scratch = tmpStorage.requestNumDigits(tmpStorageSizeScratch);
-
   if (needTmpQuoc) {
     assert(quoc.numDigits == tmpStorageSizeQuoc);
     quoc.digits = tmpStorage.requestNumDigits(tmpStorageSizeQuoc);
@@ -1833,10 +1972,10 @@ static OperationStatus compute(
     rhs = ImmutableBigIntRef{tmpRhs.digits, tmpRhs.numDigits};
   }
 
-  // tcDivide is in-place (i.e. quoc is lhs), so division will be expressed as
+  // Division will be expressed as
   //
   // quoc = signExt(lhs)
-  // quoc, rem, scratch /= signExt(rhs)
+  // quoc, rem = udivrem(quoc, signExt(rhs))
   auto res = initNonCanonicalWithReadOnlyBigInt(quoc, lhs);
   assert(res == OperationStatus::RETURNED && "quoc array is too small");
   (void)res;
@@ -1847,8 +1986,23 @@ static OperationStatus compute(
     llvh::APInt::tcNegate(quoc.digits, quoc.numDigits);
   }
 
-  llvh::APInt::tcDivide(
-      quoc.digits, rhs.digits, rem.digits, scratch, resultSize);
+  // udivrem uses Knuth's long division, which produces a whole digit of the
+  // quotient per step; tcDivide, on the other hand, is bit-serial, and thus
+  // much slower for large operands.
+  const unsigned numBits = resultSize * BigIntDigitSizeInBits;
+  llvh::APInt apQuoc;
+  llvh::APInt apRem;
+  llvh::APInt::udivrem(
+      llvh::APInt(numBits, llvh::makeArrayRef(quoc.digits, resultSize)),
+      llvh::APInt(numBits, llvh::makeArrayRef(rhs.digits, resultSize)),
+      apQuoc,
+      apRem);
+  assert(
+      apQuoc.getNumWords() == resultSize &&
+      apRem.getNumWords() == resultSize && "unexpected udivrem result size");
+  std::copy(
+      apQuoc.getRawData(), apQuoc.getRawData() + resultSize, quoc.digits);
+  std::copy(apRem.getRawData(), apRem.getRawData() + resultSize, rem.digits);
 
   // post-process quoc if no space was allocated for it in the temporary storage
   // -- i.e., the caller wants the quoc.
@@ -26,6 +26,7 @@
 #include "llvh/Support/raw_ostream.h"
 
 #include <inttypes.h>
+#include <algorithm>
 #include <clocale>
 #include <stdexcept>
 #include <system_error>
@@ -1483,11 +1484,19 @@ void GCBase::AllocationLocationTracker::addSamplesToSnapshot(
 void GCBase::SamplingAllocationLocationTracker::enable(
     size_t samplingInterval,
     int64_t seed) {
+  startSampling(samplingInterval, seed);
+  recordingStackTraces_ = true;
+}
+
+void GCBase::SamplingAllocationLocationTracker::startSampling(
+    size_t samplingInterval,
+    int64_t seed) {
   if (seed < 0) {
     seed = std::random_device()();
   }
   randomEngine_.seed(seed);
   dist_ = llvh::make_unique<std::poisson_distribution<>>(samplingInterval);
+  samplingInterval_ = samplingInterval;
   limit_ = nextSample();
 }
 
@@ -1501,7 +1510,9 @@ void GCBase::SamplingAllocationLocationTracker::disable(llvh::raw_ostream &os) {
   // Do a pre-pass to compute sizesToCounts.
   for (const auto &s : samples_) {
     const Sample &sample = s.second;
-    sizesToCounts[sample.node][sample.size]++;
+    // Samples taken only for attribution have no stack trace.
+    if (sample.node)
+      sizesToCounts[sample.node][sample.size]++;
   }
 
   // Have to emit the tree of stack frames before emitting samples, Chrome
@@ -1510,12 +1521,87 @@ void GCBase::SamplingAllocationLocationTracker::disable(llvh::raw_ostream &os) {
   profile.beginSamples();
   for (const auto &s : samples_) {
     const Sample &sample = s.second;
-    profile.emitSample(sample.size, sample.node, sample.id);
+    if (sample.node)
+      profile.emitSample(sample.size, sample.node, sample.id);
   }
   profile.endSamples();
   dist_.reset();
   samples_.clear();
   limit_ = 0;
+  recordingStackTraces_ = false;
+  attributing_ = false;
+  functionStats_.clear();
+  functionIndex_.clear();
+  youngSamples_.clear();
+}
+
+void GCBase::SamplingAllocationLocationTracker::enableAttribution(
+    size_t samplingInterval,
+    int64_t seed) {
+  if (!isEnabled()) {
+    startSampling(samplingInterval, seed);
+  }
+  attributing_ = true;
+}
+
+uint32_t GCBase::SamplingAllocationLocationTracker::currentFunction() {
+  const void *key = gc_->gcCallbacks_.getCurrentFunctionForProfiling(nullptr);
+  if (!key) {
+    return UINT32_MAX;
+  }
+  auto it = functionIndex_.find(key);
+  if (it != functionIndex_.end()) {
+    return it->second;
+  }
+  // First sample in this function: look up its name once.
+  FunctionStats stats;
+  gc_->gcCallbacks_.getCurrentFunctionForProfiling(&stats.name);
+  uint32_t index = functionStats_.size();
+  functionStats_.push_back(std::move(stats));
+  functionIndex_[key] = index;
+  return index;
+}
+
+void GCBase::SamplingAllocationLocationTracker::emitAttribution(
+    llvh::raw_ostream &os) {
+  JSONEmitter json{os};
+  std::lock_guard<Mutex> lk{mtx_};
+  json.openDict();
+  json.emitKeyValue("samplingInterval", samplingInterval_);
+  json.emitKey("functions");
+  json.openArray();
+  for (const FunctionStats &stats : functionStats_) {
+    json.openDict();
+    json.emitKeyValue("name", stats.name);
+    json.emitKeyValue("samples", stats.samples);
+    json.emitKeyValue("sampledBytes", stats.sampledBytes);
+    json.emitKeyValue(
+        "estimatedBytes",
+        static_cast<uint64_t>(stats.samples * samplingInterval_));
+    json.emitKeyValue("estimatedCount", stats.estimatedCount);
+    json.emitKeyValue("allocatedOldGen", stats.allocatedOldGen);
+    json.emitKeyValue("survivedYoungGen", stats.survivedYoungGen);
+    json.emitKeyValue("liveSamples", stats.liveSamples);
+    json.emitKeyValue("liveBytes", stats.liveBytes);
+    json.closeDict();
+  }
+  json.closeArray();
+  json.closeDict();
+}
+
+void GCBase::SamplingAllocationLocationTracker::onYoungGenCollection() {
+  if (!attributing_) {
+    return;
+  }
+  std::lock_guard<Mutex> lk{mtx_};
+  // Samples that died were already erased by freeAlloc.
+  for (HeapSnapshot::NodeID id : youngSamples_) {
+    auto it = samples_.find(id);
+    if (it != samples_.end()) {
+      ++functionStats_[it->second.function].survivedYoungGen;
+    }
+  }
+  youngSamples_.clear();
 }
 
 void GCBase::SamplingAllocationLocationTracker::newAlloc(
@@ -1530,17 +1616,37 @@ void GCBase::SamplingAllocationLocationTracker::newAlloc(
     limit_ -= sz;
     return;
   }
-  const auto *ip = gc_->gcCallbacks_.getCurrentIPSlow();
   // This is stateful and causes the object to have an ID assigned.
   const auto id = gc_->getObjectID(ptr);
-  if (StackTracesTreeNode *node =
-          gc_->gcCallbacks_.getCurrentStackTracesTreeNode(ip)) {
-    // Hold a lock while modifying samples_.
-    std::lock_guard<Mutex> lk{mtx_};
+  StackTracesTreeNode *node = recordingStackTraces_
+      ? gc_->gcCallbacks_.getCurrentStackTracesTreeNode(
+            gc_->gcCallbacks_.getCurrentIPSlow())
+      : nullptr;
+  // Hold a lock while modifying samples_ and functionStats_, which the
+  // background thread updates when it frees objects.
+  std::lock_guard<Mutex> lk{mtx_};
+  // Code compiled by Static Hermes has no stack trace node, but can still be
+  // attributed to a function.
+  uint32_t function = attributing_ ? currentFunction() : UINT32_MAX;
+  if (node || function != UINT32_MAX) {
     auto sampleItAndDidInsert =
-        samples_.try_emplace(id, Sample{sz, node, nextSampleID_++});
+        samples_.try_emplace(id, Sample{sz, node, nextSampleID_++, function});
     assert(sampleItAndDidInsert.second && "Failed to create a sample");
     (void)sampleItAndDidInsert;
+    if (function != UINT32_MAX) {
+      FunctionStats &stats = functionStats_[function];
+      ++stats.samples;
+      stats.sampledBytes += sz;
+      stats.estimatedCount +=
+          std::max(1.0, static_cast<double>(samplingInterval_) / sz);
+      ++stats.liveSamples;
+      stats.liveBytes += sz;
+      // Only young-gen allocations can survive a young-gen collection.
+      if (gc_->inYoungGen(ptr))
+        youngSamples_.push_back(id);
+      else
+        ++stats.allocatedOldGen;
+    }
   }
   // Reset the limit.
   limit_ = nextSample();
@@ -1560,7 +1666,16 @@ void GCBase::SamplingAllocationLocationTracker::freeAlloc(
   const auto id = gc_->getObjectIDMustExist(ptr);
   // Hold a lock while modifying samples_.
   std::lock_guard<Mutex> lk{mtx_};
-  samples_.erase(id);
+  auto it = samples_.find(id);
+  if (it == samples_.end()) {
+    return;
+  }
+  if (it->second.function != UINT32_MAX) {
+    FunctionStats &stats = functionStats_[it->second.function];
+    --stats.liveSamples;
+    stats.liveBytes -= it->second.size;
+  }
+  samples_.erase(it);
 }
 
 void GCBase::SamplingAllocationLocationTracker::updateSize(
@@ -1580,6 +1695,9 @@ void GCBase::SamplingAllocationLocationTracker::updateSize(
     return;
   }
   Sample &sample = it->second;
+  if (sample.function != UINT32_MAX) {
+    functionStats_[sample.function].liveBytes += delta;
+  }
   // Update the size stored in the sample.
   sample.size = newSize;
 }
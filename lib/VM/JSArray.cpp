@@ -806,10 +806,17 @@ PseudoHandle<JSArrayIterator> JSArrayIterator::create(
 CallResult<HermesValue> JSArrayIterator::nextElement(
     Handle<JSArrayIterator> self,
     Runtime &runtime) {
+  return createIterResultFromNextValue(runtime, nextValue(self, runtime));
+}
+
+/// The steps below that create an iterator result object return the empty
+/// value when they are done, and the value otherwise.
+CallResult<HermesValue> JSArrayIterator::nextValue(
+    Handle<JSArrayIterator> self,
+    Runtime &runtime) {
   if (!self->iteratedObject_) {
     // 5. If a is undefined, return CreateIterResultObject(undefined, true).
-    return createIterResultObject(runtime, Runtime::getUndefinedValue(), true)
-        .getHermesValue();
+    return HermesValue::encodeEmptyValue();
   }
 
   // 4. Let a be the value of the [[IteratedObject]] internal slot of O.
@@ -849,8 +856,7 @@ CallResult<HermesValue> JSArrayIterator::nextElement(
     // undefined.
     self->iteratedObject_.setNull(runtime.getHeap());
     // b. Return CreateIterResultObject(undefined, true).
-    return createIterResultObject(runtime, Runtime::getUndefinedValue(), true)
-        .getHermesValue();
+    return HermesValue::encodeEmptyValue();
   }
 
   // 11. Set the value of the [[ArrayIteratorNextIndex]] internal slot of O to
@@ -862,7 +868,7 @@ CallResult<HermesValue> JSArrayIterator::nextElement(
 
   if (self->iterationKind_ == IterationKind::Key) {
     // 12. If itemKind is "key", return CreateIterResultObject(index, false).
-    return createIterResultObject(runtime, indexHandle, false).getHermesValue();
+    return indexHandle.getHermesValue();
   }
 
   // 13. Let elementKey be ToString(index).
@@ -880,8 +886,7 @@ CallResult<HermesValue> JSArrayIterator::nextElement(
       return HermesValue::encodeEmptyValue();
     case IterationKind::Value:
       // 16. If itemKind is "value", let result be elementValue.
-      return createIterResultObject(runtime, valueHandle, false)
-          .getHermesValue();
+      return valueHandle.getHermesValue();
     case IterationKind::Entry: {
       // 17. b. Let result be CreateArrayFromList(«index, elementValue»).
       auto resultRes = JSArray::create(runtime, 2, 2);
@@ -892,7 +897,7 @@ CallResult<HermesValue> JSArrayIterator::nextElement(
       JSArray::setElementAt(result, runtime, 0, indexHandle);
       JSArray::setElementAt(result, runtime, 1, valueHandle);
       // 18. Return CreateIterResultObject(result, false).
-      return createIterResultObject(runtime, result, false).getHermesValue();
+      return result.getHermesValue();
     }
     case IterationKind::NumKinds:
       llvm_unreachable("Invalid iteration kind");
@@ -375,6 +375,23 @@ Handle<JSObject> createDateConstructor(Runtime &runtime) {
   return cons;
 }
 
+/// \return the local time zone adjustments cached in \p runtime.
+static LocalTimeOffsetCache &getLocalTimeOffsetCache(Runtime &runtime) {
+  return runtime.getCommonStorage()->localTimeOffsetCache;
+}
+
+/// Conversion from UTC to local time, using the adjustments cached in
+/// \p runtime.
+static double localTime(Runtime &runtime, double t) {
+  return getLocalTimeOffsetCache(runtime).localTime(t);
+}
+
+/// Conversion from local time to UTC, using the adjustments cached in
+/// \p runtime.
+static double utcTime(Runtime &runtime, double t) {
+  return getLocalTimeOffsetCache(runtime).utcTime(t);
+}
+
 /// Takes \p args in UTC time of the form:
 /// (year, month, [, date [, hours [, minutes [, seconds [, ms]]]]])
 /// and returns the unclipped time in milliseconds since Jan 1 1970 UTC.
@@ -437,8 +454,10 @@ dateConstructor_RJS(void *, Runtime &runtime, NativeArgs args) {
 
         if (v->isString()) {
           // Call the String -> Date parsing function.
-          finalDate = timeClip(parseDate(StringPrimitive::createStringView(
-              runtime, Handle<StringPrimitive>::vmcast(v))));
+          finalDate = timeClip(parseDate(
+              StringPrimitive::createStringView(
+                  runtime, Handle<StringPrimitive>::vmcast(v)),
+              getLocalTimeOffsetCache(runtime)));
         } else {
           auto numRes = toNumber_RJS(runtime, v);
           if (numRes == ExecutionStatus::EXCEPTION) {
@@ -457,7 +476,7 @@ dateConstructor_RJS(void *, Runtime &runtime, NativeArgs args) {
       // makeTimeFromArgs interprets arguments as UTC.
       // We want them as local time, so pretend that they are,
       // and call utcTime to get the final UTC value we want to store.
-      finalDate = timeClip(utcTime(*cr));
+      finalDate = timeClip(utcTime(runtime, *cr));
     }
     self->setPrimitiveValue(finalDate);
     return self.getHermesValue();
@@ -465,7 +484,7 @@ dateConstructor_RJS(void *, Runtime &runtime, NativeArgs args) {
 
   llvh::SmallString<32> str{};
   double t = curTime();
-  double local = localTime(t);
+  double local = localTime(runtime, t);
   dateTimeString(local, local - t, str);
   return runtime.ignoreAllocationFailure(StringPrimitive::create(runtime, str));
 }
@@ -477,8 +496,10 @@ dateParse_RJS(void *, Runtime &runtime, NativeArgs args) {
     return ExecutionStatus::EXCEPTION;
   }
   return HermesValue::encodeTrustedNumberValue(
-      parseDate(StringPrimitive::createStringView(
-          runtime, runtime.makeHandle(std::move(*res)))));
+      parseDate(
+          StringPrimitive::createStringView(
+              runtime, runtime.makeHandle(std::move(*res))),
+          getLocalTimeOffsetCache(runtime)));
 }
 
 CallResult<HermesValue> dateUTC_RJS(void *, Runtime &runtime, NativeArgs args) {
@@ -537,7 +558,7 @@ datePrototypeToStringHelper(void *ctx, Runtime &runtime, NativeArgs args) {
   }
   llvh::SmallString<32> str{};
   if (!opts->isUTC) {
-    double local = localTime(t);
+    double local = localTime(runtime, t);
     opts->toStringFn(local, local - t, str);
   } else {
     opts->toStringFn(t, 0, str);
@@ -643,7 +664,7 @@ datePrototypeGetterHelper(void *ctx, Runtime &runtime, NativeArgs args) {
   // Store the original value of t to be used in offset calculations.
   double utc = t;
   if (!opts->isUTC) {
-    t = localTime(t);
+    t = localTime(runtime, t);
   }
 
   double result{std::numeric_limits<double>::quiet_NaN()};
@@ -710,7 +731,7 @@ datePrototypeSetMilliseconds_RJS(void *ctx, Runtime &runtime, NativeArgs args) {
   }
   double t = self->getPrimitiveValue();
   if (!isUTC) {
-    t = localTime(t);
+    t = localTime(runtime, t);
   }
   auto res = toNumber_RJS(runtime, args.getArgHandle(0));
   if (res == ExecutionStatus::EXCEPTION) {
@@ -719,7 +740,7 @@ datePrototypeSetMilliseconds_RJS(void *ctx, Runtime &runtime, NativeArgs args) {
   double ms = res->getNumber();
   double date = makeDate(
       day(t), makeTime(hourFromTime(t), minFromTime(t), secFromTime(t), ms));
-  double utcT = !isUTC ? timeClip(utcTime(date)) : timeClip(date);
+  double utcT = !isUTC ? timeClip(utcTime(runtime, date)) : timeClip(date);
   self->setPrimitiveValue(utcT);
   return HermesValue::encodeTrustedNumberValue(utcT);
 }
@@ -736,7 +757,7 @@ datePrototypeSetSeconds_RJS(void *ctx, Runtime &runtime, NativeArgs args) {
   }
   double t = self->getPrimitiveValue();
   if (!isUTC) {
-    t = localTime(t);
+    t = localTime(runtime, t);
   }
   auto res = toNumber_RJS(runtime, args.getArgHandle(0));
   if (res == ExecutionStatus::EXCEPTION) {
@@ -756,7 +777,7 @@ datePrototypeSetSeconds_RJS(void *ctx, Runtime &runtime, NativeArgs args) {
 
   double date =
       makeDate(day(t), makeTime(hourFromTime(t), minFromTime(t), s, milli));
-  double utcT = !isUTC ? timeClip(utcTime(date)) : timeClip(date);
+  double utcT = !isUTC ? timeClip(utcTime(runtime, date)) : timeClip(date);
   self->setPrimitiveValue(utcT);
   return HermesValue::encodeTrustedNumberValue(utcT);
 }
@@ -773,7 +794,7 @@ datePrototypeSetMinutes_RJS(void *ctx, Runtime &runtime, NativeArgs args) {
   }
   double t = self->getPrimitiveValue();
   if (!isUTC) {
-    t = localTime(t);
+    t = localTime(runtime, t);
   }
   auto res = toNumber_RJS(runtime, args.getArgHandle(0));
   if (res == ExecutionStatus::EXCEPTION) {
@@ -802,7 +823,7 @@ datePrototypeSetMinutes_RJS(void *ctx, Runtime &runtime, NativeArgs args) {
   }
 
   double date = makeDate(day(t), makeTime(hourFromTime(t), m, s, milli));
-  double utcT = !isUTC ? timeClip(utcTime(date)) : timeClip(date);
+  double utcT = !isUTC ? timeClip(utcTime(runtime, date)) : timeClip(date);
   self->setPrimitiveValue(utcT);
   return HermesValue::encodeTrustedNumberValue(utcT);
 }
@@ -819,7 +840,7 @@ datePrototypeSetHours_RJS(void *ctx, Runtime &runtime, NativeArgs args) {
   }
   double t = self->getPrimitiveValue();
   if (!isUTC) {
-    t = localTime(t);
+    t = localTime(runtime, t);
   }
   auto res = toNumber_RJS(runtime, args.getArgHandle(0));
   if (res == ExecutionStatus::EXCEPTION) {
@@ -858,7 +879,7 @@ datePrototypeSetHours_RJS(void *ctx, Runtime &runtime, NativeArgs args) {
   }
 
   double date = makeDate(day(t), makeTime(h, m, s, milli));
-  double utcT = !isUTC ? timeClip(utcTime(date)) : timeClip(date);
+  double utcT = !isUTC ? timeClip(utcTime(runtime, date)) : timeClip(date);
   self->setPrimitiveValue(utcT);
   return HermesValue::encodeTrustedNumberValue(utcT);
 }
@@ -874,7 +895,7 @@ datePrototypeSetDate_RJS(void *ctx, Runtime &runtime, NativeArgs args) {
   }
   double t = self->getPrimitiveValue();
   if (!isUTC) {
-    t = localTime(t);
+    t = localTime(runtime, t);
   }
   auto res = toNumber_RJS(runtime, args.getArgHandle(0));
   if (res == ExecutionStatus::EXCEPTION) {
@@ -883,7 +904,8 @@ datePrototypeSetDate_RJS(void *ctx, Runtime &runtime, NativeArgs args) {
   double dt = res->getNumber();
   double newDate = makeDate(
       makeDay(yearFromTime(t), monthFromTime(t), dt), timeWithinDay(t));
-  double utcT = !isUTC ? timeClip(utcTime(newDate)) : timeClip(newDate);
+  double utcT =
+      !isUTC ? timeClip(utcTime(runtime, newDate)) : timeClip(newDate);
   self->setPrimitiveValue(utcT);
   return HermesValue::encodeTrustedNumberValue(utcT);
 }
@@ -900,7 +922,7 @@ datePrototypeSetMonth_RJS(void *ctx, Runtime &runtime, NativeArgs args) {
   }
   double t = self->getPrimitiveValue();
   if (!isUTC) {
-    t = localTime(t);
+    t = localTime(runtime, t);
   }
   auto res = toNumber_RJS(runtime, args.getArgHandle(0));
   if (res == ExecutionStatus::EXCEPTION) {
@@ -918,7 +940,8 @@ datePrototypeSetMonth_RJS(void *ctx, Runtime &runtime, NativeArgs args) {
     dt = dateFromTime(t);
   }
   double newDate = makeDate(makeDay(yearFromTime(t), m, dt), timeWithinDay(t));
-  double utcT = !isUTC ? timeClip(utcTime(newDate)) : timeClip(newDate);
+  double utcT =
+      !isUTC ? timeClip(utcTime(runtime, newDate)) : timeClip(newDate);
   self->setPrimitiveValue(utcT);
   return HermesValue::encodeTrustedNumberValue(utcT);
 }
@@ -935,7 +958,7 @@ datePrototypeSetFullYear_RJS(void *ctx, Runtime &runtime, NativeArgs args) {
   }
   double t = self->getPrimitiveValue();
   if (!isUTC) {
-    t = localTime(t);
+    t = localTime(runtime, t);
   }
   if (std::isnan(t)) {
     t = 0;
@@ -966,7 +989,8 @@ datePrototypeSetFullYear_RJS(void *ctx, Runtime &runtime, NativeArgs args) {
     dt = dateFromTime(t);
   }
   double newDate = makeDate(makeDay(y, m, dt), timeWithinDay(t));
-  double utcT = !isUTC ? timeClip(utcTime(newDate)) : timeClip(newDate);
+  double utcT =
+      !isUTC ? timeClip(utcTime(runtime, newDate)) : timeClip(newDate);
   self->setPrimitiveValue(utcT);
   return HermesValue::encodeTrustedNumberValue(utcT);
 }
@@ -982,7 +1006,7 @@ datePrototypeSetYear_RJS(void *ctx, Runtime &runtime, NativeArgs args) {
         "Date.prototype.setYear() called on non-Date object");
   }
   double t = self->getPrimitiveValue();
-  t = localTime(t);
+  t = localTime(runtime, t);
   if (std::isnan(t)) {
     t = 0;
   }
@@ -997,8 +1021,10 @@ datePrototypeSetYear_RJS(void *ctx, Runtime &runtime, NativeArgs args) {
   }
   double yint = std::trunc(y);
   double yr = 0 <= yint && yint <= 99 ? yint + 1900 : y;
-  double date = utcTime(makeDate(
-      makeDay(yr, monthFromTime(t), dateFromTime(t)), timeWithinDay(t)));
+  double date = utcTime(
+      runtime,
+      makeDate(
+          makeDay(yr, monthFromTime(t), dateFromTime(t)), timeWithinDay(t)));
   double d = timeClip(date);
   self->setPrimitiveValue(d);
   return HermesValue::encodeTrustedNumberValue(d);
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "hermes/VM/JSLib/DateCache.h"
+
+#include "hermes/VM/JSLib/DateUtil.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <limits>
+
+namespace hermes {
+namespace vm {
+
+/// Numbers are from ES5.1 15.9.1.1 Time Values and Time Range.
+static constexpr int64_t kTimeRangeSecs = 24 * 60 * 60 * 100000000LL;
+
+/// Transitions are searched for by checking whether DST is in effect once per
+/// step, and then bisecting the steps in which it changes. Zones that enter and
+/// leave DST within a single step are not expected.
+static constexpr int64_t kTransitionScanStepSecs = 7 * 24 * 60 * 60;
+
+/// \return whether DST is in effect at \p secs seconds since Jan 1 1970 UTC,
+/// matching the interpretation of tm_isdst in daylightSavingTA().
+static bool isDSTAt(int64_t secs) {
+  time_t local = static_cast<time_t>(secs);
+  std::tm *brokenTime = std::localtime(&local);
+  return brokenTime && brokenTime->tm_isdst;
+}
+
+void LocalTimeOffsetCache::checkTimeZone() {
+  conversionsUntilCheck_ = kConversionsPerCheck;
+  const char *tz = std::getenv("TZ");
+  auto now = std::chrono::steady_clock::now();
+  if (valid_ && now < validUntil_ && (tz ? hasTZ_ && tz_ == tz : !hasTZ_)) {
+    return;
+  }
+
+  // localTZA() calls tzset(), so localtime() observes the new time zone from
+  // here on.
+  ltza_ = vm::localTZA();
+  for (YearTransitions &year : years_) {
+    year.computed = false;
+    year.transitions.clear();
+  }
+  hasTZ_ = tz != nullptr;
+  tz_ = tz ? tz : "";
+  validUntil_ = now + kRevalidateInterval;
+  valid_ = true;
+}
+
+double LocalTimeOffsetCache::cachedDaylightSavingTA(double t) {
+  assert(valid_ && "the cache must be valid");
+  if (!std::isfinite(t)) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  const double seconds = t / MS_PER_SECOND;
+  if (seconds > kTimeRangeSecs || seconds < -kTimeRangeSecs) {
+    // Return NaN if input is outside Time Range allowed in ES5.1
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  // This will truncate any fractional seconds, which is ok for daylight
+  // savings time calculations.
+  int32_t local = detail::equivalentTime(static_cast<int64_t>(seconds));
+
+  // Equivalent times are in [1970, 2037], where every fourth year starting
+  // with 1972 is a leap year, so the year can be found from the day number.
+  const int32_t days = local / (24 * 60 * 60);
+  const YearTransitions &year =
+      getYearTransitions(1970 + (days * 4 + 2) / 1461);
+  // DST flips at every transition at or before local.
+  auto begin = year.transitions.begin();
+  size_t numPassed =
+      std::upper_bound(begin, year.transitions.end(), local) - begin;
+  bool isDST = year.dstAtStart != (numPassed % 2 == 1);
+  return isDST ? MS_PER_HOUR : 0;
+}
+
+const LocalTimeOffsetCache::YearTransitions &
+LocalTimeOffsetCache::getYearTransitions(int32_t year) {
+  assert(
+      year >= 1970 && year < 1970 + (int32_t)kNumYears &&
+      "equivalent year out of range");
+  YearTransitions &entry = years_[year - 1970];
+  if (entry.computed) {
+    return entry;
+  }
+
+  const int64_t yearStart = timeFromYear(year) / MS_PER_SECOND;
+  const int64_t yearEnd = timeFromYear(year + 1) / MS_PER_SECOND;
+
+  // Invariant: DST is in effect at lo iff loDST.
+  int64_t lo = yearStart;
+  bool loDST = isDSTAt(lo);
+  entry.dstAtStart = loDST;
+  while (lo < yearEnd - 1) {
+    int64_t hi = std::min(lo + kTransitionScanStepSecs, yearEnd - 1);
+    if (isDSTAt(hi) != loDST) {
+      // Find the first second in (lo, hi] at which DST flips.
+      while (hi - lo > 1) {
+        int64_t mid = lo + (hi - lo) / 2;
+        if (isDSTAt(mid) == loDST) {
+          lo = mid;
+        } else {
+          hi = mid;
+        }
+      }
+      entry.transitions.push_back(static_cast<int32_t>(hi));
+      loDST = !loDST;
+    }
+    lo = hi;
+  }
+
+  entry.computed = true;
+  return entry;
+}
+
+} // namespace vm
+} // namespace hermes
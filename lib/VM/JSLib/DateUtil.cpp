@@ -11,6 +11,7 @@
 #include "hermes/Support/Compiler.h"
 #include "hermes/Support/OSCompat.h"
 #include "hermes/VM/CallResult.h"
+#include "hermes/VM/JSLib/DateCache.h"
 #include "hermes/VM/JSLib/RuntimeCommonStorage.h"
 #include "hermes/VM/SmallXString.h"
 
@@ -18,6 +19,7 @@
 #include "llvh/Support/Format.h"
 #include "llvh/Support/raw_ostream.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cctype>
 #include <cmath>
@@ -167,10 +169,11 @@ uint32_t monthFromTime(double t) {
   double dayWithinYear = day(t) - dayFromYear(yearFromTime(t));
   constexpr int8_t kDaysInMonthNonLeap[11] = {
       31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30};
+  const bool leap = inLeapYear(t);
   double curDay = 0.0;
   for (uint32_t i = 0; i < 11; ++i) {
-    curDay += (i == 1 && inLeapYear(t)) ? kDaysInMonthNonLeap[i] + 1
-                                        : kDaysInMonthNonLeap[i];
+    curDay += (i == 1 && leap) ? kDaysInMonthNonLeap[i] + 1
+                               : kDaysInMonthNonLeap[i];
     if (dayWithinYear < curDay)
       return i;
   }
@@ -504,45 +507,92 @@ double timeClip(double t) {
 //===----------------------------------------------------------------------===//
 // toString Functions
 
-void dateToISOString(double t, double, llvh::SmallVectorImpl<char> &buf) {
-  llvh::raw_svector_ostream os{buf};
+/// Compute the year \p y, zero-indexed month \p m and one-indexed date \p d
+/// of the finite timestamp \p t. This is equivalent to yearFromTime(t),
+/// monthFromTime(t) and dateFromTime(t), which each recompute the year with
+/// floating point arithmetic.
+static void
+yearMonthDateFromTime(double t, int32_t *y, int32_t *m, int32_t *d) {
+  // This is the civil_from_days algorithm from
+  // http://howardhinnant.github.io/date_algorithms.html. It counts years from
+  // March 1st, so that leap days are at the end of the year, and 400-year eras
+  // from March 1st, 0000.
+  int64_t days = static_cast<int64_t>(day(t)) + 719468;
+  int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+  int64_t dayOfEra = days - era * 146097;
+  int64_t yearOfEra =
+      (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+  int64_t dayOfYear =
+      dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+  // The month, counting from March.
+  int64_t marchMonth = (5 * dayOfYear + 2) / 153;
+  *d = dayOfYear - (153 * marchMonth + 2) / 5 + 1;
+  *m = marchMonth < 10 ? marchMonth + 2 : marchMonth - 10;
+  *y = yearOfEra + era * 400 + (*m < 2);
+}
+
+/// Append \p value to \p buf in decimal, padded to the left with zeros to at
+/// least \p width digits.
+static void
+appendPaddedInt(llvh::SmallVectorImpl<char> &buf, uint32_t value, int width) {
+  char digits[10];
+  int numDigits = 0;
+  do {
+    digits[numDigits++] = '0' + value % 10;
+    value /= 10;
+  } while (value != 0);
+  for (int i = numDigits; i < width; ++i) {
+    buf.push_back('0');
+  }
+  while (numDigits > 0) {
+    buf.push_back(digits[--numDigits]);
+  }
+}
 
-  /// Make these ints here because we're printing and we have bounds on
-  /// their values. Makes printing very easy.
-  int32_t y = yearFromTime(t);
-  int32_t m = monthFromTime(t) + 1; // monthFromTime(t) is 0-indexed.
-  int32_t d = dateFromTime(t);
+void dateToISOString(double t, double, llvh::SmallVectorImpl<char> &buf) {
+  // The ISO strings are written digit by digit, since they are commonly
+  // produced in bulk (e.g. by JSON.stringify), and formatting them through
+  // raw_ostream dominates the cost.
+  int32_t y, m, d;
+  yearMonthDateFromTime(t, &y, &m, &d);
 
   if (y < 0 || y > 9999) {
     // Handle extended years.
-    os << llvh::format("%+07d-%02d-%02d", y, m, d);
+    buf.push_back(y < 0 ? '-' : '+');
+    appendPaddedInt(buf, std::abs(y), 6);
   } else {
-    os << llvh::format("%04d-%02d-%02d", y, m, d);
+    appendPaddedInt(buf, y, 4);
   }
+  buf.push_back('-');
+  // m is 0-indexed.
+  appendPaddedInt(buf, m + 1, 2);
+  buf.push_back('-');
+  appendPaddedInt(buf, d, 2);
 }
 
 void timeToISOString(double t, double tza, llvh::SmallVectorImpl<char> &buf) {
-  llvh::raw_svector_ostream os{buf};
-
-  /// Make all of these ints here because we're printing and we have bounds on
-  /// their values. Makes printing very easy.
-  int32_t h = hourFromTime(t);
-  int32_t min = minFromTime(t);
-  int32_t s = secFromTime(t);
-  int32_t ms = msFromTime(t);
+  // Compute the fields from the time within the day, which is equivalent to
+  // hourFromTime(t), minFromTime(t), secFromTime(t) and msFromTime(t).
+  uint32_t msWithinDay = timeWithinDay(t);
+  appendPaddedInt(buf, msWithinDay / (uint32_t)MS_PER_HOUR, 2);
+  buf.push_back(':');
+  appendPaddedInt(buf, msWithinDay / (uint32_t)MS_PER_MINUTE % 60, 2);
+  buf.push_back(':');
+  appendPaddedInt(buf, msWithinDay / (uint32_t)MS_PER_SECOND % 60, 2);
+  buf.push_back('.');
+  appendPaddedInt(buf, msWithinDay % (uint32_t)MS_PER_SECOND, 3);
 
   if (tza == 0) {
     // Zulu time, output Z as the time zone.
-    os << llvh::format("%02d:%02d:%02d.%03dZ", h, min, s, ms);
+    buf.push_back('Z');
   } else {
     // Calculate the +HH:mm expression for the time zone adjustment.
     // First account for the sign, then perform calculations on positive TZA.
-    char sign = tza >= 0 ? '+' : '-';
+    buf.push_back(tza >= 0 ? '+' : '-');
     double tzaPos = std::abs(tza);
-    int32_t tzh = hourFromTime(tzaPos);
-    int32_t tzm = minFromTime(tzaPos);
-    os << llvh::format(
-        "%02d:%02d:%02d.%03d%c%02d:%02d", h, min, s, ms, sign, tzh, tzm);
+    appendPaddedInt(buf, hourFromTime(tzaPos), 2);
+    buf.push_back(':');
+    appendPaddedInt(buf, minFromTime(tzaPos), 2);
   }
 }
 
@@ -607,9 +657,8 @@ void dateString(double t, double, llvh::SmallVectorImpl<char> &buf) {
 
   // Make these ints here because we're printing and we have bounds on
   // their values. Makes printing very easy.
-  int32_t y = yearFromTime(t);
-  int32_t m = monthFromTime(t); // monthFromTime(t) is 0-indexed.
-  int32_t d = dateFromTime(t);
+  int32_t y, m, d; // m is 0-indexed.
+  yearMonthDateFromTime(t, &y, &m, &d);
   int32_t wd = weekDay(t);
 
   // 7. Return the string-concatenation of weekday, the code unit 0x0020
@@ -680,9 +729,8 @@ void dateTimeUTCString(
 
   // Make these ints here because we're printing and we have bounds on
   // their values. Makes printing very easy.
-  int32_t y = yearFromTime(tv);
-  int32_t m = monthFromTime(tv); // monthFromTime(t) is 0-indexed.
-  int32_t d = dateFromTime(tv);
+  int32_t y, m, d; // m is 0-indexed.
+  yearMonthDateFromTime(tv, &y, &m, &d);
   int32_t wd = weekDay(tv);
 
   // 8. Return the string-concatenation of weekday, ",", the code unit 0x0020
@@ -721,22 +769,28 @@ static inline bool isAlpha(char16_t c) {
 /// successful.
 /// \param end the end of the string.
 /// \param[out] x modified to contain the scanned integer.
-/// \return true if successful, false if failed.
+/// \return true if successful, false if failed, i.e. if there are no digits
+/// or the integer does not fit in an int32_t.
 template <class InputIter>
 static bool scanInt(InputIter &it, const InputIter end, int32_t &x) {
-  llvh::SmallString<16> str{};
-  if (it == end) {
+  if (it == end || !isDigit(*it)) {
     return false;
   }
+  // Accumulate the digits directly, saturating once the result is known to be
+  // too large.
+  constexpr int64_t kMax = std::numeric_limits<int32_t>::max();
+  int64_t result = 0;
   for (; it != end && isDigit(*it); ++it) {
-    str += static_cast<char>(*it);
+    result = std::min(result * 10 + (*it - u'0'), kMax + 1);
   }
-  llvh::StringRef ref{str};
-  // getAsInteger returns false to signify success.
-  return !ref.getAsInteger(10, x);
+  if (result > kMax) {
+    return false;
+  }
+  x = static_cast<int32_t>(result);
+  return true;
 }
 
-static double parseISODate(StringView u16str) {
+static double parseISODate(StringView u16str, LocalTimeOffsetCache &cache) {
   constexpr double nan = std::numeric_limits<double>::quiet_NaN();
 
   auto it = u16str.begin();
@@ -821,7 +875,7 @@ static double parseISODate(StringView u16str) {
       // forms are interpreted as a UTC time and date-time forms are interpreted
       // as a local time.
       double t = makeDate(makeDay(y, m - 1, d), makeTime(h, min, s, ms));
-      t = utcTime(t);
+      t = cache.utcTime(t);
       return t;
     }
 
@@ -866,7 +920,7 @@ static double parseISODate(StringView u16str) {
   return makeDate(makeDay(y, m - 1, d), makeTime(h - tzh, min - tzm, s, ms));
 }
 
-static double parseESDate(StringView str) {
+static double parseESDate(StringView str, LocalTimeOffsetCache &cache) {
   constexpr double nan = std::numeric_limits<double>::quiet_NaN();
   StringView tok = str;
 
@@ -1030,7 +1084,7 @@ static double parseESDate(StringView str) {
   if (it == end) {
     // Default to local time zone if no time zone provided
     double t = makeDate(makeDay(y, m - 1, d), makeTime(h, min, s, ms));
-    t = utcTime(t);
+    t = cache.utcTime(t);
     return t;
   }
 
@@ -1110,13 +1164,13 @@ complete:
   return makeDate(makeDay(y, m - 1, d), makeTime(h - tzh, min - tzm, s, ms));
 }
 
-double parseDate(StringView str) {
-  double result = parseISODate(str);
+double parseDate(StringView str, LocalTimeOffsetCache &cache) {
+  double result = parseISODate(str, cache);
   if (!std::isnan(result)) {
     return result;
   }
 
-  return parseESDate(str);
+  return parseESDate(str, cache);
 }
 
 } // namespace vm
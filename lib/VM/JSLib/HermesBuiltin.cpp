@@ -480,6 +480,20 @@ hermesBuiltinCopyRestArgs(void *, Runtime &runtime, NativeArgs args) {
   return array.getHermesValue();
 }
 
+/// \return true if spreading \p arr can read its elements directly, because
+/// `arr[Symbol.iterator]` is still the builtin Array.prototype.values.
+static bool isArrayIterationUnmodified(Runtime &runtime, Handle<JSArray> arr) {
+  NamedPropertyDescriptor desc;
+  PseudoHandle<JSObject> propObj =
+      createPseudoHandle(JSObject::getNamedDescriptorPredefined(
+          arr, runtime, Predefined::SymbolIterator, desc));
+  if (LLVM_UNLIKELY(!propObj) || LLVM_UNLIKELY(desc.flags.proxyObject))
+    return false;
+  return JSObject::getNamedSlotValueUnsafe(propObj.get(), runtime, desc)
+             .unboxToHV(runtime)
+             .getRaw() == runtime.arrayPrototypeValues.getRaw();
+}
+
 /// \code
 ///   HermesBuiltin.arraySpread = function(target, source, nextIndex) {}
 /// /endcode
@@ -500,60 +514,45 @@ hermesBuiltinArraySpread(void *, Runtime &runtime, NativeArgs args) {
   MutableHandle<> nextValue{runtime};
 
   Handle<JSArray> arr = args.dyncastArg<JSArray>(1);
-  if (arr) {
-    // Copying from an array, first check and make sure that
-    // `arr[Symbol.iterator]` hasn't been changed by the user.
-    NamedPropertyDescriptor desc;
-    PseudoHandle<JSObject> propObj =
-        createPseudoHandle(JSObject::getNamedDescriptorPredefined(
-            arr, runtime, Predefined::SymbolIterator, desc));
-    if (LLVM_LIKELY(propObj) && LLVM_LIKELY(!desc.flags.proxyObject)) {
-      PseudoHandle<> slotValue = createPseudoHandle(
-          JSObject::getNamedSlotValueUnsafe(propObj.get(), runtime, desc)
-              .unboxToHV(runtime));
-      propObj.invalidate();
-      if (LLVM_LIKELY(
-              slotValue->getRaw() == runtime.arrayPrototypeValues.getRaw())) {
-        slotValue.invalidate();
-        auto nextIndex = args.getArg(2).getNumberAs<JSArray::size_type>();
-        MutableHandle<> idxHandle{runtime};
-        GCScopeMarkerRAII marker{runtime};
-        for (JSArray::size_type i = 0; i < JSArray::getLength(*arr, runtime);
-             ++i) {
-          marker.flush();
-          // Fast path: look up the property in indexed storage.
-          nextValue = arr->at(runtime, i).unboxToHV(runtime);
-          if (LLVM_UNLIKELY(nextValue->isEmpty())) {
-            // Slow path, just run the full getComputed_RJS path.
-            // Runs when there is a hole, accessor, non-regular property, etc.
-            idxHandle = HermesValue::encodeTrustedNumberValue(i);
-            CallResult<PseudoHandle<>> valueRes =
-                JSObject::getComputed_RJS(arr, runtime, idxHandle);
-            if (LLVM_UNLIKELY(valueRes == ExecutionStatus::EXCEPTION)) {
-              return ExecutionStatus::EXCEPTION;
-            }
-            nextValue = std::move(*valueRes);
-          }
-          // It is valid to use setElementAt here because we know that
-          // `target` was created immediately prior to running the spread
-          // and no non-standard properties were added to it,
-          // because the only actions that can be performed between array
-          // creation and running this spread are DefineOwnProperty calls with
-          // standard flags (as well as other spread operations, which do the
-          // same thing).
-          JSArray::setElementAt(target, runtime, nextIndex, nextValue);
-          ++nextIndex;
-        }
-
-        if (LLVM_UNLIKELY(
-                JSArray::setLengthProperty(target, runtime, nextIndex) ==
-                ExecutionStatus::EXCEPTION)) {
+  // Copying from an array, first check and make sure that
+  // `arr[Symbol.iterator]` hasn't been changed by the user.
+  if (arr && LLVM_LIKELY(isArrayIterationUnmodified(runtime, arr))) {
+    auto nextIndex = args.getArg(2).getNumberAs<JSArray::size_type>();
+    MutableHandle<> idxHandle{runtime};
+    GCScopeMarkerRAII marker{runtime};
+    for (JSArray::size_type i = 0; i < JSArray::getLength(*arr, runtime); ++i) {
+      marker.flush();
+      // Fast path: look up the property in indexed storage.
+      nextValue = arr->at(runtime, i).unboxToHV(runtime);
+      if (LLVM_UNLIKELY(nextValue->isEmpty())) {
+        // Slow path, just run the full getComputed_RJS path.
+        // Runs when there is a hole, accessor, non-regular property, etc.
+        idxHandle = HermesValue::encodeTrustedNumberValue(i);
+        CallResult<PseudoHandle<>> valueRes =
+            JSObject::getComputed_RJS(arr, runtime, idxHandle);
+        if (LLVM_UNLIKELY(valueRes == ExecutionStatus::EXCEPTION)) {
           return ExecutionStatus::EXCEPTION;
         }
-
-        return HermesValue::encodeTrustedNumberValue(nextIndex);
+        nextValue = std::move(*valueRes);
       }
+      // It is valid to use setElementAt here because we know that
+      // `target` was created immediately prior to running the spread
+      // and no non-standard properties were added to it,
+      // because the only actions that can be performed between array
+      // creation and running this spread are DefineOwnProperty calls with
+      // standard flags (as well as other spread operations, which do the
+      // same thing).
+      JSArray::setElementAt(target, runtime, nextIndex, nextValue);
+      ++nextIndex;
     }
+
+    if (LLVM_UNLIKELY(
+            JSArray::setLengthProperty(target, runtime, nextIndex) ==
+            ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+
+    return HermesValue::encodeTrustedNumberValue(nextIndex);
   }
 
   // 3. Let iteratorRecord be ? GetIterator(spreadObj).
@@ -567,24 +566,34 @@ hermesBuiltinArraySpread(void *, Runtime &runtime, NativeArgs args) {
 
   // 4. Repeat,
   for (GCScopeMarkerRAII marker{runtime}; /* nothing */; marker.flush()) {
-    // a. Let next be ? IteratorStep(iteratorRecord).
-    auto nextRes = iteratorStep(runtime, iteratorRecord);
-    if (LLVM_UNLIKELY(nextRes == ExecutionStatus::EXCEPTION)) {
-      return ExecutionStatus::EXCEPTION;
-    }
-    Handle<JSObject> next = *nextRes;
+    if (auto valueRes = builtinIteratorStepValue(runtime, iteratorRecord)) {
+      if (LLVM_UNLIKELY(*valueRes == ExecutionStatus::EXCEPTION)) {
+        return ExecutionStatus::EXCEPTION;
+      }
+      if ((*valueRes)->isEmpty()) {
+        return nextIndex.getHermesValue();
+      }
+      nextValue = **valueRes;
+    } else {
+      // a. Let next be ? IteratorStep(iteratorRecord).
+      auto nextRes = iteratorStep(runtime, iteratorRecord);
+      if (LLVM_UNLIKELY(nextRes == ExecutionStatus::EXCEPTION)) {
+        return ExecutionStatus::EXCEPTION;
+      }
+      Handle<JSObject> next = *nextRes;
 
-    // b. If next is false, return nextIndex.
-    if (!next) {
-      return nextIndex.getHermesValue();
-    }
-    // c. Let nextValue be ? IteratorValue(next).
-    auto nextItemRes = JSObject::getNamed_RJS(
-        next, runtime, Predefined::getSymbolID(Predefined::value));
-    if (LLVM_UNLIKELY(nextItemRes == ExecutionStatus::EXCEPTION)) {
-      return ExecutionStatus::EXCEPTION;
+      // b. If next is false, return nextIndex.
+      if (!next) {
+        return nextIndex.getHermesValue();
+      }
+      // c. Let nextValue be ? IteratorValue(next).
+      auto nextItemRes = JSObject::getNamed_RJS(
+          next, runtime, Predefined::getSymbolID(Predefined::value));
+      if (LLVM_UNLIKELY(nextItemRes == ExecutionStatus::EXCEPTION)) {
+        return ExecutionStatus::EXCEPTION;
+      }
+      nextValue = std::move(*nextItemRes);
     }
-    nextValue = std::move(*nextItemRes);
 
     // d. Let status be CreateDataProperty(array,
     //    ToString(ToUint32(nextIndex)), nextValue).
@@ -607,34 +616,17 @@ hermesBuiltinArraySpread(void *, Runtime &runtime, NativeArgs args) {
   return nextIndex.getHermesValue();
 }
 
-/// \code
-///   HermesBuiltin.apply = function(fn, argArray, thisVal(opt)) {}
-/// /endcode
-/// Faster version of Function.prototype.apply which does not use its `this`
-/// argument.
-/// `argArray` must be a JSArray with no getters.
-/// Equivalent to fn.apply(thisVal, argArray) if thisVal is provided.
-/// If thisVal is not provided, equivalent to running `new fn` and passing the
-/// arguments in argArray.
-CallResult<HermesValue>
-hermesBuiltinApply(void *, Runtime &runtime, NativeArgs args) {
-  GCScopeMarkerRAII marker{runtime};
-
-  Handle<Callable> fn = args.dyncastArg<Callable>(0);
-  if (LLVM_UNLIKELY(!fn)) {
-    return runtime.raiseTypeErrorForValue(
-        args.getArgHandle(0), " is not a function");
-  }
-
-  Handle<JSArray> argArray = args.dyncastArg<JSArray>(1);
-  if (LLVM_UNLIKELY(!argArray)) {
-    return runtime.raiseTypeError("args must be an array");
-  }
-
+/// Call \p fn with the elements of the dense \p argArray, or construct a new
+/// object with it if \p isConstructor is true. \p thisVal is ignored in that
+/// case.
+static CallResult<HermesValue> applyArgArray(
+    Runtime &runtime,
+    Handle<Callable> fn,
+    Handle<JSArray> argArray,
+    bool isConstructor,
+    Handle<> thisValHandle) {
   uint32_t len = JSArray::getLength(*argArray, runtime);
 
-  bool isConstructor = args.getArgCount() == 2;
-
   MutableHandle<> thisVal{runtime};
   if (isConstructor) {
     auto thisValRes = Callable::createThisForConstruct_RJS(fn, runtime);
@@ -643,7 +635,7 @@ hermesBuiltinApply(void *, Runtime &runtime, NativeArgs args) {
     }
     thisVal = thisValRes->getHermesValue();
   } else {
-    thisVal = args.getArg(2);
+    thisVal = thisValHandle.getHermesValue();
   }
 
   ScopedNativeCallFrame newFrame{
@@ -672,6 +664,104 @@ hermesBuiltinApply(void *, Runtime &runtime, NativeArgs args) {
   return res->getHermesValue();
 }
 
+/// \code
+///   HermesBuiltin.apply = function(fn, argArray, thisVal(opt)) {}
+/// /endcode
+/// Faster version of Function.prototype.apply which does not use its `this`
+/// argument.
+/// `argArray` must be a JSArray with no getters.
+/// Equivalent to fn.apply(thisVal, argArray) if thisVal is provided.
+/// If thisVal is not provided, equivalent to running `new fn` and passing the
+/// arguments in argArray.
+CallResult<HermesValue>
+hermesBuiltinApply(void *, Runtime &runtime, NativeArgs args) {
+  GCScopeMarkerRAII marker{runtime};
+
+  Handle<Callable> fn = args.dyncastArg<Callable>(0);
+  if (LLVM_UNLIKELY(!fn)) {
+    return runtime.raiseTypeErrorForValue(
+        args.getArgHandle(0), " is not a function");
+  }
+
+  Handle<JSArray> argArray = args.dyncastArg<JSArray>(1);
+  if (LLVM_UNLIKELY(!argArray)) {
+    return runtime.raiseTypeError("args must be an array");
+  }
+
+  return applyArgArray(
+      runtime,
+      fn,
+      argArray,
+      args.getArgCount() == 2,
+      args.getArgHandle(2));
+}
+
+/// \code
+///   HermesBuiltin.applySpread = function(fn, iterable, thisVal(opt)) {}
+/// /endcode
+/// Equivalent to HermesBuiltin.apply(fn, [...iterable], thisVal), used for
+/// calls whose only argument is a spread element, like `fn(...args)`.
+/// When \p iterable is a dense array with the builtin iterator, its elements
+/// are copied directly into the new frame, without the intermediate array.
+CallResult<HermesValue>
+hermesBuiltinApplySpread(void *, Runtime &runtime, NativeArgs args) {
+  GCScopeMarkerRAII marker{runtime};
+
+  bool isConstructor = args.getArgCount() == 2;
+  Handle<JSArray> arr = args.dyncastArg<JSArray>(1);
+  // Constructing needs the arguments before creating `this`, which may run
+  // a getter, so it always takes the slow path.
+  if (!isConstructor && arr &&
+      LLVM_LIKELY(isArrayIterationUnmodified(runtime, arr))) {
+    uint32_t len = JSArray::getLength(*arr, runtime);
+    // Holes are read through the prototype chain, which may run getters.
+    // Check for them before pushing a frame.
+    bool dense = true;
+    for (uint32_t i = 0; i < len; ++i) {
+      if (arr->at(runtime, i).isEmpty()) {
+        dense = false;
+        break;
+      }
+    }
+    if (LLVM_LIKELY(dense)) {
+      Handle<Callable> fn = args.dyncastArg<Callable>(0);
+      if (LLVM_UNLIKELY(!fn)) {
+        return runtime.raiseTypeErrorForValue(
+            args.getArgHandle(0), " is not a function");
+      }
+      ScopedNativeCallFrame newFrame{runtime, len, *fn, false, args.getArg(2)};
+      if (LLVM_UNLIKELY(newFrame.overflowed()))
+        return runtime.raiseStackOverflow(
+            Runtime::StackOverflowKind::NativeStack);
+      for (uint32_t i = 0; i < len; ++i)
+        newFrame->getArgRef(i) = arr->at(runtime, i).unboxToHV(runtime);
+      auto res = Callable::call(fn, runtime);
+      if (LLVM_UNLIKELY(res == ExecutionStatus::EXCEPTION)) {
+        return ExecutionStatus::EXCEPTION;
+      }
+      return res->getHermesValue();
+    }
+  }
+
+  // The arguments are evaluated before checking the callee.
+  CallResult<Handle<JSArray>> argArrayRes =
+      iterableToArray(runtime, args.getArgHandle(1));
+  if (LLVM_UNLIKELY(argArrayRes == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  Handle<Callable> fn = args.dyncastArg<Callable>(0);
+  if (LLVM_UNLIKELY(!fn)) {
+    return runtime.raiseTypeErrorForValue(
+        args.getArgHandle(0), " is not a function");
+  }
+  return applyArgArray(
+      runtime,
+      fn,
+      *argArrayRes,
+      isConstructor,
+      args.getArgHandle(2));
+}
+
 /// HermesBuiltin.exportAll(exports, source) will copy exported named
 /// properties from `source` to `exports`, defining them on `exports` as
 /// non-configurable.
@@ -837,6 +927,11 @@ void createHermesBuiltins(
       hermesBuiltinArraySpread,
       2);
   defineInternMethod(B::HermesBuiltin_apply, P::apply, hermesBuiltinApply, 2);
+  defineInternMethod(
+      B::HermesBuiltin_applySpread,
+      P::applySpread,
+      hermesBuiltinApplySpread,
+      2);
   defineInternMethod(
       B::HermesBuiltin_exportAll, P::exportAll, hermesBuiltinExportAll);
   defineInternMethod(
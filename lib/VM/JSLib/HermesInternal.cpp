@@ -513,8 +513,9 @@ hermesInternalUseEngineQueue(void *, Runtime &runtime, NativeArgs args) {
 }
 
 /// \code
-///   HermesInternal.enqueueJob = function (func) {}
+///   HermesInternal.enqueueJob = function (func, arg) {}
 /// \endcode
+/// \p arg is optional, and is passed to \p func when the job runs.
 CallResult<HermesValue>
 hermesInternalEnqueueJob(void *, Runtime &runtime, NativeArgs args) {
   auto callable = args.dyncastArg<Callable>(0);
@@ -522,7 +523,10 @@ hermesInternalEnqueueJob(void *, Runtime &runtime, NativeArgs args) {
     return runtime.raiseTypeError(
         "Argument to HermesInternal.enqueueJob must be callable");
   }
-  runtime.enqueueJob(callable.get());
+  runtime.enqueueJob(
+      callable.get(),
+      args.getArgCount() > 1 ? args.getArg(1)
+                             : HermesValue::encodeEmptyValue());
   return HermesValue::encodeUndefinedValue();
 }
 
@@ -550,6 +554,25 @@ hermesInternalGetCallStack(void *, Runtime &runtime, NativeArgs args) {
 }
 #endif // HERMESVM_EXCEPTION_ON_OOM
 
+#ifdef HERMES_MEMORY_INSTRUMENTATION
+/// \return the per-function allocation profile as a JSON string, or undefined
+/// if allocation attribution is not enabled.
+CallResult<HermesValue>
+hermesInternalGetAllocationProfile(void *, Runtime &runtime, NativeArgs args) {
+  if (!runtime.getHeap().getSamplingAllocationTracker().isAttributing())
+    return HermesValue::encodeUndefinedValue();
+  std::string json;
+  llvh::raw_string_ostream OS(json);
+  runtime.emitAllocationAttribution(OS);
+  OS.flush();
+  // Function names may contain arbitrary UTF-8.
+  return StringPrimitive::createEfficient(
+      runtime,
+      UTF8Ref(reinterpret_cast<const uint8_t *>(json.data()), json.size()),
+      true);
+}
+#endif // HERMES_MEMORY_INSTRUMENTATION
+
 /// \return the code block associated with \p callableHandle if it is a
 /// (possibly bound) JS function, or nullptr otherwise.
 static const CodeBlock *getLeafCodeBlock(
@@ -923,6 +946,10 @@ Handle<JSObject> createHermesInternalObject(
   defineInternMethod(P::ttiReached, hermesInternalTTIReached);
   defineInternMethod(P::ttrcReached, hermesInternalTTRCReached);
   defineInternMethod(P::getFunctionLocation, hermesInternalGetFunctionLocation);
+#ifdef HERMES_MEMORY_INSTRUMENTATION
+  defineInternMethodAndSymbol(
+      "getAllocationProfile", hermesInternalGetAllocationProfile);
+#endif
 
   // HermesInternal function that are only meant to be used for testing purpose.
   // They can change language semantics and are security risks.
@@ -7,6 +7,8 @@
 
 #include "hermes/VM/Operations.h"
 
+#include "JSLib/JSLibInternal.h"
+
 #include "hermes/Support/Conversions.h"
 #include "hermes/Support/OSCompat.h"
 #include "hermes/VM/BigIntPrimitive.h"
@@ -16,6 +18,7 @@
 #include "hermes/VM/JSArray.h"
 #include "hermes/VM/JSCallableProxy.h"
 #include "hermes/VM/JSError.h"
+#include "hermes/VM/JSMapImpl.h"
 #include "hermes/VM/JSObject.h"
 #include "hermes/VM/JSRegExp.h"
 #include "hermes/VM/PrimitiveBox.h"
@@ -1543,6 +1546,33 @@ CallResult<Handle<JSObject>> iteratorStep(
   return result;
 }
 
+llvh::Optional<CallResult<HermesValue>> builtinIteratorStepValue(
+    Runtime &runtime,
+    const IteratorRecord &iteratorRecord) {
+  auto *next = dyn_vmcast<NativeFunction>(*iteratorRecord.nextMethod);
+  if (!next) {
+    return llvh::None;
+  }
+  // The builtin next() methods throw if they are called on the wrong kind of
+  // iterator. Leave that to the generic path.
+  NativeFunctionPtr nextPtr = next->getFunctionPtr();
+  Handle<JSObject> iterator = iteratorRecord.iterator;
+  if (nextPtr == arrayIteratorPrototypeNext) {
+    if (auto it = Handle<JSArrayIterator>::dyn_vmcast(iterator))
+      return JSArrayIterator::nextValue(it, runtime);
+  } else if (nextPtr == mapIteratorPrototypeNext) {
+    if (auto it = Handle<JSMapIterator>::dyn_vmcast(iterator))
+      return JSMapIterator::nextValue(it, runtime);
+  } else if (nextPtr == setIteratorPrototypeNext) {
+    if (auto it = Handle<JSSetIterator>::dyn_vmcast(iterator))
+      return JSSetIterator::nextValue(it, runtime);
+  } else if (nextPtr == stringIteratorPrototypeNext) {
+    if (auto it = Handle<JSStringIterator>::dyn_vmcast(iterator))
+      return JSStringIterator::nextValue(it, runtime);
+  }
+  return llvh::None;
+}
+
 ExecutionStatus iteratorClose(
     Runtime &runtime,
     Handle<JSObject> iterator,
@@ -1628,6 +1658,17 @@ CallResult<Handle<JSArray>> iterableToArray(
 
   GCScopeMarkerRAII marker{runtime};
   for (;; marker.flush()) {
+    if (auto valueRes = builtinIteratorStepValue(runtime, iteratorRecord)) {
+      if (LLVM_UNLIKELY(*valueRes == ExecutionStatus::EXCEPTION)) {
+        return ExecutionStatus::EXCEPTION;
+      }
+      if ((*valueRes)->isEmpty()) {
+        break;
+      }
+      JSArray::setElementAt(array, runtime, n, runtime.makeHandle(**valueRes));
+      n++;
+      continue;
+    }
     // IterableToList: 5.a. Set next to ? IteratorStep(iteratorRecord).
     CallResult<Handle<JSObject>> nextRes =
         iteratorStep(runtime, iteratorRecord);
@@ -1691,6 +1732,20 @@ createIterResultObject(Runtime &runtime, Handle<> value, bool done) {
   return objHandle;
 }
 
+CallResult<HermesValue> createIterResultFromNextValue(
+    Runtime &runtime,
+    CallResult<HermesValue> valueRes) {
+  if (LLVM_UNLIKELY(valueRes == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  if (valueRes->isEmpty()) {
+    return createIterResultObject(runtime, Runtime::getUndefinedValue(), true)
+        .getHermesValue();
+  }
+  return createIterResultObject(runtime, runtime.makeHandle(*valueRes), false)
+      .getHermesValue();
+}
+
 CallResult<Handle<Callable>> speciesConstructor(
     Handle<JSObject> O,
     Runtime &runtime,
@@ -3037,6 +3092,20 @@ extern "C" SHLegacyValue _sh_ljs_iterator_next_rjs(
         Handle<JSObject>::vmcast(iteratorOrIdxHandle),
         Handle<Callable>::vmcast(srcOrNextHandle)};
 
+    // Step the builtin iterators of Maps, Sets, Strings and array-likes
+    // without allocating a result object per step.
+    if (auto valueRes = builtinIteratorStepValue(runtime, iterRecord)) {
+      if (LLVM_UNLIKELY(*valueRes == ExecutionStatus::EXCEPTION))
+        return ExecutionStatus::EXCEPTION;
+      if ((*valueRes)->isEmpty()) {
+        // Done with iteration. Clear the iterator so that subsequent
+        // instructions do not call next() or return().
+        *iteratorOrIdx = HermesValue::encodeUndefinedValue();
+        return HermesValue::encodeUndefinedValue();
+      }
+      return **valueRes;
+    }
+
     CallResult<PseudoHandle<JSObject>> resultObjRes =
         iteratorNext(runtime, iterRecord, llvh::None);
     if (LLVM_UNLIKELY(resultObjRes == ExecutionStatus::EXCEPTION))
@@ -204,16 +204,23 @@ PseudoHandle<JSStringIterator> JSStringIterator::create(
   return JSObjectInit::initToPseudoHandle(runtime, obj);
 }
 
-/// ES6.0 21.1.5.2.1 %StringIteratorPrototype%.next ( ) 4-14
 CallResult<HermesValue> JSStringIterator::nextElement(
     Handle<JSStringIterator> self,
     Runtime &runtime) {
+  return createIterResultFromNextValue(runtime, nextValue(self, runtime));
+}
+
+/// ES6.0 21.1.5.2.1 %StringIteratorPrototype%.next ( ) 4-14
+/// The steps that create an iterator result object return the empty value when
+/// they are done, and the value otherwise.
+CallResult<HermesValue> JSStringIterator::nextValue(
+    Handle<JSStringIterator> self,
+    Runtime &runtime) {
   // 4. Let s be the value of the [[IteratedString]] internal slot of O.
   auto s = runtime.makeHandle(self->iteratedString_);
   if (!s) {
     // 5. If s is undefined, return CreateIterResultObject(undefined, true).
-    return createIterResultObject(runtime, Runtime::getUndefinedValue(), true)
-        .getHermesValue();
+    return HermesValue::encodeEmptyValue();
   }
 
   // 6. Let position be the value of the [[StringIteratorNextIndex]] internal
@@ -227,8 +234,7 @@ CallResult<HermesValue> JSStringIterator::nextElement(
     // undefined.
     self->iteratedString_.setNull(runtime.getHeap());
     // 8b. Return CreateIterResultObject(undefined, true).
-    return createIterResultObject(runtime, Runtime::getUndefinedValue(), true)
-        .getHermesValue();
+    return HermesValue::encodeEmptyValue();
   }
 
   MutableHandle<StringPrimitive> resultString{runtime};
@@ -263,7 +269,7 @@ CallResult<HermesValue> JSStringIterator::nextElement(
   self->nextIndex_ = position + resultString->getStringLength();
 
   // 14. Return CreateIterResultObject(resultString, false).
-  return createIterResultObject(runtime, resultString, false).getHermesValue();
+  return resultString.getHermesValue();
 }
 
 //===----------------------------------------------------------------------===//
@@ -11,6 +11,7 @@
 
 #include "hermes/VM/JSNativeFunctions.h"
 
+#include <algorithm>
 #include <unordered_map>
 
 namespace hermes {
@@ -256,6 +257,12 @@ void ChromeTraceSerializer::serializeStackFrames(JSONEmitter &json) const {
         break;
       }
 
+      case SamplingProfiler::StackFrame::FrameKind::SHFunction: {
+        frameName = samplingProfiler.getSHFunctionName(frame);
+        categoryName = "JavaScript";
+        break;
+      }
+
       default:
         llvm_unreachable("Unknown frame kind");
     }
@@ -456,6 +463,12 @@ void ProfilerProfileSerializer::processNode(
       break;
     }
 
+    case SamplingProfiler::StackFrame::FrameKind::SHFunction: {
+      name = samplingProfiler_.getSHFunctionName(frame);
+      url = "[compiled]";
+      break;
+    }
+
     default:
       llvm_unreachable("Unknown frame kind");
   }
@@ -558,6 +571,87 @@ void serializeAsProfilerProfile(
   ProfilerProfileSerializer s(sp, json, std::move(chromeTrace));
   s.serialize();
 }
+
+/// \return the name of \p frame in the folded stack format. Frames are
+/// separated by ';' so it cannot appear in the name.
+static std::string getFoldedFrameName(
+    const SamplingProfiler &sp,
+    const SamplingProfiler::StackFrame &frame) {
+  std::string name;
+  switch (frame.kind) {
+    case SamplingProfiler::StackFrame::FrameKind::JSFunction: {
+      hbc::BCProvider *bcProvider = frame.jsFrame.module->getBytecode();
+      llvh::raw_string_ostream os(name);
+      os << getJSFunctionName(bcProvider, frame.jsFrame.functionId);
+      OptValue<hbc::DebugSourceLocation> sourceLocOpt = getSourceLocation(
+          bcProvider, frame.jsFrame.functionId, frame.jsFrame.offset);
+      if (sourceLocOpt.hasValue()) {
+        os << "("
+           << bcProvider->getDebugInfo()->getUTF8FilenameByID(
+                  sourceLocOpt->filenameId)
+           << ":" << sourceLocOpt->line << ":" << sourceLocOpt->column << ")";
+      } else {
+        os << "(" << frame.jsFrame.functionId << ":" << frame.jsFrame.offset
+           << ")";
+      }
+      os.flush();
+      break;
+    }
+    case SamplingProfiler::StackFrame::FrameKind::NativeFunction:
+      name = "[Native] " + sp.getNativeFunctionName(frame);
+      break;
+    case SamplingProfiler::StackFrame::FrameKind::FinalizableNativeFunction:
+      name = "[HostFunction] " + sp.getNativeFunctionName(frame);
+      break;
+    case SamplingProfiler::StackFrame::FrameKind::SuspendFrame:
+      assert(frame.suspendFrame && "suspendFrame should never be nullptr");
+      name = "[" + *frame.suspendFrame + "]";
+      break;
+    case SamplingProfiler::StackFrame::FrameKind::SHFunction:
+      name = sp.getSHFunctionName(frame);
+      break;
+  }
+  if (name.empty())
+    name = "(anonymous)";
+  std::replace(name.begin(), name.end(), ';', ',');
+  return name;
+}
+
+void serializeAsFoldedStacks(
+    const SamplingProfiler &sp,
+    llvh::raw_ostream &os,
+    llvh::ArrayRef<SamplingProfiler::AggregatedNode> nodes) {
+  constexpr uint32_t kFirstFrameNode = SamplingProfiler::kTruncatedNode + 1;
+  // Name every node once, skipping the root and the truncated node.
+  std::vector<std::string> names(nodes.size());
+  for (size_t i = kFirstFrameNode, e = nodes.size(); i < e; ++i)
+    names[i] = getFoldedFrameName(sp, nodes[i].frame);
+
+  llvh::SmallVector<uint32_t, 32> path;
+  for (size_t i = kFirstFrameNode, e = nodes.size(); i < e; ++i) {
+    if (!nodes[i].selfCount)
+      continue;
+    path.clear();
+    for (uint32_t n = i; n != 0; n = nodes[n].parent)
+      path.push_back(n);
+    for (auto it = path.rbegin(), end = path.rend(); it != end; ++it) {
+      if (it != path.rbegin())
+        os << ';';
+      os << names[*it];
+    }
+    os << ' ' << nodes[i].selfCount << '\n';
+  }
+  if (nodes.size() < kFirstFrameNode)
+    return;
+  // Samples that did not fit in the tree have their own node.
+  if (nodes[SamplingProfiler::kTruncatedNode].selfCount) {
+    os << "[truncated] " << nodes[SamplingProfiler::kTruncatedNode].selfCount
+       << '\n';
+  }
+  // Samples taken while no JS was running are attributed to the root.
+  if (nodes[0].selfCount)
+    os << "[idle] " << nodes[0].selfCount << '\n';
+}
 } // namespace vm
 } // namespace hermes
 
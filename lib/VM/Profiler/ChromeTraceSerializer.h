@@ -240,6 +240,14 @@ void serializeAsProfilerProfile(
     llvh::raw_ostream &os,
     ChromeTraceFormat &&chromeTrace);
 
+/// Serialize the aggregated call tree \p nodes to \p os in the folded stack
+/// format: one line per node with samples, containing the ';'-separated frame
+/// names from the root to the node followed by a space and the sample count.
+void serializeAsFoldedStacks(
+    const SamplingProfiler &sp,
+    llvh::raw_ostream &os,
+    llvh::ArrayRef<SamplingProfiler::AggregatedNode> nodes);
+
 } // namespace vm
 } // namespace hermes
 
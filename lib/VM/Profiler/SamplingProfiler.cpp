@@ -14,6 +14,7 @@
 #include "hermes/VM/Runtime.h"
 #include "hermes/VM/RuntimeModule-inline.h"
 #include "hermes/VM/StackFrame-inline.h"
+#include "hermes/VM/static_h.h"
 
 #include "llvh/Support/Compiler.h"
 
@@ -107,6 +108,12 @@ uint32_t SamplingProfiler::walkRuntimeStack(
         frameStorage.nativeFunctionPtrForLoom =
             nativeFunction->getFunctionPtr();
       }
+    } else if (
+        auto *shFunction =
+            dyn_vmcast<NativeJSFunction>(frame.getCalleeClosureUnsafe());
+        shFunction && shFunction->getFunctionInfo()) {
+      frameStorage.kind = StackFrame::FrameKind::SHFunction;
+      frameStorage.shFunction = shFunction->getFunctionInfo();
     } else {
       // TODO: handle BoundFunction.
       capturedFrame = false;
@@ -170,6 +177,10 @@ void SamplingProfiler::dumpSampledStack(llvh::raw_ostream &OS) {
           OS << "[HostFunction] " << getNativeFunctionName(frame);
           break;
 
+        case StackFrame::FrameKind::SHFunction:
+          OS << "[SH] " << getSHFunctionName(frame);
+          break;
+
         default:
           llvm_unreachable("Unknown frame kind");
       }
@@ -207,6 +218,87 @@ void SamplingProfiler::serializeInDevToolsFormat(llvh::raw_ostream &OS) {
   clear();
 }
 
+std::string SamplingProfiler::getSHFunctionName(
+    const StackFrame &stackFrame) const {
+  assert(
+      stackFrame.kind == StackFrame::FrameKind::SHFunction &&
+      "unexpected stack frame kind");
+  const SHNativeFuncInfo *info = stackFrame.shFunction;
+  return runtime_.getIdentifierTable().convertSymbolToUTF8(
+      SymbolID::unsafeCreate(info->unit->symbols[info->name_index]));
+}
+
+void SamplingProfiler::setAggregation(uint32_t maxNodes) {
+  std::lock_guard<std::mutex> lk(runtimeDataLock_);
+  clear();
+  maxAggregatedNodes_ = maxNodes;
+}
+
+void SamplingProfiler::dumpAggregatedProfile(llvh::raw_ostream &OS) {
+  std::lock_guard<std::mutex> lk(runtimeDataLock_);
+  serializeAsFoldedStacks(*this, OS, aggregatedNodes_);
+  clear();
+}
+
+void SamplingProfiler::resetAggregatedTree() {
+  aggregatedNodes_.clear();
+  aggregatedChildren_.clear();
+  // The root node, and the node for samples that don't fit.
+  aggregatedNodes_.push_back(AggregatedNode{StackFrame{}, 0, 0});
+  aggregatedNodes_.push_back(AggregatedNode{StackFrame{}, 0, 0});
+}
+
+/// \return the words that identify \p frame among frames of the same kind.
+static std::pair<uintptr_t, uint64_t> aggregatedFrameKey(
+    const SamplingProfiler::StackFrame &frame) {
+  switch (frame.kind) {
+    case SamplingProfiler::StackFrame::FrameKind::JSFunction:
+      return {
+          reinterpret_cast<uintptr_t>(frame.jsFrame.module),
+          ((uint64_t)frame.jsFrame.functionId << 32) | frame.jsFrame.offset};
+    case SamplingProfiler::StackFrame::FrameKind::NativeFunction:
+    case SamplingProfiler::StackFrame::FrameKind::FinalizableNativeFunction:
+      return {frame.nativeFrame, 0};
+    case SamplingProfiler::StackFrame::FrameKind::SuspendFrame:
+      return {reinterpret_cast<uintptr_t>(frame.suspendFrame), 0};
+    case SamplingProfiler::StackFrame::FrameKind::SHFunction:
+      return {reinterpret_cast<uintptr_t>(frame.shFunction), 0};
+  }
+  llvm_unreachable("Unknown frame kind");
+}
+
+void SamplingProfiler::aggregateSample(
+    const StackTrace &sample,
+    uint32_t depth) {
+  if (aggregatedNodes_.empty())
+    resetAggregatedTree();
+
+  uint32_t node = 0;
+  // Leaf frame is in sample[0] so walk it backward to go from the root to the
+  // leaf.
+  for (uint32_t i = depth; i-- > 0;) {
+    const StackFrame &frame = sample.stack[i];
+    AggregatedKey key{
+        {node, static_cast<uint32_t>(frame.kind)}, aggregatedFrameKey(frame)};
+    auto it = aggregatedChildren_.find(key);
+    if (it != aggregatedChildren_.end()) {
+      node = it->second;
+      continue;
+    }
+    // When the tree is full, count the sample as truncated rather than
+    // charging its time to a caller.
+    if (aggregatedNodes_.size() >= maxAggregatedNodes_) {
+      node = kTruncatedNode;
+      break;
+    }
+    uint32_t child = aggregatedNodes_.size();
+    aggregatedNodes_.push_back(AggregatedNode{frame, node, 0});
+    aggregatedChildren_[key] = child;
+    node = child;
+  }
+  ++aggregatedNodes_[node].selfCount;
+}
+
 bool SamplingProfiler::enable() {
   return sampling_profiler::Sampler::get()->enable();
 }
@@ -215,8 +307,16 @@ bool SamplingProfiler::disable() {
   return sampling_profiler::Sampler::get()->disable();
 }
 
+void SamplingProfiler::setSampleInterval(uint32_t millis) {
+  sampling_profiler::Sampler::get()->setSampleInterval(millis);
+}
+
 void SamplingProfiler::clear() {
   sampledStacks_.clear();
+  // Aggregated nodes refer to native functions by index, so they must be
+  // released together.
+  aggregatedNodes_.clear();
+  aggregatedChildren_.clear();
   // Release all strong roots.
   domains_.clear();
   nativeFunctions_.clear();
@@ -283,6 +383,9 @@ bool operator==(
     case SamplingProfiler::StackFrame::FrameKind::SuspendFrame:
       return left.suspendFrame == right.suspendFrame;
 
+    case SamplingProfiler::StackFrame::FrameKind::SHFunction:
+      return left.shFunction == right.shFunction;
+
     default:
       llvm_unreachable("Unknown frame kind");
   }
@@ -374,6 +374,10 @@ void SamplingProfilerPosix::collectStackForLoomCommon(
       break;
 #endif
 
+    case StackFrame::FrameKind::SHFunction:
+      frames[(index)] = ((uint64_t)frame.shFunction | kNativeFrameMask);
+      break;
+
     default:
       llvm_unreachable("Loom: unknown frame kind");
   }
@@ -447,6 +451,9 @@ void SamplingProfilerPosix::pushLastSampledStackToLoom() {
   constexpr uint16_t maxDepth = 512;
   int64_t frames[maxDepth];
   uint16_t depth = 0;
+  // Samples are not stored individually when they are aggregated.
+  if (sampledStacks_.empty())
+    return;
   // Each element in sampledStacks_ is one call stack, access the last one
   // to get the latest stack trace.
   auto sample = sampledStacks_.back();
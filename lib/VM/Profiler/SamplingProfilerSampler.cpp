@@ -106,6 +106,10 @@ bool Sampler::sampleStack(SamplingProfiler *localProfiler) {
   assert(
       sampledStackDepth_ <= sampleStorage_.stack.size() &&
       "How can we sample more frames than storage?");
+  if (localProfiler->maxAggregatedNodes_) {
+    localProfiler->aggregateSample(sampleStorage_, sampledStackDepth_);
+    return true;
+  }
   localProfiler->sampledStacks_.emplace_back(
       sampleStorage_.tid,
       sampleStorage_.timeStamp,
@@ -134,15 +138,8 @@ void Sampler::walkRuntimeStack(SamplingProfiler *profiler) {
 void Sampler::timerLoop() {
   oscompat::set_thread_name("hermes-sampling-profiler");
 
-  constexpr double kMeanMilliseconds = 10;
-  constexpr double kStdDevMilliseconds = 5;
   std::random_device rd{};
   std::mt19937 gen{rd()};
-  // The amount of time that is spent sleeping comes from a normal distribution,
-  // to avoid the case where the timer thread samples a stack at a predictable
-  // period.
-  std::normal_distribution<> distribution{
-      kMeanMilliseconds, kStdDevMilliseconds};
   std::unique_lock<std::mutex> uniqueLock(profilerLock_);
 
   while (enabled_) {
@@ -150,8 +147,12 @@ void Sampler::timerLoop() {
       return;
     }
 
+    // The amount of time that is spent sleeping comes from a normal
+    // distribution, to avoid the case where the timer thread samples a stack
+    // at a predictable period. The mean may change between samples.
+    std::normal_distribution<> distribution{
+        (double)meanIntervalMs_, meanIntervalMs_ / 2.0};
     const uint64_t millis = round(std::fabs(distribution(gen)));
-    // TODO: make sampling rate configurable.
     enabledCondVar_.wait_for(
         uniqueLock, std::chrono::milliseconds(millis), [this]() {
           return !enabled_;
@@ -164,6 +165,12 @@ bool Sampler::enabled() {
   return enabled_;
 }
 
+void Sampler::setSampleInterval(uint32_t millis) {
+  constexpr uint32_t kDefaultIntervalMs = 10;
+  std::lock_guard<std::mutex> lockGuard(profilerLock_);
+  meanIntervalMs_ = millis ? millis : kDefaultIntervalMs;
+}
+
 bool Sampler::enable() {
   std::lock_guard<std::mutex> lockGuard(profilerLock_);
   if (enabled_) {
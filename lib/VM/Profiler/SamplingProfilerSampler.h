@@ -71,6 +71,10 @@ struct Sampler {
   /// Whether profiler is enabled or not. Protected by profilerLock_.
   bool enabled_{false};
 
+  /// Mean interval between samples in milliseconds. Protected by
+  /// profilerLock_.
+  uint32_t meanIntervalMs_{10};
+
   /// Threading: load/store of sampledStackDepth_ and sampleStorage_
   /// are protected by samplingDoneSem_.
   /// Actual sampled stack depth in sampleStorage_.
@@ -104,6 +108,9 @@ struct Sampler {
   /// \return true if the sampling profiler is enabled, false otherwise.
   bool enabled();
 
+  /// Set meanIntervalMs_ to \p millis, or to the default if it is 0.
+  void setSampleInterval(uint32_t millis);
+
   /// Register the \p profiler associated with an active runtime.
   /// Should only be called from the thread running the hermes runtime
   /// associated with \p profiler.
@@ -46,6 +46,7 @@
 #include "llvh/ADT/Hashing.h"
 #include "llvh/ADT/ScopeExit.h"
 #include "llvh/Support/Debug.h"
+#include "llvh/Support/FileSystem.h"
 #include "llvh/Support/raw_ostream.h"
 
 #ifdef HERMESVM_PROFILER_BB
@@ -404,10 +405,22 @@ Runtime::Runtime(
   initJSBuiltins(builtins_, jsBuiltinsObj);
 
 #if HERMESVM_SAMPLING_PROFILER_AVAILABLE
-  if (runtimeConfig.getEnableSampleProfiling())
+  if (runtimeConfig.getEnableSampleProfiling()) {
     samplingProfiler = SamplingProfiler::create(*this);
+    samplingProfiler->setAggregation(
+        runtimeConfig.getSampleProfilingMaxNodes());
+    SamplingProfiler::setSampleInterval(
+        runtimeConfig.getSampleProfilingIntervalMs());
+  }
 #endif // HERMESVM_SAMPLING_PROFILER_AVAILABLE
 
+#ifdef HERMES_MEMORY_INSTRUMENTATION
+  if (uint32_t interval = runtimeConfig.getAllocationProfileInterval()) {
+    allocationProfileFile_ = runtimeConfig.getAllocationProfileFile();
+    enableAllocationAttribution(interval);
+  }
+#endif
+
   LLVM_DEBUG(llvh::dbgs() << "Runtime initialized\n");
 }
 
@@ -416,6 +429,19 @@ Runtime::~Runtime() {
   samplingProfiler.reset();
 #endif // HERMESVM_SAMPLING_PROFILER_AVAILABLE
 
+#ifdef HERMES_MEMORY_INSTRUMENTATION
+  if (!allocationProfileFile_.empty()) {
+    std::error_code EC;
+    llvh::raw_fd_ostream OS(allocationProfileFile_, EC, llvh::sys::fs::F_Text);
+    if (EC) {
+      llvh::errs() << "Failed to write allocation profile to "
+                   << allocationProfileFile_ << ": " << EC.message() << "\n";
+    } else {
+      emitAllocationAttribution(OS);
+    }
+  }
+#endif
+
   getHeap().finalizeAll();
   // Now that all objects are finalized, there shouldn't be any native memory
   // keys left in the ID tracker for memory profiling. Assert that the only IDs
@@ -574,8 +600,10 @@ void Runtime::markRoots(
   {
     MarkRootsPhaseTimer timer(*this, RootAcceptor::Section::Jobs);
     acceptor.beginRootSection(RootAcceptor::Section::Jobs);
-    for (Callable *&f : jobQueue_)
-      acceptor.acceptPtr(f);
+    for (Job &job : jobQueue_) {
+      acceptor.acceptPtr(job.callable);
+      acceptor.accept(job.arg);
+    }
     acceptor.endRootSection();
   }
 
@@ -730,6 +758,14 @@ void Runtime::printRuntimeGCStats(JSONEmitter &json) const {
         std::string(markRootsPhaseNames[phaseNum]) + "Time",
         formatSecs(markRootsPhaseTimes_[phaseNum]).secs);
   }
+  uint64_t deferredIdentifiers = 0;
+  uint64_t materializedIdentifiers = 0;
+  for (const auto &rm : runtimeModuleList_) {
+    deferredIdentifiers += rm.getNumDeferredIdentifiers();
+    materializedIdentifiers += rm.getNumMaterializedIdentifiers();
+  }
+  json.emitKeyValue("deferredIdentifiers", deferredIdentifiers);
+  json.emitKeyValue("materializedIdentifiers", materializedIdentifiers);
   json.closeDict();
 }
 
@@ -1814,12 +1850,15 @@ ExecutionStatus Runtime::drainJobs() {
   while (!jobQueue_.empty()) {
     GCScopeMarkerRAII marker{gcScope};
 
-    job = jobQueue_.front();
+    job = jobQueue_.front().callable;
+    HermesValue arg = jobQueue_.front().arg;
     jobQueue_.pop_front();
 
-    // Jobs are guaranteed to behave as thunks.
-    auto callRes =
-        Callable::executeCall0(job, *this, Runtime::getUndefinedValue());
+    // Jobs are guaranteed to behave as thunks, or to take a single argument.
+    auto callRes = arg.isEmpty()
+        ? Callable::executeCall0(job, *this, Runtime::getUndefinedValue())
+        : Callable::executeCall1(
+              job, *this, Runtime::getUndefinedValue(), arg);
 
     // Early return to signal the caller. Note that the exceptional job has been
     // popped, so re-invocation would pick up from the next available job.
@@ -2247,6 +2286,41 @@ void Runtime::disableSamplingHeapProfiler(llvh::raw_ostream &os) {
   stackTracesTree_.reset();
 }
 
+void Runtime::enableAllocationAttribution(
+    size_t samplingInterval,
+    int64_t seed) {
+  // Attribution walks the runtime stack, so it doesn't need stackTracesTree_.
+  getHeap().getSamplingAllocationTracker().enableAttribution(
+      samplingInterval, seed);
+}
+
+void Runtime::emitAllocationAttribution(llvh::raw_ostream &os) {
+  getHeap().getSamplingAllocationTracker().emitAttribution(os);
+}
+
+const void *Runtime::getCurrentFunctionForProfiling(std::string *name) {
+  NoAllocScope noAlloc(*this);
+  // Skip native frames, so that allocations made by builtins are attributed
+  // to their JS caller.
+  for (ConstStackFramePtr frame : getStackFrames()) {
+    if (const CodeBlock *codeBlock = frame.getCalleeCodeBlock(*this)) {
+      if (name)
+        *name = codeBlock->getNameString(gcCallbacksWrapper_);
+      return codeBlock;
+    }
+    auto *shFunction =
+        dyn_vmcast<NativeJSFunction>(frame.getCalleeClosureUnsafe());
+    if (shFunction && shFunction->getFunctionInfo()) {
+      const SHNativeFuncInfo *info = shFunction->getFunctionInfo();
+      if (name)
+        *name = getIdentifierTable().convertSymbolToUTF8(
+            SymbolID::unsafeCreate(info->unit->symbols[info->name_index]));
+      return info;
+    }
+  }
+  return nullptr;
+}
+
 void Runtime::popCallStackImpl() {
   assert(stackTracesTree_ && "Runtime not configured to track alloc stacks");
   stackTracesTree_->popCallStack();
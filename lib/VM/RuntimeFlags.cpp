@@ -39,6 +39,8 @@ vm::RuntimeConfig buildRuntimeConfig(const RuntimeFlags &flags) {
       .withIntl(flags.Intl)
       .withMicrotaskQueue(flags.MicrotaskQueue)
       .withEnableSampleProfiling(flags.SampleProfiling)
+      .withAllocationProfileInterval(flags.AllocationProfileInterval)
+      .withAllocationProfileFile(flags.AllocationProfileFile)
       .withRandomizeMemoryLayout(flags.RandomizeMemoryLayout)
       .withTrackIO(flags.TrackBytecodeIO)
       .withEnableHermesInternal(flags.EnableHermesInternal)
@@ -9,6 +9,7 @@
 
 #include "hermes/BCGen/HBC/BytecodeProviderFromSrc.h"
 #include "hermes/Support/PerfSection.h"
+#include "hermes/Support/Statistic.h"
 #include "hermes/VM/CodeBlock.h"
 #include "hermes/VM/Domain.h"
 #include "hermes/VM/HiddenClass.h"
@@ -18,6 +19,15 @@
 #include "hermes/VM/StringPrimitive.h"
 #include "hermes/VM/WeakRoot-inline.h"
 
+#define DEBUG_TYPE "vm"
+
+STATISTIC(
+    NumDeferredIdentifiers,
+    "Number of identifiers whose registration was deferred to first use");
+STATISTIC(
+    NumMaterializedIdentifiers,
+    "Number of deferred identifiers registered on first use");
+
 namespace hermes {
 namespace vm {
 
@@ -254,10 +264,17 @@ void RuntimeModule::importStringIDMapMayAllocate() {
       hashes.size() <= strTableSize &&
       "Should not have more strings than identifiers");
 
+  // Registering an identifier of a persistent module never allocates in the
+  // GC heap, so it can be deferred until the identifier is first used. Large
+  // bundles only touch a fraction of their identifiers during startup.
+  bool deferIdentifiers = flags_.persistent;
+  identifierRuns_.clear();
+
   // Preallocate enough space to store all identifiers to prevent
   // unnecessary allocations. NOTE: If this module is not the first module,
   // then this is an underestimate.
-  runtime_.getIdentifierTable().reserve(hashes.size());
+  if (!deferIdentifiers)
+    runtime_.getIdentifierTable().reserve(hashes.size());
   {
     StringID strID = 0;
     uint32_t hashID = 0;
@@ -269,6 +286,12 @@ void RuntimeModule::importStringIDMapMayAllocate() {
           break;
 
         case StringKind::Identifier:
+          if (deferIdentifiers) {
+            identifierRuns_.push_back({strID, entry.count(), hashID});
+            strID += entry.count();
+            hashID += entry.count();
+            break;
+          }
           for (uint32_t i = 0; i < entry.count(); ++i, ++strID, ++hashID) {
             createSymbolFromStringIDMayAllocate(
                 strID, bcProvider_->getStringTableEntry(strID), hashes[hashID]);
@@ -280,6 +303,12 @@ void RuntimeModule::importStringIDMapMayAllocate() {
     assert(strID == strTableSize && "Should map every string in the bytecode.");
     assert(hashID == hashes.size() && "Should hash all identifiers.");
   }
+  if (deferIdentifiers) {
+    NumDeferredIdentifiers += hashes.size();
+    numDeferredIdentifiers_ += hashes.size();
+  }
+  perf.addArg("identifiers", hashes.size());
+  perf.addArg("deferred", (size_t)deferIdentifiers);
 
   if (runtime_.getVMExperimentFlags() & experiments::MAdviseStringsRandom) {
     bcProvider_->adviseStringTableRandom();
@@ -301,6 +330,34 @@ void RuntimeModule::importStringIDMapMayAllocate() {
   }
 }
 
+OptValue<uint32_t> RuntimeModule::getIdentifierHash(StringID stringID) const {
+  // Find the last run that starts at or before stringID.
+  auto it = std::upper_bound(
+      identifierRuns_.begin(),
+      identifierRuns_.end(),
+      stringID,
+      [](StringID id, const IdentifierRun &run) {
+        return id < run.firstStringID;
+      });
+  if (it == identifierRuns_.begin())
+    return llvh::None;
+  --it;
+  if (stringID - it->firstStringID >= it->count)
+    return llvh::None;
+  return bcProvider_
+      ->getIdentifierHashes()[it->firstHash + (stringID - it->firstStringID)];
+}
+
+SymbolID RuntimeModule::materializeIdentifier(StringID stringID) {
+  assert(flags_.persistent && "Only persistent modules defer identifiers");
+  OptValue<uint32_t> hash = getIdentifierHash(stringID);
+  assert(hash && "String ID is not a deferred identifier");
+  ++NumMaterializedIdentifiers;
+  ++numMaterializedIdentifiers_;
+  return createSymbolFromStringIDMayAllocate(
+      stringID, bcProvider_->getStringTableEntry(stringID), hash);
+}
+
 void RuntimeModule::initializeFunctionMap() {
   assert(bcProvider_ && "Uninitialized RuntimeModule");
   assert(
@@ -442,6 +499,7 @@ void RuntimeModule::tryCacheLiteralHiddenClass(
 
 size_t RuntimeModule::additionalMemorySize() const {
   return stringIDMap_.capacity() * sizeof(SymbolID) +
+      identifierRuns_.capacity() * sizeof(IdentifierRun) +
       objectLiteralHiddenClasses_.getMemorySize() +
       templateMap_.getMemorySize();
 }
@@ -507,3 +565,5 @@ StringID mapStringMayAllocate(RuntimeModule &module, const char *str) {
 } // namespace vm
 
 } // namespace hermes
+
+#undef DEBUG_TYPE
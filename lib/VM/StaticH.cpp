@@ -269,6 +269,87 @@ extern "C" void _sh_ljs_reify_arguments_strict(
   reifyArguments(shr, frame, lazyReg, true);
 }
 
+static SHLegacyValue applyArguments(
+    SHRuntime *shr,
+    SHLegacyValue *frame,
+    SHLegacyValue *callee,
+    SHLegacyValue *target,
+    SHLegacyValue *thisArg,
+    SHLegacyValue *lazyReg,
+    bool strictMode) {
+  Runtime &runtime = getRuntime(shr);
+  StackFramePtr framePtr(toPHV(frame));
+  auto *native = dyn_vmcast<NativeFunction>(*toPHV(callee));
+  CallResult<PseudoHandle<>> res{ExecutionStatus::EXCEPTION};
+
+  // If the arguments object hasn't been created yet and the callee is
+  // Function.prototype.apply, copy the arguments of this frame directly.
+  if (toPHV(lazyReg)->isUndefined() && native &&
+      native->getFunctionPtr() == functionPrototypeApply &&
+      vmisa<Callable>(*toPHV(target))) {
+    uint32_t argCount = framePtr.getArgCount();
+    {
+      GCScopeMarkerRAII marker{runtime};
+      ScopedNativeCallFrame newFrame{
+          runtime,
+          argCount,
+          *toPHV(target),
+          HermesValue::encodeUndefinedValue(),
+          *toPHV(thisArg)};
+      if (LLVM_UNLIKELY(newFrame.overflowed())) {
+        res = runtime.raiseStackOverflow(
+            Runtime::StackOverflowKind::NativeStack);
+      } else {
+        for (uint32_t i = 0; i < argCount; ++i)
+          newFrame->getArgRef(i) = framePtr.getArgRef(i);
+        res = Callable::call(Handle<Callable>::vmcast(toPHV(target)), runtime);
+      }
+    }
+    if (LLVM_UNLIKELY(res == ExecutionStatus::EXCEPTION))
+      _sh_throw_current(shr);
+    return res->getHermesValue();
+  }
+
+  // Slow path: create the arguments object and perform the call as written.
+  reifyArguments(shr, frame, lazyReg, strictMode);
+  {
+    GCScopeMarkerRAII marker{runtime};
+    if (auto func = Handle<Callable>::dyn_vmcast(Handle<>(toPHV(callee)))) {
+      res = Callable::executeCall2(
+          func,
+          runtime,
+          Handle<>(toPHV(target)),
+          *toPHV(thisArg),
+          *toPHV(lazyReg));
+    } else {
+      res = runtime.raiseTypeErrorForValue(
+          Handle<>(toPHV(callee)), " is not a function");
+    }
+  }
+  if (LLVM_UNLIKELY(res == ExecutionStatus::EXCEPTION))
+    _sh_throw_current(shr);
+  return res->getHermesValue();
+}
+
+extern "C" SHLegacyValue _sh_ljs_apply_arguments_loose(
+    SHRuntime *shr,
+    SHLegacyValue *frame,
+    SHLegacyValue *callee,
+    SHLegacyValue *target,
+    SHLegacyValue *thisArg,
+    SHLegacyValue *lazyReg) {
+  return applyArguments(shr, frame, callee, target, thisArg, lazyReg, false);
+}
+extern "C" SHLegacyValue _sh_ljs_apply_arguments_strict(
+    SHRuntime *shr,
+    SHLegacyValue *frame,
+    SHLegacyValue *callee,
+    SHLegacyValue *target,
+    SHLegacyValue *thisArg,
+    SHLegacyValue *lazyReg) {
+  return applyArguments(shr, frame, callee, target, thisArg, lazyReg, true);
+}
+
 extern "C" SHLegacyValue _sh_ljs_get_by_val_rjs(
     SHRuntime *shr,
     SHLegacyValue *source,
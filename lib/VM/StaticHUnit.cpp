@@ -5,12 +5,16 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include "hermes/Support/JSONEmitter.h"
+#include "hermes/Support/OSCompat.h"
 #include "hermes/VM/Callable.h"
 #include "hermes/VM/JSArray.h"
 #include "hermes/VM/JSObject.h"
 #include "hermes/VM/Operations.h"
 #include "hermes/VM/StaticHUtils.h"
 
+#include "llvh/Support/FileSystem.h"
+
 #include <cstdarg>
 
 using namespace hermes;
@@ -20,6 +24,14 @@ using namespace hermes::vm;
 struct SHUnitExt {
   /// A map from template object ids to template objects.
   llvh::DenseMap<uint32_t, JSObject *> templateMap{};
+
+  /// The value of SHUnit::profile_seq when the global code of the unit
+  /// finished. Profile sites first executed up to this point ran at startup.
+  uint64_t profileStartupSeq = 0;
+  /// Page faults of the initializing thread incurred while running the global
+  /// code of the unit, or -1 if they could not be measured.
+  int64_t startupMinorFaults = -1;
+  int64_t startupMajorFaults = -1;
 };
 
 static void sh_unit_init_symbols(Runtime &runtime, SHUnit *unit);
@@ -111,7 +123,22 @@ extern "C" SHLegacyValue _sh_unit_init(SHRuntime *shr, SHUnit *unit) {
   runtime.shUnits.push_back(unit);
 
   sh_unit_init_symbols(runtime, unit);
-  return sh_unit_run(shr, unit);
+  if (!unit->num_profile_sites)
+    return sh_unit_run(shr, unit);
+
+  // When profiling, remember which sites ran during startup and how many page
+  // faults startup caused, so layout changes can be evaluated.
+  int64_t minorBefore, majorBefore, minorAfter, majorAfter;
+  bool haveFaults =
+      oscompat::thread_page_fault_count(&minorBefore, &majorBefore);
+  SHLegacyValue res = sh_unit_run(shr, unit);
+  unit->runtime_ext->profileStartupSeq = unit->profile_seq;
+  if (haveFaults &&
+      oscompat::thread_page_fault_count(&minorAfter, &majorAfter)) {
+    unit->runtime_ext->startupMinorFaults = minorAfter - minorBefore;
+    unit->runtime_ext->startupMajorFaults = majorAfter - majorBefore;
+  }
+  return res;
 }
 
 static SHLegacyValue sh_unit_run(SHRuntime *shr, SHUnit *unit) {
@@ -361,3 +388,92 @@ extern "C" void _sh_cache_template_object(
   unit->runtime_ext->templateMap[templateObjID] =
       vmcast<JSObject>(HermesValue::fromRaw(templateObj.raw));
 }
+
+/// Version of the JSON execution profile written by _sh_write_profile().
+static constexpr uint32_t kExecutionProfileVersion = 1;
+
+/// Emit the profile site \p idx of \p unit as a JSON dictionary to \p json.
+static void sh_unit_emit_profile_site(
+    Runtime &runtime,
+    const SHUnit *unit,
+    uint32_t idx,
+    JSONEmitter &json) {
+  const SHProfileSite &site = unit->profile_sites[idx];
+  const SHSrcLoc &loc = unit->source_locations[site.src_location_idx];
+  IdentifierTable &idTable = runtime.getIdentifierTable();
+  json.openDict();
+  json.emitKeyValue(
+      "name",
+      idTable.convertSymbolToUTF8(
+          SymbolID::unsafeCreate(unit->symbols[site.name_index])));
+  json.emitKeyValue(
+      "file",
+      idTable.convertSymbolToUTF8(
+          SymbolID::unsafeCreate(unit->symbols[loc.filename_idx])));
+  json.emitKeyValue("line", loc.line);
+  json.emitKeyValue("column", loc.column);
+  json.emitKeyValue("count", (unsigned long long)unit->profile_counts[idx]);
+  json.emitKeyValue("order", (unsigned long long)unit->profile_order[idx]);
+  json.emitKeyValue(
+      "startup",
+      unit->profile_order[idx] != 0 &&
+          unit->profile_order[idx] <= unit->runtime_ext->profileStartupSeq);
+  json.closeDict();
+}
+
+extern "C" bool _sh_write_profile(SHRuntime *shr, const char *path) {
+  Runtime &runtime = getRuntime(shr);
+
+  std::error_code EC;
+  llvh::raw_fd_ostream OS(path, EC, llvh::sys::fs::F_Text);
+  if (EC) {
+    llvh::errs() << "Error writing profile '" << path << "': " << EC.message()
+                 << "\n";
+    return false;
+  }
+
+  JSONEmitter json(OS, /* pretty */ true);
+  json.openDict();
+  json.emitKeyValue("version", kExecutionProfileVersion);
+
+  // Emit the sites of each kind in their own array, so the consumer does not
+  // need to know the encoding of SHProfileSiteKind.
+  auto emitSites = [&runtime, &json](SHProfileSiteKind kind) {
+    json.openArray();
+    for (const SHUnit *unit : runtime.shUnits) {
+      for (uint32_t i = 0; i < unit->num_profile_sites; ++i) {
+        if (unit->profile_sites[i].kind == kind)
+          sh_unit_emit_profile_site(runtime, unit, i, json);
+      }
+    }
+    json.closeArray();
+  };
+
+  // Report the page faults taken by the global code of the instrumented
+  // units, to compare the startup cost of different layouts.
+  int64_t minorFaults = 0, majorFaults = 0;
+  bool haveFaults = false;
+  for (const SHUnit *unit : runtime.shUnits) {
+    if (!unit->num_profile_sites || unit->runtime_ext->startupMinorFaults < 0)
+      continue;
+    haveFaults = true;
+    minorFaults += unit->runtime_ext->startupMinorFaults;
+    majorFaults += unit->runtime_ext->startupMajorFaults;
+  }
+  if (haveFaults) {
+    json.emitKey("startupPageFaults");
+    json.openDict();
+    json.emitKeyValue("minor", (long long)minorFaults);
+    json.emitKeyValue("major", (long long)majorFaults);
+    json.closeDict();
+  }
+
+  json.emitKey("functions");
+  emitSites(SHProfileSiteFunction);
+  json.emitKey("callsites");
+  emitSites(SHProfileSiteCall);
+
+  json.closeDict();
+  OS << "\n";
+  return true;
+}
@@ -467,6 +467,39 @@ ExternalStringPrimitive<T>::ExternalStringPrimitive(BasicString &&contents)
       "ExternalStringPrimitive length must be at least EXTERNAL_STRING_MIN_SIZE");
 }
 
+template <typename T>
+ExternalStringPrimitive<T>::ExternalStringPrimitive(
+    Ref hostData,
+    ReleaseCallback release,
+    void *context)
+    : SymbolStringPrimitive(hostData.size()),
+      hostData_(hostData.data()),
+      hostRelease_(release),
+      hostContext_(context) {
+  assert(
+      getStringLength() >= EXTERNAL_STRING_MIN_SIZE &&
+      "ExternalStringPrimitive length must be at least EXTERNAL_STRING_MIN_SIZE");
+}
+
+template <typename T>
+CallResult<HermesValue> ExternalStringPrimitive<T>::createFromHost(
+    Runtime &runtime,
+    Ref data,
+    ReleaseCallback release,
+    void *context) {
+  if (LLVM_UNLIKELY(data.size() > MAX_STRING_LENGTH))
+    return runtime.raiseRangeError("String length exceeds limit");
+  assert(isExternalLength(data.size()) && "length should be external");
+  // The host memory is not allocated by the VM, but crediting it lets the GC
+  // account for the memory it keeps alive.
+  auto *extStr =
+      runtime.makeAVariable<ExternalStringPrimitive<T>, HasFinalizer::Yes>(
+          sizeof(ExternalStringPrimitive<T>), data, release, context);
+  runtime.getHeap().creditExternalMemory(
+      extStr, extStr->calcExternalMemorySize());
+  return HermesValue::encodeStringValue(extStr);
+}
+
 // NOTE: this is a template method in a template class, thus the two separate
 // template<> lines.
 template <typename T>
@@ -533,8 +566,16 @@ void ExternalStringPrimitive<T>::_finalizeImpl(GCCell *cell, GC &gc) {
   ExternalStringPrimitive<T> *self = vmcast<ExternalStringPrimitive<T>>(cell);
   // Remove the external string from the snapshot tracking system if it's being
   // tracked.
-  gc.getIDTracker().untrackNative(self->contents_.data());
+  gc.getIDTracker().untrackNative(self->getRawPointer());
   gc.debitExternalMemory(self, self->calcExternalMemorySize());
+  if (self->hostData_) {
+    if (self->hostRelease_)
+      self->hostRelease_(self->hostContext_);
+    // The empty contents_ may point into its own small string buffer, which
+    // is stale once the GC has moved the cell, so it must not be destroyed.
+    // It owns no memory.
+    return;
+  }
   self->~ExternalStringPrimitive<T>();
 }
 
@@ -554,7 +595,7 @@ void ExternalStringPrimitive<T>::_snapshotAddEdgesImpl(
   snap.addNamedEdge(
       HeapSnapshot::EdgeType::Internal,
       "externalString",
-      gc.getNativeID(self->contents_.data()));
+      gc.getNativeID(self->getRawPointer()));
 }
 
 template <typename T>
@@ -567,8 +608,8 @@ void ExternalStringPrimitive<T>::_snapshotAddNodesImpl(
   snap.endNode(
       HeapSnapshot::NodeType::Native,
       "ExternalStringPrimitive",
-      gc.getNativeID(self->contents_.data()),
-      self->contents_.size(),
+      gc.getNativeID(self->getRawPointer()),
+      self->calcExternalMemorySize(),
       0);
 }
 #endif
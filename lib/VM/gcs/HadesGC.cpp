@@ -2490,6 +2490,9 @@ void HadesGC::youngGenCollection(
       if (doCompaction) {
         compactee_.segment->forCompactedObjs(trackerCallback, getPointerBase());
       }
+#ifdef HERMES_MEMORY_INSTRUMENTATION
+      getSamplingAllocationTracker().onYoungGenCollection();
+#endif
     }
     // Run finalizers for young gen objects.
     finalizeYoungGenObjects();
@@ -89,6 +89,23 @@ class PinnedHermesValue;
   /* Whether to enable automatic sampling profiler registration */     \
   F(constexpr, bool, EnableSampleProfiling, false)                     \
                                                                        \
+  /* Mean interval in milliseconds between sampling profiler */        \
+  /* samples, shared by all runtimes. */                               \
+  F(constexpr, uint32_t, SampleProfilingIntervalMs, 10)                \
+                                                                       \
+  /* If nonzero, the sampling profiler merges samples into a call */   \
+  /* tree of at most this many nodes instead of storing each one. */   \
+  F(constexpr, uint32_t, SampleProfilingMaxNodes, 0)                   \
+                                                                       \
+  /* If nonzero, attribute allocations to JS functions, sampling */    \
+  /* about once every this many bytes. Requires memory */              \
+  /* instrumentation. */                                               \
+  F(constexpr, uint32_t, AllocationProfileInterval, 0)                 \
+                                                                       \
+  /* File the allocation profile is written to when the runtime */     \
+  /* is destroyed. If empty, it is only available on request. */       \
+  F(HERMES_NON_CONSTEXPR, std::string, AllocationProfileFile, "")      \
+                                                                       \
   /* Whether to randomize stack placement etc. */                      \
   F(constexpr, bool, RandomizeMemoryLayout, false)                     \
                                                                        \
@@ -114,6 +131,10 @@ class PinnedHermesValue;
   /* Choose whether generators are enabled. */                         \
   F(constexpr, bool, EnableGenerator, true)                            \
                                                                        \
+  /* Maximum number of threads used to parse a large source */         \
+  /* buffer passed to evaluateJavaScript. */                           \
+  F(constexpr, unsigned, ParseJobs, 1)                                 \
+                                                                       \
   /* An interface for managing crashes. */                             \
   F(HERMES_NON_CONSTEXPR,                                              \
     std::shared_ptr<CrashManager>,                                     \
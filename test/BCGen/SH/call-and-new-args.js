@@ -29,13 +29,13 @@ function test_builtin(a) {
 // CHECK-NEXT:                 DeclareGlobalVarInst "test_call": string
 // CHECK-NEXT:                 DeclareGlobalVarInst "test_new": string
 // CHECK-NEXT:                 DeclareGlobalVarInst "test_builtin": string
-// CHECK-NEXT:  {loc2}    %4 = HBCCreateFunctionInst (:object) %test_call(): any, {loc0} %0: environment
-// CHECK-NEXT:  {loc1}    %5 = HBCGetGlobalObjectInst (:object)
-// CHECK-NEXT:                 StorePropertyLooseInst {loc2} %4: object, {loc1} %5: object, "test_call": string
-// CHECK-NEXT:  {loc2}    %7 = HBCCreateFunctionInst (:object) %test_new(): object, {loc0} %0: environment
-// CHECK-NEXT:                 StorePropertyLooseInst {loc2} %7: object, {loc1} %5: object, "test_new": string
+// CHECK-NEXT:  {loc1}    %4 = HBCCreateFunctionInst (:object) %test_call(): any, {loc0} %0: environment
+// CHECK-NEXT:  {loc2}    %5 = HBCGetGlobalObjectInst (:object)
+// CHECK-NEXT:                 StorePropertyLooseInst {loc1} %4: object, {loc2} %5: object, "test_call": string
+// CHECK-NEXT:  {loc1}    %7 = HBCCreateFunctionInst (:object) %test_new(): object, {loc0} %0: environment
+// CHECK-NEXT:                 StorePropertyLooseInst {loc1} %7: object, {loc2} %5: object, "test_new": string
 // CHECK-NEXT:  {loc0}    %9 = HBCCreateFunctionInst (:object) %test_builtin(): number, {loc0} %0: environment
-// CHECK-NEXT:                 StorePropertyLooseInst {loc0} %9: object, {loc1} %5: object, "test_builtin": string
+// CHECK-NEXT:                 StorePropertyLooseInst {loc0} %9: object, {loc2} %5: object, "test_builtin": string
 // CHECK-NEXT:  {np0}    %11 = HBCLoadConstInst (:undefined) undefined: undefined
 // CHECK-NEXT:                 ReturnInst {np0} %11: undefined
 // CHECK-NEXT:function_end
@@ -44,14 +44,14 @@ function test_builtin(a) {
 // CHECK-NEXT:frame = []
 // CHECK-NEXT:%BB0:
 // CHECK-NEXT:  {stack[5]}  %0 = LoadParamInst (:any) %bar: any
-// CHECK-NEXT:  {np4}     %1 = HBCLoadConstInst (:undefined) undefined: undefined
+// CHECK-NEXT:  {np0}     %1 = HBCLoadConstInst (:undefined) undefined: undefined
 // CHECK-NEXT:  {stack[3]}  %2 = HBCLoadConstInst (:number) 10: number
 // CHECK-NEXT:  {stack[2]}  %3 = HBCLoadConstInst (:number) 11: number
 // CHECK-NEXT:  {stack[1]}  %4 = HBCLoadConstInst (:number) 12: number
 // CHECK-NEXT:  {stack[0]}  %5 = HBCLoadConstInst (:number) 13: number
 // CHECK-NEXT:  {stack[6]}  %6 = HBCLoadConstInst (:undefined) undefined: undefined
 // CHECK-NEXT:  {stack[4]}  %7 = HBCLoadConstInst (:undefined) undefined: undefined
-// CHECK-NEXT:  {loc0}    %8 = CallInst (:any) {stack[5]} %0: any, empty: any, empty: any, {np4} %1: undefined, {stack[4]} %7: undefined, {stack[3]} %2: number, {stack[2]} %3: number, {stack[1]} %4: number, {stack[0]} %5: number
+// CHECK-NEXT:  {loc0}    %8 = CallInst (:any) {stack[5]} %0: any, empty: any, empty: any, {np0} %1: undefined, {stack[4]} %7: undefined, {stack[3]} %2: number, {stack[2]} %3: number, {stack[1]} %4: number, {stack[0]} %5: number
 // CHECK-NEXT:                 ReturnInst {loc0} %8: any
 // CHECK-NEXT:function_end
 
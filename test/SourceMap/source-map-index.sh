@@ -0,0 +1,22 @@
+# Copyright (c) Meta Platforms, Inc. and affiliates.
+#
+# This source code is licensed under the MIT license found in the
+# LICENSE file in the root directory of this source tree.
+
+# RUN: %source-map-index %S/translator/throw.min.js.map -out %t.hsmi
+# RUN: %source-map-index %t.hsmi -lookup 1:1 -lookup 1:10 -lookup 1:23 \
+# RUN:   -lookup 1:35 -lookup 1:41 -lookup 2:1 | %FileCheck --match-full-lines %s
+# RUN: (! %source-map-index %t.hsmi -out %t.again 2>&1) \
+# RUN:   | %FileCheck --check-prefix=CHKERR %s
+
+# Convert a JSON source map to an index, and symbolicate locations in
+# throw.min.js against it. Segments with a name print it after the location.
+
+# CHECK: 1:1: throw.js:8:1
+# CHECK-NEXT: 1:10: throw.js:8:10 entryPoint
+# CHECK-NEXT: 1:23: throw.js:9:3 helper
+# CHECK-NEXT: 1:35: throw.js:12:1
+# CHECK-NEXT: 1:41: throw.js:12:10 helper
+# CHECK-NEXT: 2:1: <unmapped>
+
+# CHKERR: '{{.*}}.hsmi' is already an index
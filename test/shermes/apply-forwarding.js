@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %shermes -exec %s | %FileCheck --match-full-lines %s
+
+// Check calls that forward their arguments with `fn.apply(this, arguments)`
+// or `fn(...args)`.
+
+function show() {
+  var s = '';
+  for (var i = 0; i < arguments.length; ++i)
+    s += ' ' + arguments[i];
+  print(this.name + ':' + arguments.length + s);
+  return arguments.length;
+}
+
+var obj = {name: 'obj'};
+
+function forward() {
+  return show.apply(this, arguments);
+}
+print(forward.call(obj, 1, 2, 3));
+// CHECK: obj:3 1 2 3
+// CHECK-NEXT: 3
+forward.call(obj);
+// CHECK-NEXT: obj:0
+
+function forwardModified() {
+  arguments[0] = 'changed';
+  return show.apply(this, arguments);
+}
+forwardModified.call(obj, 1, 2);
+// CHECK-NEXT: obj:2 changed 2
+
+function forwardStrict() {
+  'use strict';
+  return show.apply(this, arguments);
+}
+forwardStrict.call(obj, 'a');
+// CHECK-NEXT: obj:1 a
+
+function forwardTo(fn) {
+  return fn.apply(this, arguments);
+}
+try {
+  forwardTo.call(obj, {apply: Function.prototype.apply});
+} catch (e) {
+  print(e.constructor.name);
+}
+// CHECK-NEXT: TypeError
+
+var origApply = Function.prototype.apply;
+Function.prototype.apply = function (thisArg, args) {
+  print('patched', Object.prototype.toString.call(args), args.length);
+  return origApply.call(this, thisArg, args);
+};
+forward.call(obj, 4, 5);
+// CHECK-NEXT: patched [object Arguments] 2
+// CHECK-NEXT: obj:2 4 5
+Function.prototype.apply = origApply;
+
+function spread(...args) {
+  return show.call(obj, ...args);
+}
+spread(6, 7);
+// CHECK-NEXT: obj:2 6 7
+show.call(obj, ...new Set([8, 9]));
+// CHECK-NEXT: obj:2 8 9
+show.call(obj, ...'ab');
+// CHECK-NEXT: obj:2 a b
+
+Array.prototype[1] = 'proto';
+show.call(obj, ...[1, , 3]);
+// CHECK-NEXT: obj:3 1 proto 3
+delete Array.prototype[1];
+
+function Point(x, y) {
+  this.x = x;
+  this.y = y;
+}
+var p = new Point(...[10, 11]);
+print(p.x, p.y);
+// CHECK-NEXT: 10 11
+
+try {
+  show(...1);
+} catch (e) {
+  print(e.constructor.name);
+}
+// CHECK-NEXT: TypeError
+
+var notCallable = {};
+var iterable = {
+  [Symbol.iterator]: function () {
+    print('iterated');
+    return [][Symbol.iterator]();
+  },
+};
+try {
+  notCallable(...iterable);
+} catch (e) {
+  print(e.constructor.name);
+}
+// CHECK-NEXT: iterated
+// CHECK-NEXT: TypeError
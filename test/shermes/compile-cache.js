@@ -0,0 +1,57 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: rm -rf %t.cache && mkdir %t.cache
+// RUN: %shermes -cache-dir=%t.cache -exec %s | %FileCheck --match-full-lines %s
+// RUN: %shermes -v -cache-dir=%t.cache -exec %s 2>&1 | %FileCheck --check-prefix=HIT %s
+// RUN: %shermes -v -cache-dir=%t.cache -Og -exec %s 2>&1 | %FileCheck --check-prefix=MISS %s
+// RUN: %shermes -cache-dir=%t.cache -emit-c %s -o %t.c
+// RUN: ls %t.cache | %FileCheck --check-prefix=FILES %s
+
+// The objects of the split C files that did not change are reused. The source
+// path is kept, since it appears in the generated C.
+// RUN: rm -rf %t.dir && mkdir %t.dir && cp %s %t.dir/compile-cache.js
+// RUN: %shermes -cache-dir=%t.cache -split-c=2 -exec %t.dir/compile-cache.js | %FileCheck --match-full-lines %s
+// RUN: sed -e 's/CONSTANT = 10/CONSTANT = 20/' %s > %t.dir/compile-cache.js
+// RUN: %shermes -v -cache-dir=%t.cache -split-c=2 -exec %t.dir/compile-cache.js 2>&1 | %FileCheck --check-prefix=SPLIT %s
+
+// Least recently used entries are deleted when the cache is too large.
+// RUN: head -c 2000000 /dev/zero > %t.cache/stale
+// RUN: touch -t 200001010000 %t.cache/stale
+// RUN: %shermes -cache-dir=%t.cache -cache-max-size=1 -exec %s | %FileCheck --match-full-lines %s
+// RUN: ls %t.cache | %FileCheck --check-prefix=TRIMMED %s
+
+// Verify that the generated C is reused only when the options are unchanged.
+
+var CONSTANT = 10;
+
+function first(x) {
+  return x + 1;
+}
+
+function second(x) {
+  return x * 2;
+}
+
+print("cached", first(2), second(CONSTANT));
+// CHECK: cached 3 20
+
+// HIT: Using cached {{.*}}unit.c
+// HIT: cached 3 20
+
+// MISS-NOT: Using cached
+// MISS: cached 3 20
+
+// FILES: {{[0-9a-f]+}}
+// FILES-NEXT: {{[0-9a-f]+}}
+// FILES-NOT: {{.}}
+
+// SPLIT-NOT: Using cached {{.*}}unit.c
+// SPLIT: Using cached object {{.*}}.o
+// SPLIT: cached 3 40
+
+// TRIMMED-NOT: stale
@@ -0,0 +1,59 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: TZ="America/Los_Angeles" %shermes -exec %s | %FileCheck --match-full-lines %s
+
+// Check ISO-8601 formatting and parsing, and conversions to and from local
+// time around DST transitions, which use cached time zone adjustments.
+
+print(new Date(Date.UTC(2017, 2, 15, 15, 1, 37, 243)).toISOString());
+// CHECK: 2017-03-15T15:01:37.243Z
+print(new Date(Date.UTC(0, 0, 1) - 1).toISOString());
+// CHECK-NEXT: 1899-12-31T23:59:59.999Z
+print(new Date(-62167219200001).toISOString());
+// CHECK-NEXT: -000001-12-31T23:59:59.999Z
+print(new Date(8.64e15).toISOString());
+// CHECK-NEXT: +275760-09-13T00:00:00.000Z
+print(new Date(-8.64e15).toISOString());
+// CHECK-NEXT: -271821-04-20T00:00:00.000Z
+print(new Date(Date.UTC(10000, 0, 1)).toISOString());
+// CHECK-NEXT: +010000-01-01T00:00:00.000Z
+print(new Date(Date.UTC(2016, 1, 29, 23, 59, 59)).toUTCString());
+// CHECK-NEXT: Mon, 29 Feb 2016 23:59:59 GMT
+
+print(Date.parse('2017-03-15T15:01:37.243Z'));
+// CHECK-NEXT: 1489590097243
+print(Date.parse('+275760-09-13T00:00:00.000Z'));
+// CHECK-NEXT: 8640000000000000
+print(Date.parse('-000001-12-31T23:59:59.999Z'));
+// CHECK-NEXT: -62167219200001
+print(Date.parse('2017-03-15T08:01:37.243-07:00'));
+// CHECK-NEXT: 1489590097243
+print(Date.parse('2017-03-15'));
+// CHECK-NEXT: 1489536000000
+print(Date.parse('99999999999-01-01'));
+// CHECK-NEXT: NaN
+
+// 2017-03-12 02:00 and 2017-11-05 02:00 are DST transitions.
+print(new Date(2017, 2, 12, 1, 59).getTimezoneOffset());
+// CHECK-NEXT: 480
+print(new Date(2017, 2, 12, 3, 0).getTimezoneOffset());
+// CHECK-NEXT: 420
+print(new Date(2017, 10, 5, 0, 59).getTimezoneOffset());
+// CHECK-NEXT: 420
+print(new Date(2017, 10, 5, 2, 0).getTimezoneOffset());
+// CHECK-NEXT: 480
+print(Date.parse('2017-03-12T03:00:00'));
+// CHECK-NEXT: 1489312800000
+print(new Date(1489312800000).toString());
+// CHECK-NEXT: Sun Mar 12 2017 03:00:00 GMT-0700
+print(new Date(1489312799000).toString());
+// CHECK-NEXT: Sun Mar 12 2017 01:59:59 GMT-0800
+print(new Date(2100, 6, 1).getTimezoneOffset());
+// CHECK-NEXT: 420
+print(new Date(2100, 0, 1).getHours());
+// CHECK-NEXT: 0
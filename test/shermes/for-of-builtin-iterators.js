@@ -0,0 +1,60 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %shermes -exec %s | %FileCheck --match-full-lines %s
+
+// Check iteration over builtin iterators, which are stepped without calling
+// their next() method unless it has been replaced.
+
+var m = new Map([[1, 'a'], [2, 'b']]);
+for (var [k, v] of m) {
+  print('map', k, v);
+  if (k === 1) {
+    m.delete(2);
+    m.set(3, 'c');
+  }
+}
+// CHECK: map 1 a
+// CHECK-NEXT: map 3 c
+
+for (var x of new Set([4, 5]).values())
+  print('set', x);
+// CHECK-NEXT: set 4
+// CHECK-NEXT: set 5
+
+for (var c of 'a\u{1F600}b')
+  print('string', c.length);
+// CHECK-NEXT: string 1
+// CHECK-NEXT: string 2
+// CHECK-NEXT: string 1
+
+for (var e of new Int8Array([6, 7]).entries())
+  print('typed', e);
+// CHECK-NEXT: typed 0,6
+// CHECK-NEXT: typed 1,7
+
+print('spread', [...m.keys(), ...new Set([8])]);
+// CHECK-NEXT: spread 1,3,8
+
+print('from', Array.from(m.values()));
+// CHECK-NEXT: from a,c
+
+var mapIterProto = Object.getPrototypeOf(new Map().keys());
+var origNext = mapIterProto.next;
+mapIterProto.next = function () {
+  var res = origNext.call(this);
+  if (!res.done)
+    res.value = res.value + '!';
+  return res;
+};
+for (var s of m.values())
+  print('patched', s);
+// CHECK-NEXT: patched a!
+// CHECK-NEXT: patched c!
+print('patched spread', [...m.keys()]);
+// CHECK-NEXT: patched spread 1!,3!
+mapIterProto.next = origNext;
@@ -0,0 +1,29 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %shermes -emit-c %s -o - | %FileCheck --match-full-lines %s
+// RUN: %shermes -exec %s | %FileCheck --match-full-lines --check-prefix=EXEC %s
+
+// Verify that the label of every function names the file and line where it
+// starts, so that native tools such as perf can attribute its code.
+
+function add(a, b) {
+  return a + b;
+}
+
+var obj = {
+  'weird name!': function () {
+    return 2;
+  },
+};
+
+print(add(1, obj['weird name!']()));
+// EXEC: 3
+
+// CHECK: static SHLegacyValue _0_global(SHRuntime *shr);
+// CHECK-NEXT: static SHLegacyValue _1_add__function_labels_js_14(SHRuntime *shr);
+// CHECK-NEXT: static SHLegacyValue _2_weird_name___function_labels_js_19(SHRuntime *shr);
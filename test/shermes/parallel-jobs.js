@@ -0,0 +1,46 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %shermes -O -emit-c -j1 %s -o %t.1.c
+// RUN: %shermes -O -emit-c -j4 %s -o %t.4.c
+// RUN: diff %t.1.c %t.4.c
+// RUN: %shermes -O -j4 -exec %s | %FileCheck --match-full-lines %s
+
+// Verify that compiling functions in parallel produces the same output as
+// compiling them serially.
+
+function fib(n) {
+  var a = 0, b = 1;
+  for (var i = 0; i < n; ++i) {
+    var t = a + b;
+    a = b;
+    b = t;
+  }
+  return a;
+}
+
+function fact(n) {
+  return n <= 1 ? 1 : n * fact(n - 1);
+}
+
+function sum(arr) {
+  var s = 0;
+  for (var x of arr) s += x;
+  return s;
+}
+
+function join(arr, sep) {
+  var res = "";
+  for (var i = 0; i < arr.length; ++i) {
+    if (i) res += sep;
+    res += arr[i];
+  }
+  return res;
+}
+
+print(fib(10), fact(5), sum([1, 2, 3]), join(["a", "b", "c"], "-"));
+// CHECK: 55 120 6 a-b-c
@@ -0,0 +1,33 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %shermes -profile-generate=%t.json -exec %s | %FileCheck --match-full-lines %s
+// RUN: %shermes -profile-use=%t.json -dump-ir %s | %FileCheck --match-full-lines --check-prefix=IR %s
+
+// Verify that a profile collected by an instrumented executable causes the
+// hot call site of a function with multiple callers to be inlined, while the
+// cold one is left alone.
+
+function outer(n) {
+  'use strict';
+  function add1(x) {
+    return x + 1;
+  }
+  var sum = 0;
+  for (var i = 0; i < n; ++i) sum = add1(sum);
+  if (n < 0) sum = add1(sum);
+  return sum;
+}
+
+print(outer(1000));
+// CHECK: 1000
+
+// IR-LABEL: function outer(n: any): number
+// IR-NOT: function add1
+// IR: {{.*}}Call{{.*}} %add1(){{.*}}
+// IR-NOT: Call
+// IR-LABEL: function add1(x: number): number{{.*}}
@@ -0,0 +1,33 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %shermes -profile-generate=%t.json -exec %s | %FileCheck --match-full-lines %s
+// RUN: %FileCheck --check-prefix=PROFILE %s < %t.json
+// RUN: %shermes -profile-use=%t.json -emit-c %s -o - | %FileCheck --check-prefix=LAYOUT %s
+
+// Verify that functions which run during startup are recorded in the profile
+// and grouped together when the profile is used.
+
+function init() {
+  return "ready";
+}
+
+function neverCalled() {
+  return "unused";
+}
+
+print(init());
+// CHECK: ready
+
+// PROFILE: "startupPageFaults": {
+// PROFILE: "name": "init",
+// PROFILE: "startup": true
+// PROFILE: "name": "neverCalled",
+// PROFILE: "startup": false
+
+// LAYOUT-DAG: SHLegacyValue SH_STARTUP {{.*}}init{{.*}}(SHRuntime *shr);
+// LAYOUT-DAG: SHLegacyValue SH_COLD {{.*}}neverCalled{{.*}}(SHRuntime *shr);
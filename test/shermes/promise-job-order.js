@@ -0,0 +1,49 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %shermes -exec %s -Wx,-Xmicrotask-queue -Wx,-Xhermes-internal-test-methods=true | %FileCheck --match-full-lines %s
+
+// Check the order in which promise reactions and jobs run. Reactions are
+// queued as jobs with an argument, other jobs are called without arguments.
+// A reaction without a handler passes the result on, and a throwing handler
+// rejects the derived promise.
+
+var p = Promise.resolve(1);
+p.then(v => print('then', v));
+new Promise(resolve => resolve(5))
+  .then(v => v + 1)
+  .then(v => print('chain', v));
+HermesInternal.enqueueJob(function () {
+  print('job', arguments.length);
+});
+HermesInternal.enqueueJob(function (x) {
+  print('arg', arguments.length, x);
+}, 'x');
+Promise.reject('boom').catch(e => print('caught', e));
+Promise.reject('skip')
+  .then(v => print('unreachable', v))
+  .catch(e => print('passed', e));
+Promise.resolve(2)
+  .then(null)
+  .then(v => print('through', v));
+Promise.resolve(3)
+  .then(() => {
+    throw 'thrown';
+  })
+  .catch(e => print('rejected', e));
+print('sync');
+HermesInternal.drainJobs();
+
+// CHECK: sync
+// CHECK-NEXT: then 1
+// CHECK-NEXT: job 0
+// CHECK-NEXT: arg 1 x
+// CHECK-NEXT: caught boom
+// CHECK-NEXT: chain 6
+// CHECK-NEXT: passed skip
+// CHECK-NEXT: through 2
+// CHECK-NEXT: rejected thrown
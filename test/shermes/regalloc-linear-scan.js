@@ -0,0 +1,57 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %shermes -exec %s | %FileCheck --match-full-lines %s
+// RUN: %shermes -O -exec %s | %FileCheck --match-full-lines %s
+
+// Verify that values sharing a register through lifetime holes and MOV hints
+// are not clobbered.
+
+function rotate(n) {
+  var a = 1, b = 2, c = 3, d = 4;
+  for (var i = 0; i < n; ++i) {
+    var t = a;
+    a = b;
+    b = c;
+    c = d;
+    d = t;
+  }
+  return "" + a + b + c + d;
+}
+
+function holes(flag) {
+  var x = flag ? 10 : 20;
+  var y;
+  if (flag) {
+    y = x * 2;
+  } else {
+    var z = x + 1;
+    y = z * 3;
+  }
+  var w = y - x;
+  return [x, y, w];
+}
+
+function pressure(k) {
+  var v0 = k + 0, v1 = k + 1, v2 = k + 2, v3 = k + 3, v4 = k + 4;
+  var s = 0;
+  for (var i = 0; i < 3; ++i) {
+    var u = v0 * v4;
+    s += u + v1 - v3;
+    var tmp = v0;
+    v0 = v2;
+    v2 = tmp;
+  }
+  return s + v0 + v2;
+}
+
+print(rotate(5), rotate(8));
+// CHECK: 2341 1234
+print(holes(true), holes(false));
+// CHECK: 10,20,10 20,63,43
+print(pressure(1), pressure(10));
+// CHECK: 23 464
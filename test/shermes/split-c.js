@@ -0,0 +1,43 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %shermes -split-c=3 -j2 -exec %s | %FileCheck --match-full-lines %s
+// RUN: %shermes -split-c=2 -flto -exec %s | %FileCheck --match-full-lines %s
+// RUN: %shermes -split-c=3 -emit-c %s -o %t.c
+// RUN: %FileCheck --check-prefix=HEADER %s < %t.h
+// RUN: %FileCheck --check-prefix=UNIT %s < %t-1.c
+// RUN: %FileCheck --check-prefix=UNIT %s < %t-2.c
+
+// Verify that the generated C can be split into several translation units.
+
+function add(a, b) {
+  return a + b;
+}
+
+function greet(name) {
+  return "hello " + name;
+}
+
+function makeCounter() {
+  var n = 0;
+  return function () {
+    return ++n;
+  };
+}
+
+var counter = makeCounter();
+counter();
+print(add(1, 2), greet("world"), counter());
+// CHECK: 3 hello world 2
+
+// HEADER: #define THIS_UNIT sh_export_this_unit
+// HEADER: #define s_symbols sh_export_this_unit_symbols
+// HEADER: SH_HIDDEN extern SHSymbolID s_symbols[];
+// HEADER: SH_HIDDEN SHLegacyValue sh_export_this_unit_0_global(SHRuntime *shr);
+
+// UNIT: #include "{{.*}}.h"
+// UNIT-NOT: SHUnit THIS_UNIT =
@@ -94,6 +94,8 @@ static int executeHBCBytecodeFromCL(
           .withIntl(flags.Intl)
           .withMicrotaskQueue(flags.MicrotaskQueue)
           .withEnableSampleProfiling(flags.SampleProfiling)
+          .withAllocationProfileInterval(flags.AllocationProfileInterval)
+          .withAllocationProfileFile(flags.AllocationProfileFile)
           .withRandomizeMemoryLayout(flags.RandomizeMemoryLayout)
           .withTrackIO(flags.TrackBytecodeIO)
           .withEnableHermesInternal(flags.EnableHermesInternal)
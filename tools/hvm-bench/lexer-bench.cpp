@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+//===----------------------------------------------------------------------===//
+/// \file
+/// This benchmark measures the throughput of JSLexer in MB/s, by tokenizing a
+/// source file (typically a large bundle) several times without parsing it.
+///
+/// Without a parser, whether a '/' starts a regexp or a division is decided
+/// from the previous token, which is right for virtually all real code.
+//===----------------------------------------------------------------------===//
+#include "hermes/Parser/JSLexer.h"
+#include "hermes/Support/SourceErrorManager.h"
+#include "hermes/Support/StringTable.h"
+
+#include "llvh/ADT/SmallVector.h"
+#include "llvh/Support/CommandLine.h"
+#include "llvh/Support/Format.h"
+#include "llvh/Support/MemoryBuffer.h"
+#include "llvh/Support/PrettyStackTrace.h"
+#include "llvh/Support/Signals.h"
+#include "llvh/Support/raw_ostream.h"
+
+#include <chrono>
+
+using namespace hermes;
+using namespace hermes::parser;
+
+namespace {
+
+/// \return whether a '/' following a token of \p kind is a division.
+bool allowDivAfter(TokenKind kind) {
+  switch (kind) {
+    case TokenKind::identifier:
+    case TokenKind::private_identifier:
+    case TokenKind::numeric_literal:
+    case TokenKind::bigint_literal:
+    case TokenKind::string_literal:
+    case TokenKind::regexp_literal:
+    case TokenKind::no_substitution_template:
+    case TokenKind::template_tail:
+    case TokenKind::r_paren:
+    case TokenKind::r_square:
+    case TokenKind::r_brace:
+    case TokenKind::plusplus:
+    case TokenKind::minusminus:
+    case TokenKind::rw_this:
+    case TokenKind::rw_super:
+    case TokenKind::rw_null:
+    case TokenKind::rw_true:
+    case TokenKind::rw_false:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/// Tokenize \p input once.
+/// \return the number of tokens, or 0 if there was an error.
+size_t tokenize(llvh::MemoryBufferRef input) {
+  SourceErrorManager sm{};
+  JSLexer::Allocator allocator{};
+  StringTable strTab{allocator};
+  JSLexer lexer{input, sm, allocator, &strTab, false};
+
+  // Open brackets. True entries are template substitutions, whose closing
+  // brace continues the template.
+  llvh::SmallVector<bool, 16> nesting{};
+  size_t count = 0;
+  for (const Token *tok = lexer.advance(); tok->getKind() != TokenKind::eof;
+       ++count) {
+    TokenKind kind = tok->getKind();
+    if (kind == TokenKind::l_paren || kind == TokenKind::l_square ||
+        kind == TokenKind::l_brace) {
+      nesting.push_back(false);
+    } else if (kind == TokenKind::template_head) {
+      nesting.push_back(true);
+    } else if (
+        (kind == TokenKind::r_paren || kind == TokenKind::r_square ||
+         kind == TokenKind::r_brace) &&
+        !nesting.empty()) {
+      if (kind == TokenKind::r_brace && nesting.back()) {
+        tok = lexer.rescanRBraceInTemplateLiteral();
+        kind = tok->getKind();
+        if (kind == TokenKind::template_tail)
+          nesting.pop_back();
+      } else {
+        nesting.pop_back();
+      }
+    }
+    tok = lexer.advance(
+        allowDivAfter(kind) ? JSLexer::AllowDiv : JSLexer::AllowRegExp);
+  }
+  return sm.getErrorCount() ? 0 : count;
+}
+
+} // namespace
+
+static llvh::cl::opt<std::string> InputFilename{
+    llvh::cl::Positional,
+    llvh::cl::Required,
+    llvh::cl::desc("<input file>")};
+static llvh::cl::opt<unsigned> Iterations{
+    "iterations",
+    llvh::cl::init(10),
+    llvh::cl::desc("Number of times the input is tokenized")};
+
+int main(int argc, char **argv) {
+  // Print a stack trace if we signal out.
+  llvh::sys::PrintStackTraceOnErrorSignal("Hermes lexer benchmark");
+  llvh::PrettyStackTraceProgram X(argc, argv);
+  llvh::cl::ParseCommandLineOptions(argc, argv, "Hermes lexer benchmark\n");
+
+  auto fileOrErr = llvh::MemoryBuffer::getFile(InputFilename);
+  if (!fileOrErr) {
+    llvh::errs() << "Error reading '" << InputFilename
+                 << "': " << fileOrErr.getError().message() << "\n";
+    return 1;
+  }
+  llvh::MemoryBufferRef input = (*fileOrErr)->getMemBufferRef();
+
+  // Warm up, and make sure the input can be tokenized.
+  size_t tokens = tokenize(input);
+  if (!tokens) {
+    llvh::errs() << "Error tokenizing '" << InputFilename << "'\n";
+    return 1;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i < Iterations; ++i)
+    tokenize(input);
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  double megabytes = (double)input.getBufferSize() * Iterations / 1e6;
+  llvh::outs() << tokens << " tokens, " << input.getBufferSize()
+               << " bytes\n";
+  llvh::outs() << llvh::format("%.1f", megabytes / elapsed.count())
+               << " MB/s\n";
+  return 0;
+}
@@ -11,18 +11,45 @@
 #include "config.h"
 
 #include "hermes/BCGen/SH/SH.h"
+#include "hermes/Support/SHA1.h"
 
 #include "llvh/ADT/ScopeExit.h"
+#include "llvh/Support/FileSystem.h"
+#include "llvh/Support/MemoryBuffer.h"
 #include "llvh/Support/Path.h"
 #include "llvh/Support/Program.h"
+#include "llvh/Support/SHA1.h"
 #include "llvh/Support/Signals.h"
 
+#include <deque>
+
 #include <dlfcn.h>
+#include <sys/time.h>
+#include <unistd.h>
 
 #define DEBUG_TYPE "shermesc"
 
 using namespace hermes;
 
+std::vector<std::string> splitCFilenames(
+    llvh::StringRef cFilename,
+    unsigned numFiles) {
+  std::vector<std::string> filenames{cFilename.str()};
+  for (unsigned i = 1; i < numFiles; ++i) {
+    llvh::SmallString<32> filename{cFilename};
+    llvh::sys::path::replace_extension(filename, "");
+    filename += "-" + std::to_string(i) + ".c";
+    filenames.push_back(filename.str());
+  }
+  return filenames;
+}
+
+std::string splitCHeaderFilename(llvh::StringRef cFilename) {
+  llvh::SmallString<32> filename{cFilename};
+  llvh::sys::path::replace_extension(filename, "h");
+  return filename.str();
+}
+
 namespace {
 
 /// Invoke the backend with the specified options. If the backend generates
@@ -52,6 +79,62 @@ bool invokeBackend(
   return true;
 }
 
+/// \return true if the generated C should be split into several files when
+///   compiling to \p outputLevel. Assembly and object output is always
+///   produced from a single C file.
+bool shouldSplitC(
+    const ShermesCompileParams &params,
+    OutputLevelKind outputLevel) {
+  return params.numCFiles > 1 && outputLevel != OutputLevelKind::Asm &&
+      outputLevel != OutputLevelKind::Obj;
+}
+
+/// Invoke the backend to generate C split into params.numCFiles files, named
+/// after \p cFilename as described in splitCFilenames(), and a header named
+/// as described in splitCHeaderFilename().
+bool invokeSplitBackend(
+    Context *context,
+    Module &M,
+    const ShermesCompileParams &params,
+    llvh::StringRef cFilename) {
+  if (auto N = context->getSourceErrorManager().getErrorCount()) {
+    llvh::errs() << "Emitted " << N << " errors. exiting.\n";
+    return false;
+  }
+
+  std::string headerFilename = splitCHeaderFilename(cFilename);
+  OutputStream headerOS{};
+  if (!headerOS.open(headerFilename, llvh::sys::fs::F_None))
+    return false;
+  std::vector<std::string> unitFilenames =
+      splitCFilenames(cFilename, params.numCFiles);
+  std::vector<OutputStream> unitOSs(unitFilenames.size());
+  std::vector<llvh::raw_ostream *> units{};
+  for (size_t i = 0, e = unitFilenames.size(); i < e; ++i) {
+    if (!unitOSs[i].open(unitFilenames[i], llvh::sys::fs::F_None))
+      return false;
+    units.push_back(&unitOSs[i].os());
+  }
+
+  sh::generateSHSplit(
+      &M,
+      headerOS.os(),
+      llvh::sys::path::filename(headerFilename),
+      units,
+      params.genOptions);
+
+  // Bail out if there were any errors during code generation.
+  if (auto N = context->getSourceErrorManager().getErrorCount()) {
+    llvh::errs() << "Emitted " << N << " errors. exiting.\n";
+    return false;
+  }
+
+  bool success = headerOS.close();
+  for (OutputStream &unitOS : unitOSs)
+    success &= unitOS.close();
+  return success;
+}
+
 /// Derive an output filename from the input filename by removing the path and
 /// replacing the input extension with \p newExt, unless for some crazy reason
 /// it already happens to be that.
@@ -104,6 +187,9 @@ bool compileToC(
   if (outputFilename.empty())
     outputFilename = deriveFilename(inputFilename, outputPathBuf, ".c");
 
+  if (shouldSplitC(params, OutputLevelKind::C))
+    return invokeSplitBackend(context, M, params, outputFilename);
+
   OutputStream fileOS{};
   if (!fileOS.open(outputFilename, llvh::sys::fs::F_None))
     return false;
@@ -180,26 +266,20 @@ static void splitArgs(llvh::StringRef str, std::vector<std::string> &args) {
   }
 }
 
-/// Invoke the C compiler.
-bool invokeCC(
+/// Build the command line \p args of the C compiler \p program configured by
+/// \p cfg, compiling \p inputPaths to \p outputPath.
+/// \return false on error.
+bool buildCCArgs(
     const ShermesCompileParams &params,
+    const CCCfg &cfg,
+    llvh::StringRef program,
     OutputLevelKind outputLevel,
-    llvh::StringRef inputPath,
-    llvh::StringRef outputPath) {
-  CCCfg cfg;
-  populateCCCfg(cfg);
-
-  auto res = llvh::sys::findProgramByName(cfg.cc);
-  if (!res) {
-    llvh::errs() << cfg.cc << ":" << res.getError().message() << "\n";
-    return false;
-  }
-  llvh::StringRef program = *res;
-
-  std::vector<std::string> args{};
-
+    llvh::ArrayRef<std::string> inputPaths,
+    llvh::StringRef outputPath,
+    std::vector<std::string> &args) {
   args.emplace_back(program);
-  args.emplace_back(inputPath);
+  for (const std::string &inputPath : inputPaths)
+    args.emplace_back(inputPath);
 
   // Select compilation to asm, obj, binary
   switch (outputLevel) {
@@ -261,6 +341,9 @@ bool invokeCC(
   } else {
     splitArgs(cfg.cflags, args);
   }
+  // LTO must be enabled both when compiling and when linking.
+  if (params.lto == ShermesCompileParams::LTO::on)
+    args.emplace_back("-flto");
 
   // Append the library paths and library.
   if (outputLevel == OutputLevelKind::Executable ||
@@ -316,29 +399,265 @@ bool invokeCC(
   }
   args.emplace_back("-o");
   args.emplace_back(outputPath);
+  return true;
+}
+
+/// Run the C compiler \p program with each of the command lines \p commands,
+/// running up to \p params.genOptions.numJobs of them at the same time.
+/// \return true if all of them succeeded.
+bool runCC(
+    const ShermesCompileParams &params,
+    llvh::StringRef program,
+    llvh::ArrayRef<std::vector<std::string>> commands) {
+  /// A running invocation of the C compiler.
+  struct Job {
+    llvh::sys::ProcessInfo process;
+    std::string errMsg;
+  };
+  std::deque<Job> running{};
+  bool success = true;
+
+  // Wait for the oldest running job to terminate and record its result.
+  auto waitOldest = [&running, &success, program]() {
+    Job &job = running.front();
+    llvh::sys::ProcessInfo result =
+        llvh::sys::Wait(job.process, 0, true, &job.errMsg);
+    if (result.ReturnCode != 0) {
+      if (!job.errMsg.empty())
+        llvh::errs() << job.errMsg << "\n";
+      else
+        llvh::errs() << program << ": execution failed\n";
+      success = false;
+    }
+    running.pop_front();
+  };
 
-  std::vector<llvh::StringRef> refArgs{};
-  refArgs.reserve(args.size());
-  for (const auto &str : args)
-    refArgs.emplace_back(str);
+  size_t numJobs = std::max(1u, params.genOptions.numJobs);
+  for (const std::vector<std::string> &args : commands) {
+    std::vector<llvh::StringRef> refArgs{};
+    refArgs.reserve(args.size());
+    for (const auto &str : args)
+      refArgs.emplace_back(str);
+
+    if (params.verbosity) {
+      for (size_t i = 0; i != refArgs.size(); ++i)
+        llvh::errs() << (i ? " " : "") << refArgs[i];
+      llvh::errs() << "\n";
+    }
 
-  if (params.verbosity) {
-    for (size_t i = 0; i != refArgs.size(); ++i)
-      llvh::errs() << (i ? " " : "") << refArgs[i];
-    llvh::errs() << "\n";
+    if (running.size() == numJobs)
+      waitOldest();
+    // Stop starting new jobs after the first failure.
+    if (!success)
+      break;
+
+    running.emplace_back();
+    Job &job = running.back();
+    bool failed = false;
+    job.process = llvh::sys::ExecuteNoWait(
+        program, refArgs, llvh::None, {}, 0, &job.errMsg, &failed);
+    if (failed) {
+      llvh::errs() << program << ": " << job.errMsg << "\n";
+      running.pop_back();
+      success = false;
+      break;
+    }
   }
+  while (!running.empty())
+    waitOldest();
+  return success;
+}
 
-  std::string errMsg;
-  if (llvh::sys::ExecuteAndWait(
-          *res, refArgs, llvh::None, {}, 0, 0, &errMsg, nullptr) == 0) {
-    return true;
+/// Compute the object cache key of the split C file \p inputPath, which
+/// includes the header \p headerPath, compiled with the command line \p args.
+/// \return the key, or an empty string if a file could not be read.
+std::string computeObjectCacheKey(
+    const ShermesCompileParams &params,
+    llvh::ArrayRef<std::string> args,
+    llvh::StringRef inputPath,
+    llvh::StringRef headerPath) {
+  llvh::SHA1 hasher;
+  auto addString = [&hasher](llvh::StringRef str) {
+    // Prefix each string with its size, so that adjacent strings cannot be
+    // confused with each other.
+    uint64_t size = str.size();
+    hasher.update(
+        llvh::ArrayRef<uint8_t>((const uint8_t *)&size, sizeof(size)));
+    hasher.update(str);
+  };
+
+  addString(params.objectCacheSalt);
+  // The paths of the input and the output don't affect the object.
+  for (size_t i = 0, e = args.size(); i < e; ++i) {
+    if (args[i] == "-o")
+      ++i;
+    else if (args[i] != inputPath)
+      addString(args[i]);
+  }
+  for (llvh::StringRef path : {inputPath, headerPath}) {
+    auto buf = llvh::MemoryBuffer::getFile(path);
+    if (!buf)
+      return "";
+    addString((*buf)->getBuffer());
   }
 
-  if (!errMsg.empty())
-    llvh::errs() << errMsg << "\n";
-  else
-    llvh::errs() << program << ": execution failed\n";
-  return false;
+  std::string rawHash = hasher.final().str();
+  SHA1 hash{};
+  assert(rawHash.size() == SHA1_NUM_BYTES && "Incorrect length of SHA1 hash");
+  std::copy(rawHash.begin(), rawHash.end(), hash.begin());
+  return hashAsString(hash);
+}
+
+/// Copy the object \p objPath into the object cache as \p cachedPath. The
+/// object is copied to a temporary file first, so that a failure never leaves
+/// a partial object in the cache.
+void addToObjectCache(llvh::StringRef objPath, llvh::StringRef cachedPath) {
+  llvh::SmallString<64> tmpPath{};
+  int tmpFD;
+  if (llvh::sys::fs::createUniqueFile(
+          cachedPath + "-%%%%%%.tmp", tmpFD, tmpPath))
+    return;
+  ::close(tmpFD);
+  if (llvh::sys::fs::copy_file(objPath, tmpPath) ||
+      llvh::sys::fs::rename(tmpPath, cachedPath)) {
+    llvh::sys::fs::remove(tmpPath);
+  }
+}
+
+/// Invoke the C compiler to compile the C files \p inputPaths to
+/// \p outputPath. Multiple files can only be linked into an executable or a
+/// shared library. They are compiled to objects in parallel first. The
+/// objects are looked up in, and added to, params.objectCacheDir if it is
+/// set.
+bool invokeCC(
+    const ShermesCompileParams &params,
+    OutputLevelKind outputLevel,
+    llvh::ArrayRef<std::string> inputPaths,
+    llvh::StringRef outputPath) {
+  CCCfg cfg;
+  populateCCCfg(cfg);
+
+  auto res = llvh::sys::findProgramByName(cfg.cc);
+  if (!res) {
+    llvh::errs() << cfg.cc << ":" << res.getError().message() << "\n";
+    return false;
+  }
+  llvh::StringRef program = *res;
+
+  if (inputPaths.size() == 1) {
+    std::vector<std::string> args{};
+    if (!buildCCArgs(
+            params, cfg, program, outputLevel, inputPaths, outputPath, args))
+      return false;
+    return runCC(params, program, args);
+  }
+
+  assert(
+      (outputLevel == OutputLevelKind::Executable ||
+       outputLevel == OutputLevelKind::SharedObj) &&
+      "only linking supports multiple C files");
+
+  // Compile the objects into a temporary directory.
+  llvh::SmallString<32> objDir{};
+  if (auto EC = llvh::sys::fs::createUniqueDirectory("shermes", objDir)) {
+    llvh::errs() << "Error creating temporary directory: " << EC.message()
+                 << '\n';
+    return false;
+  }
+  bool keepTemp = params.keepTemp == ShermesCompileParams::KeepTemp::on;
+  std::vector<std::string> objPaths{};
+  auto removeOnExit = llvh::make_scope_exit([&objDir, &objPaths, keepTemp]() {
+    if (!keepTemp) {
+      for (const std::string &objPath : objPaths)
+        llvh::sys::fs::remove(objPath);
+      llvh::sys::fs::remove(objDir);
+    }
+  });
+
+  // The split C files share the header of the first one.
+  std::string headerPath = splitCHeaderFilename(inputPaths.front());
+  // The paths in the cache of the objects that are compiled, by index in
+  // objPaths. Empty for objects that are not cached.
+  std::vector<std::string> objsToCache(inputPaths.size());
+  // The objects linked together, some of which may be in the cache.
+  std::vector<std::string> linkPaths{};
+
+  std::vector<std::vector<std::string>> commands{};
+  for (const std::string &inputPath : inputPaths) {
+    llvh::SmallString<32> objPath{objDir};
+    llvh::sys::path::append(objPath, llvh::sys::path::filename(inputPath));
+    llvh::sys::path::replace_extension(objPath, "o");
+
+    std::vector<std::string> args{};
+    if (!buildCCArgs(
+            params,
+            cfg,
+            program,
+            OutputLevelKind::Obj,
+            inputPath,
+            objPath,
+            args))
+      return false;
+    if (outputLevel == OutputLevelKind::SharedObj)
+      args.emplace_back("-fPIC");
+
+    if (!params.objectCacheDir.empty()) {
+      std::string key =
+          computeObjectCacheKey(params, args, inputPath, headerPath);
+      if (!key.empty()) {
+        llvh::SmallString<64> cachedPath{params.objectCacheDir};
+        llvh::sys::path::append(cachedPath, key + ".o");
+        if (llvh::sys::fs::exists(cachedPath)) {
+          if (params.verbosity)
+            llvh::errs() << "Using cached object " << cachedPath << "\n";
+          touchCompileCacheEntry(cachedPath);
+          linkPaths.push_back(cachedPath.str());
+          continue;
+        }
+        objsToCache[objPaths.size()] = cachedPath.str();
+      }
+    }
+
+    objPaths.push_back(objPath.str());
+    linkPaths.push_back(objPath.str());
+    commands.push_back(std::move(args));
+  }
+  if (!runCC(params, program, commands))
+    return false;
+  for (size_t i = 0, e = objPaths.size(); i < e; ++i) {
+    if (!objsToCache[i].empty())
+      addToObjectCache(objPaths[i], objsToCache[i]);
+  }
+
+  std::vector<std::string> linkArgs{};
+  if (!buildCCArgs(
+          params, cfg, program, outputLevel, linkPaths, outputPath, linkArgs))
+    return false;
+  return runCC(params, program, linkArgs);
+}
+
+/// Derive the name of the native output file of level \p outputLevel from the
+/// input filename \p inputFilename, if \p outputFilename is empty.
+/// \param storage storage where a derived name is kept
+/// \return the output filename.
+llvh::StringRef deriveNativeOutputFilename(
+    OutputLevelKind outputLevel,
+    llvh::StringRef inputFilename,
+    llvh::StringRef outputFilename,
+    llvh::SmallString<32> &storage) {
+  if (!outputFilename.empty())
+    return outputFilename;
+  if (outputLevel == OutputLevelKind::Executable ||
+      outputLevel == OutputLevelKind::SharedObj) {
+    return "a.out";
+  }
+  assert(
+      outputLevel == OutputLevelKind::Asm ||
+      outputLevel == OutputLevelKind::Obj);
+  return deriveFilename(
+      inputFilename,
+      storage,
+      outputLevel == OutputLevelKind::Asm ? ".s" : ".o");
 }
 
 /// Generate C source, then invoke the C compiler to compile it either to .s,
@@ -352,19 +671,37 @@ bool compileFromC(
     llvh::StringRef outputFilename) {
   // If an output file name is not specified, derive it from the input.
   llvh::SmallString<32> outputPathBuf{};
-  if (outputFilename.empty()) {
-    if (outputLevel == OutputLevelKind::Executable ||
-        outputLevel == OutputLevelKind::SharedObj) {
-      outputFilename = "a.out";
-    } else {
-      assert(
-          outputLevel == OutputLevelKind::Asm ||
-          outputLevel == OutputLevelKind::Obj);
-      outputFilename = deriveFilename(
-          inputFilename,
-          outputPathBuf,
-          outputLevel == OutputLevelKind::Asm ? ".s" : ".o");
+  outputFilename = deriveNativeOutputFilename(
+      outputLevel, inputFilename, outputFilename, outputPathBuf);
+
+  bool keepTemp = params.keepTemp == ShermesCompileParams::KeepTemp::on;
+
+  if (shouldSplitC(params, outputLevel)) {
+    // Generate the split C into a temporary directory.
+    llvh::SmallString<32> tmpDir{};
+    if (auto EC = llvh::sys::fs::createUniqueDirectory("shermes", tmpDir)) {
+      llvh::errs() << "Error creating temporary directory: " << EC.message()
+                   << '\n';
+      return false;
     }
+    llvh::SmallString<32> cFilename{tmpDir};
+    llvh::sys::path::append(
+        cFilename, llvh::sys::path::filename(inputFilename));
+    llvh::sys::path::replace_extension(cFilename, "c");
+    std::vector<std::string> cFilenames =
+        splitCFilenames(cFilename, params.numCFiles);
+    auto removeOnExit = llvh::make_scope_exit([&]() {
+      if (!keepTemp) {
+        for (const std::string &filename : cFilenames)
+          llvh::sys::fs::remove(filename);
+        llvh::sys::fs::remove(splitCHeaderFilename(cFilename));
+        llvh::sys::fs::remove(tmpDir);
+      }
+    });
+
+    if (!invokeSplitBackend(context, M, params, cFilename))
+      return false;
+    return invokeCC(params, outputLevel, cFilenames, outputFilename);
   }
 
   // Synthesize a temporary file name for the .c file. It needs to have the
@@ -378,7 +715,6 @@ bool compileFromC(
                  << '\n';
     return false;
   }
-  bool keepTemp = params.keepTemp == ShermesCompileParams::KeepTemp::on;
   // Don't forget to delete the temporary on exit.
   if (!keepTemp) {
     llvh::sys::RemoveFileOnSignal(tmpPath);
@@ -405,16 +741,52 @@ bool compileFromC(
     }
   }
 
-  return invokeCC(params, outputLevel, tmpPath, outputFilename);
+  return invokeCC(params, outputLevel, tmpPath.str().str(), outputFilename);
+}
+
+/// Invoke the C compiler on the existing C file \p cFilename to compile it
+/// either to .s, .o, or an executable binary. If \p outputLevel is
+/// OutputLevelKind::C, the file is just copied.
+bool compileCFile(
+    const ShermesCompileParams &params,
+    OutputLevelKind outputLevel,
+    llvh::StringRef cFilename,
+    llvh::StringRef inputFilename,
+    llvh::StringRef outputFilename) {
+  llvh::SmallString<32> outputPathBuf{};
+  if (outputLevel == OutputLevelKind::C) {
+    assert(
+        !shouldSplitC(params, outputLevel) &&
+        "split C cannot be copied, because of the header name");
+    if (outputFilename.empty())
+      outputFilename = deriveFilename(inputFilename, outputPathBuf, ".c");
+    if (auto EC = llvh::sys::fs::copy_file(cFilename, outputFilename)) {
+      llvh::errs() << "Error writing to " << outputFilename << ": "
+                   << EC.message() << '\n';
+      return false;
+    }
+    return true;
+  }
+
+  outputFilename = deriveNativeOutputFilename(
+      outputLevel, inputFilename, outputFilename, outputPathBuf);
+  if (shouldSplitC(params, outputLevel)) {
+    return invokeCC(
+        params,
+        outputLevel,
+        splitCFilenames(cFilename, params.numCFiles),
+        outputFilename);
+  }
+  return invokeCC(params, outputLevel, cFilename.str(), outputFilename);
 }
 
-/// Compile to an executable and run it.
+/// Compile to an executable using \p compileSharedObj, which compiles the
+/// program to a shared library with the specified path, and run it.
 bool execute(
-    hermes::Context *context,
-    hermes::Module &M,
     const ShermesCompileParams &params,
     llvh::StringRef inputFilename,
-    llvh::ArrayRef<std::string> execArgs) {
+    llvh::ArrayRef<std::string> execArgs,
+    llvh::function_ref<bool(llvh::StringRef)> compileSharedObj) {
   llvh::SmallString<32> tmpPath;
   if (auto EC = llvh::sys::fs::createTemporaryFile(
           llvh::sys::path::filename(inputFilename), {}, tmpPath)) {
@@ -435,15 +807,8 @@ bool execute(
   });
 
   // Produce a shared library that still contains the main function.
-  if (!compileFromC(
-          context,
-          M,
-          params,
-          OutputLevelKind::SharedObj,
-          inputFilename,
-          tmpPath)) {
+  if (!compileSharedObj(tmpPath))
     return false;
-  }
 
   llvh::SmallVector<const char *, 1> args{};
   // Add the library at the start as a dummy argument, since the argument parser
@@ -494,10 +859,110 @@ bool shermesCompile(
         context, M, params, outputLevel, inputFilename, outputFilename);
   }
   if (outputLevel == OutputLevelKind::Run) {
-    return execute(context, M, params, inputFilename, execArgs);
+    return execute(
+        params, inputFilename, execArgs, [&](llvh::StringRef soPath) {
+          return compileFromC(
+              context,
+              M,
+              params,
+              OutputLevelKind::SharedObj,
+              inputFilename,
+              soPath);
+        });
   }
 
   assert(false && "unsupported output level");
   llvh::errs() << "Unsupported compilation mode\n";
   return false;
 }
+
+bool shermesCompileCFile(
+    const ShermesCompileParams &params,
+    OutputLevelKind outputLevel,
+    llvh::StringRef cFilename,
+    llvh::StringRef inputFilename,
+    llvh::StringRef outputFilename,
+    llvh::ArrayRef<std::string> execArgs) {
+  assert(
+      outputLevel >= OutputLevelKind::C &&
+      "C file can only be compiled to C or native output");
+  if (outputLevel <= OutputLevelKind::Executable) {
+    return compileCFile(
+        params, outputLevel, cFilename, inputFilename, outputFilename);
+  }
+  if (outputLevel == OutputLevelKind::Run) {
+    return execute(
+        params, inputFilename, execArgs, [&](llvh::StringRef soPath) {
+          return compileCFile(
+              params,
+              OutputLevelKind::SharedObj,
+              cFilename,
+              inputFilename,
+              soPath);
+        });
+  }
+
+  assert(false && "unsupported output level");
+  llvh::errs() << "Unsupported compilation mode\n";
+  return false;
+}
+
+void touchCompileCacheEntry(llvh::StringRef path) {
+  // Passing null sets both times to the current time.
+  ::utimes(path.str().c_str(), nullptr);
+}
+
+void trimCompileCache(llvh::StringRef cacheDir, uint64_t maxBytes) {
+  /// An entry of the cache: a file, or a directory of files.
+  struct Entry {
+    std::string path;
+    llvh::sys::TimePoint<> lastUse;
+    uint64_t size;
+    bool isDir;
+  };
+  std::vector<Entry> entries{};
+  uint64_t totalSize = 0;
+
+  std::error_code EC;
+  for (llvh::sys::fs::directory_iterator it(cacheDir, EC), end;
+       !EC && it != end;
+       it.increment(EC)) {
+    llvh::sys::fs::file_status status;
+    if (llvh::sys::fs::status(it->path(), status))
+      continue;
+    Entry entry{
+        it->path(),
+        status.getLastModificationTime(),
+        status.getSize(),
+        status.type() == llvh::sys::fs::file_type::directory_file};
+    if (entry.isDir) {
+      entry.size = 0;
+      std::error_code dirEC;
+      for (llvh::sys::fs::directory_iterator fileIt(entry.path, dirEC);
+           !dirEC && fileIt != end;
+           fileIt.increment(dirEC)) {
+        llvh::sys::fs::file_status fileStatus;
+        if (!llvh::sys::fs::status(fileIt->path(), fileStatus))
+          entry.size += fileStatus.getSize();
+      }
+    }
+    totalSize += entry.size;
+    entries.push_back(std::move(entry));
+  }
+  if (totalSize <= maxBytes)
+    return;
+
+  // Delete the least recently used entries first.
+  std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) {
+    return a.lastUse < b.lastUse;
+  });
+  for (const Entry &entry : entries) {
+    if (totalSize <= maxBytes)
+      break;
+    if (entry.isDir)
+      llvh::sys::fs::remove_directories(entry.path);
+    else
+      llvh::sys::fs::remove(entry.path);
+    totalSize -= entry.size;
+  }
+}
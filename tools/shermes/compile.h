@@ -51,8 +51,20 @@ struct ShermesCompileParams {
   llvh::ArrayRef<std::string> extraCCOptions{};
   llvh::ArrayRef<std::string> libs{};
   llvh::ArrayRef<std::string> libSearchPaths{};
+  /// Number of C files the generated code is split into when producing C, an
+  /// executable or a shared library. The files are compiled in parallel.
+  unsigned numCFiles = 1;
+  /// Enable link-time optimization in the C compiler, which recovers the
+  /// cross-file optimizations lost by splitting the C.
+  enum class LTO { off, on };
+  LTO lto = LTO::off;
   enum class KeepTemp { off, on };
   KeepTemp keepTemp = KeepTemp::off;
+  /// Directory where the objects compiled from split C files are cached and
+  /// reused, or empty if they are not cached.
+  llvh::StringRef objectCacheDir{};
+  /// Identifies the compiler in object cache keys.
+  llvh::StringRef objectCacheSalt{};
   int verbosity = 0;
 
   explicit ShermesCompileParams(
@@ -71,4 +83,36 @@ bool shermesCompile(
     llvh::StringRef outputFilename,
     llvh::ArrayRef<std::string> execArgs);
 
+/// Compile the C file \p cFilename, previously generated with
+/// shermesCompile(), to the specified output level, which must be at least
+/// OutputLevelKind::C. \p inputFilename is only used to derive the default
+/// output filename.
+/// Errors are printed to STDERR.
+bool shermesCompileCFile(
+    const ShermesCompileParams &params,
+    OutputLevelKind outputLevel,
+    llvh::StringRef cFilename,
+    llvh::StringRef inputFilename,
+    llvh::StringRef outputFilename,
+    llvh::ArrayRef<std::string> execArgs);
+
+/// \return the names of the files generated for \p cFilename when the C is
+///   split into \p numFiles files: \p cFilename itself, followed by
+///   "<stem>-1.c", "<stem>-2.c", etc. in the same directory.
+std::vector<std::string> splitCFilenames(
+    llvh::StringRef cFilename,
+    unsigned numFiles);
+
+/// \return the name of the header shared by the files generated for
+///   \p cFilename when the C is split.
+std::string splitCHeaderFilename(llvh::StringRef cFilename);
+
+/// Mark the compilation cache entry \p path as just used, by updating its
+/// modification time.
+void touchCompileCacheEntry(llvh::StringRef path);
+
+/// Delete the least recently used entries of the compilation cache in
+/// \p cacheDir until their total size is at most \p maxBytes.
+void trimCompileCache(llvh::StringRef cacheDir, uint64_t maxBytes);
+
 #endif // SHERMES_COMPILE_H
@@ -11,6 +11,7 @@
 #include "hermes/AST/ESTreeJSONDumper.h"
 #include "hermes/AST/NativeContext.h"
 #include "hermes/AST/TS2Flow.h"
+#include "hermes/IR/ExecutionProfile.h"
 #include "hermes/IR/IRVerifier.h"
 #include "hermes/IRGen/IRGen.h"
 #include "hermes/Optimizer/PassManager/PassManager.h"
@@ -22,16 +23,21 @@
 #include "hermes/SourceMap/SourceMap.h"
 #include "hermes/SourceMap/SourceMapTranslator.h"
 #include "hermes/Support/OSCompat.h"
+#include "hermes/Support/SHA1.h"
 
 #include "llvh/ADT/ScopeExit.h"
 #include "llvh/Support/CommandLine.h"
 #include "llvh/Support/InitLLVM.h"
 #include "llvh/Support/MemoryBuffer.h"
+#include "llvh/Support/Path.h"
 #include "llvh/Support/PrettyStackTrace.h"
 #include "llvh/Support/Process.h"
 #include "llvh/Support/Program.h"
+#include "llvh/Support/SHA1.h"
 #include "llvh/Support/Signals.h"
 
+#include <thread>
+
 using namespace hermes;
 namespace cl = llvh::cl;
 
@@ -315,6 +321,66 @@ cl::opt<bool> ReusePropCache(
 
 CLFlag Inline('f', "inline", true, "inlining of functions", CompilerCategory);
 
+cl::opt<std::string> ProfileGenerate(
+    "profile-generate",
+    cl::desc(
+        "Instrument the generated code to record an execution profile, "
+        "which the generated main function writes to the given file"),
+    cl::value_desc("filename"),
+    cl::cat(CompilerCategory));
+
+cl::opt<std::string> ProfileUse(
+    "profile-use",
+    cl::desc(
+        "Use the execution profile in the given file to guide inlining and "
+        "function layout"),
+    cl::value_desc("filename"),
+    cl::cat(CompilerCategory));
+
+cl::opt<std::string> CacheDir(
+    "cache-dir",
+    cl::desc(
+        "Cache the generated C, and the objects compiled from split C, in the "
+        "given directory and reuse them when the inputs, options and compiler "
+        "have not changed"),
+    cl::value_desc("dir"),
+    cl::cat(CompilerCategory));
+
+cl::opt<unsigned> CacheMaxSize(
+    "cache-max-size",
+    cl::desc(
+        "Delete the least recently used entries of the -cache-dir cache when "
+        "it grows beyond the given size in MiB (0 for no limit)"),
+    cl::value_desc("MiB"),
+    cl::init(1024),
+    cl::cat(CompilerCategory));
+
+cl::opt<unsigned> SplitC(
+    "split-c",
+    cl::desc(
+        "Split the generated C into N files, which are compiled in parallel "
+        "and linked together (ignored with -S and -c)"),
+    cl::value_desc("N"),
+    cl::init(1),
+    cl::cat(CompilerCategory));
+
+CLFlag NativeLTO(
+    'f',
+    "lto",
+    false,
+    "link-time optimization when compiling the generated C",
+    CompilerCategory);
+
+cl::opt<unsigned> Jobs(
+    "j",
+    cl::desc(
+        "Number of threads used to parse large inputs and compile functions "
+        "in parallel (0 means one per hardware thread)"),
+    cl::value_desc("N"),
+    cl::init(1),
+    cl::Prefix,
+    cl::cat(CompilerCategory));
+
 CLFlag StripFunctionNames(
     'f',
     "strip-function-names",
@@ -548,6 +614,10 @@ std::shared_ptr<Context> createContext() {
   // Make sure nothing is lazy
   context->setLazyCompilation(false);
 
+  context->setParseJobs(
+      cli::Jobs ? (unsigned)cli::Jobs
+                : std::max(1u, std::thread::hardware_concurrency()));
+
 #if HERMES_PARSE_JSX
   if (cli::JSX) {
     context->setParseJSX(true);
@@ -585,6 +655,18 @@ std::shared_ptr<Context> createContext() {
   }
   // context->setEmitAsyncBreakCheck(cl::EmitAsyncBreakCheck);
 
+  if (!cli::ProfileUse.empty()) {
+    std::unique_ptr<llvh::MemoryBuffer> profileBuf =
+        memoryBufferFromFile(cli::ProfileUse);
+    if (!profileBuf)
+      return nullptr;
+    std::shared_ptr<ExecutionProfile> profile = ExecutionProfile::parse(
+        std::move(profileBuf), context->getSourceErrorManager());
+    if (!profile)
+      return nullptr;
+    context->setExecutionProfile(std::move(profile));
+  }
+
   return context;
 }
 
@@ -792,7 +874,201 @@ ESTree::NodePtr parseJS(
   return parsedAST;
 }
 
-bool compileFromCommandLineOptions() {
+/// \return the code generation options selected by the command line. Options
+///   that depend on the parsed source are left to the caller.
+BytecodeGenerationOptions genOptionsFromCommandLine() {
+  BytecodeGenerationOptions genOptions{toOutputFormatKind(cli::OutputLevel)};
+  genOptions.optimizationEnabled = cli::OptimizationLevel > OptLevel::Og;
+  // genOptions.basicBlockProfiling = cl::BasicBlockProfiling;
+  // genOptions.padFunctionBodiesPercent = cl::PadFunctionBodiesPercent;
+
+  genOptions.verifyIR = cli::VerifyIR;
+
+  // If the user requests to output a source map, then do not also emit debug
+  // info into the bytecode.
+  // genOptions.stripDebugInfoSection =
+  //    cl::OutputSourceMap || cl::DebugInfoLevel == cl::DebugLevel::g0;
+
+  genOptions.stripFunctionNames = cli::StripFunctionNames;
+
+  // If we are not exporting a unit, produce the main function.
+  genOptions.emitMain = cli::ExportedUnit.empty();
+  if (!cli::ExportedUnit.empty())
+    genOptions.unitName = cli::ExportedUnit;
+
+  genOptions.emitSourceLocations =
+      cli::DumpSourceLocation != LocationDumpMode::None;
+
+  // Emit line directives if we have full debug info enabled or it was
+  // explicitly requested.
+  genOptions.emitLineDirectives =
+      cli::DebugInfoLevel >= DebugLevel::g3 || cli::ForceLineDirectives;
+
+  genOptions.profileGenerateFile = cli::ProfileGenerate;
+
+  genOptions.numJobs = cli::Jobs
+      ? (unsigned)cli::Jobs
+      : std::max(1u, std::thread::hardware_concurrency());
+  return genOptions;
+}
+
+/// Identifies the compiler in compilation cache keys. Empty if the cache is
+/// disabled.
+std::string compileCacheSalt{};
+
+/// Populate the native compilation fields of \p params from the command line.
+void populateCompileParams(ShermesCompileParams &params) {
+  params.nativeOptimize = cli::OptimizationLevel;
+  params.enableAsserts = cli::EnableAsserts
+      ? ShermesCompileParams::EnableAsserts::on
+      : ShermesCompileParams::EnableAsserts::off;
+  params.lean = cli::Lean ? ShermesCompileParams::Lean::on
+                          : ShermesCompileParams::Lean::off;
+  params.staticLink = cli::StaticLink ? ShermesCompileParams::StaticLink::on
+                                      : ShermesCompileParams::StaticLink::off;
+  params.extraCCOptions = cli::ExtraCCOptions;
+  params.libs = cli::Libs;
+  params.libSearchPaths = cli::LibSearchPaths;
+  params.keepTemp = cli::KeepTemp ? ShermesCompileParams::KeepTemp::on
+                                  : ShermesCompileParams::KeepTemp::off;
+  params.verbosity = cli::Verbose.getNumOccurrences();
+  params.numCFiles = std::max(1u, (unsigned)cli::SplitC);
+  params.lto = cli::NativeLTO ? ShermesCompileParams::LTO::on
+                              : ShermesCompileParams::LTO::off;
+  if (!compileCacheSalt.empty()) {
+    params.objectCacheDir = cli::CacheDir;
+    params.objectCacheSalt = compileCacheSalt;
+  }
+}
+
+/// Compile the previously generated C file \p cPath to the requested output.
+bool compileCFile(llvh::StringRef cPath) {
+  BytecodeGenerationOptions genOptions = genOptionsFromCommandLine();
+  ShermesCompileParams params(genOptions);
+  populateCompileParams(params);
+  return shermesCompileCFile(
+      params,
+      cli::OutputLevel,
+      cPath,
+      cli::InputFilenames[cli::InputFilenames.size() - 1],
+      cli::OutputFilename,
+      cli::ExecArgs);
+}
+
+/// Version of the compilation cache. Bump it when the meaning of a cache
+/// entry changes.
+constexpr unsigned kCompileCacheVersion = 2;
+
+/// Name of the generated C file in a compilation cache entry. When the C is
+/// split, the other files are named after it. The name is the same in every
+/// entry, so that the split C files of different entries include their header
+/// by the same name and their objects can be shared.
+constexpr const char *kCompileCacheCFile = "unit.c";
+
+/// \return true if the command line argument \p arg does not affect the
+///   generated C, so it must not be part of the compilation cache key. Sets
+///   \p skipValue if the following argument is the value of \p arg.
+bool isIgnoredByCompileCache(llvh::StringRef arg, bool &skipValue) {
+  if (!arg.startswith("-"))
+    return false;
+  llvh::StringRef name = arg.ltrim('-');
+  llvh::StringRef optName = name.split('=').first;
+
+  // Options whose value only controls where and how the output is produced.
+  if (optName == "o" || optName == "cache-dir" ||
+      optName == "cache-max-size" || optName == "j") {
+    skipValue = optName.size() == name.size();
+    return true;
+  }
+  if (name.startswith("Wx,") ||
+      (name.startswith("j") && name.size() > 1 && isdigit(name[1]))) {
+    return true;
+  }
+  // All native output levels are compiled from the same C.
+  return name == "v" || name == "keep-temp" || name == "emit-c" ||
+      name == "S" || name == "c" || name == "exec";
+}
+
+/// \return a string identifying the cache version and the compiler binary
+///   \p argv0, so that rebuilding the compiler invalidates the cache, or an
+///   empty string if the compiler could not be identified.
+std::string computeCompileCacheSalt(const char *argv0) {
+  static int anchor;
+  std::string exe = llvh::sys::fs::getMainExecutable(argv0, &anchor);
+  llvh::sys::fs::file_status exeStatus;
+  if (exe.empty() || llvh::sys::fs::status(exe, exeStatus))
+    return "";
+  std::string salt = std::to_string(kCompileCacheVersion);
+#ifdef HERMES_RELEASE_VERSION
+  salt += " " HERMES_RELEASE_VERSION;
+#endif
+  salt += " " + exe + " " + std::to_string(exeStatus.getSize()) + " " +
+      std::to_string(
+              exeStatus.getLastModificationTime().time_since_epoch().count());
+  return salt;
+}
+
+/// Compute the compilation cache key of the input files \p fileBufs compiled
+/// with the command line \p args, by the compiler identified by
+/// compileCacheSalt.
+std::string computeCompileCacheKey(
+    llvh::ArrayRef<char *> args,
+    llvh::ArrayRef<std::unique_ptr<llvh::MemoryBuffer>> fileBufs) {
+  llvh::SHA1 hasher;
+  auto addString = [&hasher](llvh::StringRef str) {
+    // Prefix each string with its size, so that adjacent strings cannot be
+    // confused with each other.
+    uint64_t size = str.size();
+    hasher.update(
+        llvh::ArrayRef<uint8_t>((const uint8_t *)&size, sizeof(size)));
+    hasher.update(str);
+  };
+
+  addString(compileCacheSalt);
+
+  bool skipValue = false;
+  for (llvh::StringRef arg : args.drop_front()) {
+    if (skipValue) {
+      skipValue = false;
+      continue;
+    }
+    if (!isIgnoredByCompileCache(arg, skipValue))
+      addString(arg);
+  }
+
+  for (const auto &fileBuf : fileBufs)
+    addString(fileBuf->getBuffer());
+
+  // The execution profile is an input too.
+  if (!cli::ProfileUse.empty()) {
+    std::unique_ptr<llvh::MemoryBuffer> profileBuf =
+        memoryBufferFromFile(cli::ProfileUse, false, true);
+    addString(profileBuf ? profileBuf->getBuffer() : "");
+  }
+
+  std::string rawHash = hasher.final().str();
+  SHA1 hash{};
+  assert(rawHash.size() == SHA1_NUM_BYTES && "Incorrect length of SHA1 hash");
+  std::copy(rawHash.begin(), rawHash.end(), hash.begin());
+  return hashAsString(hash);
+}
+
+/// \return true if every file of the compilation cache entry whose main C
+///   file is \p cPath exists.
+bool isCompileCacheEntryComplete(llvh::StringRef cPath) {
+  unsigned numCFiles = std::max(1u, (unsigned)cli::SplitC);
+  if (numCFiles > 1 &&
+      !llvh::sys::fs::exists(splitCHeaderFilename(cPath))) {
+    return false;
+  }
+  for (const std::string &filename : splitCFilenames(cPath, numCFiles)) {
+    if (!llvh::sys::fs::exists(filename))
+      return false;
+  }
+  return true;
+}
+
+bool compileFromCommandLineOptions(llvh::ArrayRef<char *> args) {
   if (cli::OutputLevel != OutputLevelKind::Run && !cli::ExecArgs.empty()) {
     llvh::errs() << "Error: unused exec arguments\n";
     return false;
@@ -816,6 +1092,49 @@ bool compileFromCommandLineOptions() {
     return false;
   }
 
+  std::vector<std::unique_ptr<llvh::MemoryBuffer>> fileBufs{};
+  for (llvh::StringRef filename : cli::InputFilenames) {
+    std::unique_ptr<llvh::MemoryBuffer> fileBuf =
+        memoryBufferFromFile(filename, true);
+    if (!fileBuf)
+      return false;
+    fileBufs.push_back(std::move(fileBuf));
+  }
+
+  // If the compilation cache is enabled and C is needed, look the generated C
+  // up in the cache before doing any work. Each entry is a directory named
+  // after the key, containing the C files.
+  llvh::SmallString<64> entryPath{};
+  llvh::SmallString<64> cachePath{};
+  // Split C can't be copied out of the cache, because the files refer to their
+  // header by name.
+  bool canUseCache = cli::OutputLevel > OutputLevelKind::C ||
+      (cli::OutputLevel == OutputLevelKind::C && cli::SplitC <= 1);
+  if (!cli::CacheDir.empty() && canUseCache) {
+    compileCacheSalt = computeCompileCacheSalt(args[0]);
+    if (!compileCacheSalt.empty()) {
+      entryPath = cli::CacheDir;
+      llvh::sys::path::append(
+          entryPath, computeCompileCacheKey(args, fileBufs));
+      cachePath = entryPath;
+      llvh::sys::path::append(cachePath, kCompileCacheCFile);
+    } else {
+      llvh::errs() << "Warning: compilation cache disabled, failed to "
+                      "identify the compiler\n";
+    }
+  }
+  // Keep the cache within its size limit once the compilation is done.
+  auto trimCache = llvh::make_scope_exit([]() {
+    if (!compileCacheSalt.empty() && cli::CacheMaxSize)
+      trimCompileCache(cli::CacheDir, (uint64_t)cli::CacheMaxSize << 20);
+  });
+  if (!cachePath.empty() && isCompileCacheEntryComplete(cachePath)) {
+    if (cli::Verbose.getNumOccurrences())
+      llvh::errs() << "Using cached " << cachePath << "\n";
+    touchCompileCacheEntry(entryPath);
+    return compileCFile(cachePath);
+  }
+
   std::shared_ptr<Context> context = createContext();
   if (!context)
     return false;
@@ -836,15 +1155,6 @@ bool compileFromCommandLineOptions() {
   Module M(context);
   sema::SemContext semCtx(*context);
   flow::FlowContext flowContext{};
-  std::vector<std::unique_ptr<llvh::MemoryBuffer>> fileBufs{};
-
-  for (llvh::StringRef filename : cli::InputFilenames) {
-    std::unique_ptr<llvh::MemoryBuffer> fileBuf =
-        memoryBufferFromFile(filename, true);
-    if (!fileBuf)
-      return false;
-    fileBufs.push_back(std::move(fileBuf));
-  }
 
   // TODO: support input source map.
   ESTree::NodePtr ast = parseJS(
@@ -917,52 +1227,56 @@ bool compileFromCommandLineOptions() {
   }
 #endif
 
-  BytecodeGenerationOptions genOptions{toOutputFormatKind(cli::OutputLevel)};
-  genOptions.optimizationEnabled = cli::OptimizationLevel > OptLevel::Og;
-  // genOptions.basicBlockProfiling = cl::BasicBlockProfiling;
+  BytecodeGenerationOptions genOptions = genOptionsFromCommandLine();
   //  The static builtin setting should be set correctly after command line
   //  options parsing and js parsing. Set the bytecode header flag here.
   genOptions.staticBuiltinsEnabled = context->getStaticBuiltinOptimization();
-  // genOptions.padFunctionBodiesPercent = cl::PadFunctionBodiesPercent;
-
-  genOptions.verifyIR = cli::VerifyIR;
-
-  // If the user requests to output a source map, then do not also emit debug
-  // info into the bytecode.
-  // genOptions.stripDebugInfoSection =
-  //    cl::OutputSourceMap || cl::DebugInfoLevel == cl::DebugLevel::g0;
-
-  genOptions.stripFunctionNames = cli::StripFunctionNames;
-
-  // If we are not exporting a unit, produce the main function.
-  genOptions.emitMain = cli::ExportedUnit.empty();
-  if (!cli::ExportedUnit.empty())
-    genOptions.unitName = cli::ExportedUnit;
-
-  genOptions.emitSourceLocations =
-      cli::DumpSourceLocation != LocationDumpMode::None;
-
-  // Emit line directives if we have full debug info enabled or it was
-  // explicitly requested.
-  genOptions.emitLineDirectives =
-      cli::DebugInfoLevel >= DebugLevel::g3 || cli::ForceLineDirectives;
 
   ShermesCompileParams params(genOptions);
-  // Populate all fields of ShermesCompileParams.
-  params.nativeOptimize = cli::OptimizationLevel;
-  params.enableAsserts = cli::EnableAsserts
-      ? ShermesCompileParams::EnableAsserts::on
-      : ShermesCompileParams::EnableAsserts::off;
-  params.lean = cli::Lean ? ShermesCompileParams::Lean::on
-                          : ShermesCompileParams::Lean::off;
-  params.staticLink = cli::StaticLink ? ShermesCompileParams::StaticLink::on
-                                      : ShermesCompileParams::StaticLink::off;
-  params.extraCCOptions = cli::ExtraCCOptions;
-  params.libs = cli::Libs;
-  params.libSearchPaths = cli::LibSearchPaths;
-  params.keepTemp = cli::KeepTemp ? ShermesCompileParams::KeepTemp::on
-                                  : ShermesCompileParams::KeepTemp::off;
-  params.verbosity = cli::Verbose.getNumOccurrences();
+  populateCompileParams(params);
+
+  if (!cachePath.empty()) {
+    // Populate the cache, then compile the cached C as on a cache hit. The C
+    // is generated into a temporary directory that is renamed once it is
+    // complete, so that a failed compilation never leaves a partial entry.
+    llvh::SmallString<64> tmpEntryPath{entryPath};
+    llvh::SmallString<64> tmpCachePath{};
+    if (auto EC = llvh::sys::fs::create_directories(cli::CacheDir)) {
+      llvh::errs() << "Error creating " << cli::CacheDir << ": "
+                   << EC.message() << '\n';
+      return false;
+    }
+    llvh::sys::fs::make_absolute(tmpEntryPath);
+    if (auto EC = llvh::sys::fs::createUniqueDirectory(
+            tmpEntryPath + ".tmp", tmpEntryPath)) {
+      llvh::errs() << "Error creating a directory in " << cli::CacheDir
+                   << ": " << EC.message() << '\n';
+      return false;
+    }
+    auto removeTmpEntry = llvh::make_scope_exit(
+        [&tmpEntryPath]() { llvh::sys::fs::remove_directories(tmpEntryPath); });
+    tmpCachePath = tmpEntryPath;
+    llvh::sys::path::append(tmpCachePath, kCompileCacheCFile);
+    if (!shermesCompile(
+            context.get(),
+            M,
+            params,
+            OutputLevelKind::C,
+            cli::InputFilenames[cli::InputFilenames.size() - 1],
+            tmpCachePath,
+            {})) {
+      return false;
+    }
+    // Replace an incomplete entry. If another compilation added the same
+    // entry first, use the C generated here and discard it.
+    if (llvh::sys::fs::exists(entryPath) &&
+        !isCompileCacheEntryComplete(cachePath)) {
+      llvh::sys::fs::remove_directories(entryPath);
+    }
+    if (llvh::sys::fs::rename(tmpEntryPath, entryPath))
+      return compileCFile(tmpCachePath);
+    return compileCFile(cachePath);
+  }
 
   return shermesCompile(
       context.get(),
@@ -992,7 +1306,7 @@ int main(int argc, char **argv) {
       [](llvh::raw_ostream &OS) { OS << "Static Hermes JS Compiler v0.0\n"; });
   llvh::cl::ParseCommandLineOptions(argc, argv, "Static Hermes\n");
 
-  if (!compileFromCommandLineOptions())
+  if (!compileFromCommandLineOptions(llvh::makeArrayRef(argv, argc)))
     return 1;
   return 0;
 }
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+//===----------------------------------------------------------------------===//
+/// \file
+/// Converts a JSON source map into the memory-mappable IndexedSourceMap
+/// format, and symbolicates locations against an existing index:
+///
+///   source-map-index bundle.js.map -out bundle.js.hsmi
+///   source-map-index bundle.js.hsmi -lookup 1:12345 -lookup 1:678
+//===----------------------------------------------------------------------===//
+
+#include "hermes/SourceMap/IndexedSourceMap.h"
+#include "hermes/SourceMap/SourceMapParser.h"
+#include "hermes/Support/SourceErrorManager.h"
+
+#include "llvh/Support/CommandLine.h"
+#include "llvh/Support/FileSystem.h"
+#include "llvh/Support/InitLLVM.h"
+#include "llvh/Support/MemoryBuffer.h"
+#include "llvh/Support/raw_ostream.h"
+
+using namespace hermes;
+
+static llvh::cl::opt<std::string> InputFilename(
+    llvh::cl::desc("input file"),
+    llvh::cl::Required,
+    llvh::cl::Positional);
+
+static llvh::cl::opt<std::string> OutputFilename(
+    "out",
+    llvh::cl::desc("Write the index of the input source map to this file"));
+
+static llvh::cl::list<std::string> Lookup(
+    "lookup",
+    llvh::cl::desc("Symbolicate a 1-based <line>:<column> in the generated "
+                   "file (may be repeated)"));
+
+/// Convert the JSON source map in \p buffer to an index in OutputFilename.
+/// \return the process exit code.
+static int convert(std::unique_ptr<llvh::MemoryBuffer> buffer) {
+  SourceErrorManager sm;
+  std::unique_ptr<SourceMap> sourceMap =
+      SourceMapParser::parse(buffer->getMemBufferRef(), sm);
+  if (!sourceMap)
+    return 1;
+
+  std::error_code EC;
+  llvh::raw_fd_ostream OS(OutputFilename, EC, llvh::sys::fs::F_None);
+  if (EC) {
+    llvh::errs() << "Error opening '" << OutputFilename
+                 << "': " << EC.message() << "\n";
+    return 1;
+  }
+  IndexedSourceMap::write(*sourceMap, OS);
+  return 0;
+}
+
+/// Print the original location of every -lookup argument, as found in the
+/// index in \p buffer, followed by its symbol name if it has one.
+/// \return the process exit code.
+static int lookup(std::unique_ptr<llvh::MemoryBuffer> buffer) {
+  auto indexAndError = IndexedSourceMap::create(std::move(buffer));
+  if (!indexAndError.first) {
+    llvh::errs() << "Error loading '" << InputFilename
+                 << "': " << indexAndError.second << "\n";
+    return 1;
+  }
+  const IndexedSourceMap &index = *indexAndError.first;
+
+  int result = 0;
+  for (llvh::StringRef arg : Lookup) {
+    llvh::StringRef lineStr, columnStr;
+    std::tie(lineStr, columnStr) = arg.split(':');
+    unsigned line, column;
+    if (lineStr.getAsInteger(10, line) || columnStr.getAsInteger(10, column) ||
+        line == 0 || column == 0) {
+      llvh::errs() << "Invalid location '" << arg
+                   << "', expected <line>:<column>\n";
+      result = 1;
+      continue;
+    }
+    llvh::outs() << arg << ": ";
+    auto seg = index.getSegmentForAddress(line, column);
+    if (seg && seg->representedLocation) {
+      const auto &loc = *seg->representedLocation;
+      llvh::outs() << index.getSourceFullPath(loc.sourceIndex) << ':'
+                   << loc.lineIndex + 1 << ':' << loc.columnIndex + 1;
+      if (loc.nameIndex)
+        llvh::outs() << ' ' << index.getName(*loc.nameIndex);
+      llvh::outs() << '\n';
+    } else {
+      llvh::outs() << "<unmapped>\n";
+    }
+  }
+  return result;
+}
+
+int main(int argc, char **argv) {
+  llvh::InitLLVM initLLVM(argc, argv);
+  llvh::cl::ParseCommandLineOptions(
+      argc, argv, "Hermes source map index tool\n");
+
+  // Large files are mmapped. The JSON parser needs the null terminator.
+  llvh::ErrorOr<std::unique_ptr<llvh::MemoryBuffer>> fileBufOrErr =
+      llvh::MemoryBuffer::getFile(InputFilename);
+  if (!fileBufOrErr) {
+    llvh::errs() << "Error reading '" << InputFilename
+                 << "': " << fileBufOrErr.getError().message() << "\n";
+    return 1;
+  }
+
+  if (IndexedSourceMap::isIndexedSourceMap((*fileBufOrErr)->getBuffer())) {
+    if (!OutputFilename.empty()) {
+      llvh::errs() << "'" << InputFilename << "' is already an index\n";
+      return 1;
+    }
+    return lookup(std::move(*fileBufOrErr));
+  }
+
+  if (OutputFilename.empty() || !Lookup.empty()) {
+    llvh::errs() << "A JSON source map requires -out and cannot be queried "
+                    "with -lookup\n";
+    return 1;
+  }
+  return convert(std::move(*fileBufOrErr));
+}
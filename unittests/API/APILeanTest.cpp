@@ -7,6 +7,7 @@
 
 #include <gtest/gtest.h>
 #include <hermes/hermes.h>
+#include <jsi/instrumentation.h>
 #include <jsi/jsi.h>
 
 using namespace facebook::jsi;
@@ -39,4 +40,97 @@ TEST_F(HermesLeanRuntimeTest, ArrayTest) {
     EXPECT_EQ(array.getValueAtIndex(*rt, i).asNumber(), i);
 }
 
+TEST_F(HermesLeanRuntimeTest, CreateObjectWithPropertiesTest) {
+  PropNameID names[] = {
+      PropNameID::forAscii(*rt, "a"),
+      PropNameID::forAscii(*rt, "b"),
+      PropNameID::forAscii(*rt, "0"),
+      PropNameID::forAscii(*rt, "a")};
+  Value values[] = {
+      Value(1), String::createFromAscii(*rt, "two"), Value(true), Value(4)};
+  Object obj = rt->createObjectWithProperties(names, values, 4);
+  // Properties are set in order, so the last duplicate wins.
+  EXPECT_EQ(obj.getProperty(*rt, "a").getNumber(), 4);
+  EXPECT_EQ(obj.getProperty(*rt, "b").getString(*rt).utf8(*rt), "two");
+  // Index-like names become elements.
+  EXPECT_TRUE(obj.getProperty(*rt, "0").getBool());
+  EXPECT_EQ(obj.getPropertyNames(*rt).size(*rt), 3u);
+
+  Object empty = rt->createObjectWithProperties(nullptr, nullptr, 0);
+  EXPECT_EQ(empty.getPropertyNames(*rt).size(*rt), 0u);
+}
+
+TEST_F(HermesLeanRuntimeTest, GetPropertiesTest) {
+  Object obj(*rt);
+  obj.setProperty(*rt, "x", 1);
+  obj.setProperty(*rt, "y", "why");
+  PropNameID names[] = {
+      PropNameID::forAscii(*rt, "y"),
+      PropNameID::forAscii(*rt, "missing"),
+      PropNameID::forAscii(*rt, "x")};
+  Value out[3];
+  rt->getProperties(obj, names, 3, out);
+  EXPECT_EQ(out[0].getString(*rt).utf8(*rt), "why");
+  EXPECT_TRUE(out[1].isUndefined());
+  EXPECT_EQ(out[2].getNumber(), 1);
+}
+
+TEST_F(HermesLeanRuntimeTest, CreateArrayFromValuesTest) {
+  Value values[] = {Value(1), Value::null(), String::createFromAscii(*rt, "s")};
+  Array array = rt->createArrayFromValues(values, 3);
+  EXPECT_EQ(array.size(*rt), 3u);
+  EXPECT_EQ(array.getValueAtIndex(*rt, 0).getNumber(), 1);
+  EXPECT_TRUE(array.getValueAtIndex(*rt, 1).isNull());
+  EXPECT_EQ(array.getValueAtIndex(*rt, 2).getString(*rt).utf8(*rt), "s");
+  // The array is a regular JS array.
+  array.getPropertyAsFunction(*rt, "push").callWithThis(*rt, array, 4);
+  EXPECT_EQ(array.size(*rt), 4u);
+
+  EXPECT_EQ(rt->createArrayFromValues(nullptr, 0).size(*rt), 0u);
+}
+
+TEST_F(HermesLeanRuntimeTest, ScopeTest) {
+  auto scopeInfo = [this](const char *name) {
+    return rt->instrumentation().getHeapInfo(false).at(name);
+  };
+  Value escaped;
+  {
+    Scope outer(*rt);
+    Value kept = String::createFromAscii(*rt, "kept");
+    {
+      Scope inner(*rt);
+      for (int i = 0; i < 100; ++i)
+        Object tmp(*rt);
+      escaped = String::createFromAscii(*rt, "escaped");
+      EXPECT_GT(scopeInfo("hermes_jsiScopeValueSlots"), 100);
+    }
+    // Only the chunk holding the escaped value outlives the inner scope.
+    EXPECT_EQ(scopeInfo("hermes_jsiEscapedScopeChunks"), 1);
+    rt->instrumentation().collectGarbage("test");
+    EXPECT_EQ(kept.getString(*rt).utf8(*rt), "kept");
+    EXPECT_EQ(escaped.getString(*rt).utf8(*rt), "escaped");
+  }
+  // Values outside of a scope are unaffected.
+  Object obj(*rt);
+  obj.setProperty(*rt, "escaped", escaped);
+  rt->instrumentation().collectGarbage("test");
+  EXPECT_EQ(
+      obj.getProperty(*rt, "escaped").getString(*rt).utf8(*rt), "escaped");
+
+  // Releasing escaped values lets their chunks be freed.
+  escaped = Value();
+  for (int i = 0; i < 16; ++i) {
+    Scope scope(*rt);
+    escaped = Object(*rt);
+  }
+  escaped = Value();
+  {
+    Scope scope(*rt);
+  }
+  EXPECT_LT(scopeInfo("hermes_jsiEscapedScopeChunks"), 16);
+  EXPECT_EQ(
+      scopeInfo("hermes_jsiScopeValueSlots"),
+      scopeInfo("hermes_jsiEscapedScopeChunks") * 16);
+}
+
 } // namespace
@@ -8,6 +8,7 @@
 #include "hermes/Parser/JSParser.h"
 #include "DiagContext.h"
 #include "hermes/AST/Config.h"
+#include "hermes/AST/ESTreeJSONDumper.h"
 
 #include "gtest/gtest.h"
 
@@ -298,4 +299,59 @@ TEST(JSParserTest, TestStoredTokens) {
 #endif
 }
 
+
+/// \return a program large enough to be split by the parallel parser, whose
+/// statements exercise the heuristics used to find the split points.
+std::string makeLargeProgram() {
+  std::string src = "'use strict';\n";
+  for (unsigned i = 0; i < 3000; ++i) {
+    std::string n = std::to_string(i);
+    src += "function f" + n + "(a) { return `${a}/${[a]}` + /[;}]/.source; }\n";
+    src += "var v" + n + " = f" + n + "(" + n + ") / 2;\n";
+    src += "if (v" + n + ") v" + n + "++; else v" + n + "--;\n";
+    src += "do v" + n + "--; while (v" + n + " > 0);\n";
+  }
+  return src;
+}
+
+/// Parse \p src using \p jobs threads and \return the AST with locations as
+/// JSON, or an empty string on error.
+std::string parseToJSON(llvh::StringRef src, unsigned jobs) {
+  Context context;
+  context.setParseJobs(jobs);
+  JSParser parser(context, src);
+  auto parsed = parser.parse();
+  if (!parsed)
+    return "";
+  std::string json;
+  llvh::raw_string_ostream os(json);
+  dumpESTreeJSON(
+      os,
+      *parsed,
+      false,
+      ESTreeDumpMode::HideEmpty,
+      context.getSourceErrorManager(),
+      LocationDumpMode::Range);
+  return os.str();
+}
+
+TEST(JSParserTest, TestParallelParse) {
+  std::string src = makeLargeProgram();
+  std::string serial = parseToJSON(src, 1);
+  ASSERT_FALSE(serial.empty());
+  EXPECT_EQ(serial, parseToJSON(src, 4));
+}
+
+TEST(JSParserTest, TestParallelParseErr) {
+  std::string src = makeLargeProgram();
+  src.insert(src.find('\n', src.size() / 2) + 1, "var +;\n");
+  Context context;
+  context.setParseJobs(4);
+  DiagContext diag(context);
+  JSParser parser(context, src);
+  auto parsed = parser.parse();
+  ASSERT_FALSE(parsed.hasValue());
+  ASSERT_EQ(1, diag.getErrCountClear());
+}
+
 }; // anonymous namespace
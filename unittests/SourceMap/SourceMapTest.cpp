@@ -6,6 +6,7 @@
  */
 
 #include "hermes/Parser/JSONParser.h"
+#include "hermes/SourceMap/IndexedSourceMap.h"
 #include "hermes/SourceMap/SourceMapGenerator.h"
 #include "hermes/SourceMap/SourceMapParser.h"
 #include "hermes/Support/Base64vlq.h"
@@ -553,6 +554,116 @@ TEST(SourceMap, EmptyLines) {
       *sourceMap, generatedLine, sources, loc(28, sourceIndex, 2, 10));
 }
 
+/// Serialize \p sourceMap as an index and load it back.
+std::unique_ptr<IndexedSourceMap> makeIndex(const SourceMap &sourceMap) {
+  std::string storage;
+  llvh::raw_string_ostream OS(storage);
+  IndexedSourceMap::write(sourceMap, OS);
+  auto indexAndError = IndexedSourceMap::create(
+      llvh::MemoryBuffer::getMemBufferCopy(OS.str(), "index"));
+  EXPECT_EQ(indexAndError.second, "");
+  return std::move(indexAndError.first);
+}
+
+/// Check that every lookup in \p index matches \p sourceMap, including
+/// columns between segments and past the last line.
+void verifyIndexMatches(
+    const SourceMap &sourceMap,
+    const IndexedSourceMap &index) {
+  ASSERT_EQ(index.getNumSourcePaths(), sourceMap.getNumSourcePaths());
+  for (uint32_t i = 0, e = sourceMap.getNumSourcePaths(); i < e; ++i)
+    EXPECT_EQ(index.getSourceFullPath(i), sourceMap.getSourceFullPath(i));
+  ASSERT_EQ(index.getNumNames(), sourceMap.getNumNames());
+  for (uint32_t i = 0, e = sourceMap.getNumNames(); i < e; ++i)
+    EXPECT_EQ(index.getName(i), sourceMap.getName(i));
+
+  for (uint32_t line = 1, e = sourceMap.getLines().size() + 2; line < e;
+       ++line) {
+    for (uint32_t column = 1; column < 40; ++column) {
+      auto expected = sourceMap.getSegmentForAddress(line, column);
+      auto actual = index.getSegmentForAddress(line, column);
+      ASSERT_EQ(actual.hasValue(), expected.hasValue());
+      if (!expected)
+        continue;
+      EXPECT_EQ(actual->generatedColumn, expected->generatedColumn);
+      ASSERT_EQ(
+          actual->representedLocation.hasValue(),
+          expected->representedLocation.hasValue());
+      if (!expected->representedLocation)
+        continue;
+      const auto &exp = *expected->representedLocation;
+      const auto &act = *actual->representedLocation;
+      EXPECT_EQ(act.sourceIndex, exp.sourceIndex);
+      EXPECT_EQ(act.lineIndex, exp.lineIndex);
+      EXPECT_EQ(act.columnIndex, exp.columnIndex);
+      EXPECT_EQ(act.nameIndex, exp.nameIndex);
+
+      auto expectedLoc = sourceMap.getLocationForAddress(line, column);
+      auto actualLoc = index.getLocationForAddress(line, column);
+      ASSERT_TRUE(actualLoc.hasValue());
+      EXPECT_EQ(actualLoc->fileName, expectedLoc->fileName);
+      EXPECT_EQ(actualLoc->line, expectedLoc->line);
+      EXPECT_EQ(actualLoc->column, expectedLoc->column);
+    }
+  }
+}
+
+TEST(SourceMap, IndexedRoundTrip) {
+  for (const char *json :
+       {TestMap, TestMapNoSourceRoot, TestMapEmptySourceRoot, TestMapEmptyLines}) {
+    SourceErrorManager sm;
+    SimpleDiagHandlerRAII diagHandler(sm);
+    std::unique_ptr<SourceMap> sourceMap = SourceMapParser::parse(json, sm);
+    ASSERT_TRUE(sourceMap);
+    std::unique_ptr<IndexedSourceMap> index = makeIndex(*sourceMap);
+    ASSERT_TRUE(index);
+    verifyIndexMatches(*sourceMap, *index);
+  }
+}
+
+TEST(SourceMap, IndexedNames) {
+  SourceErrorManager sm;
+  SimpleDiagHandlerRAII diagHandler(sm);
+  std::unique_ptr<SourceMap> sourceMap = SourceMapParser::parse(TestMap, sm);
+  ASSERT_TRUE(sourceMap);
+  std::unique_ptr<IndexedSourceMap> index = makeIndex(*sourceMap);
+  ASSERT_TRUE(index);
+
+  // The segment "SAAUA" starts at generated 1:19 and names "bar".
+  auto seg = index->getSegmentForAddress(1, 19);
+  ASSERT_TRUE(seg.hasValue() && seg->representedLocation.hasValue());
+  ASSERT_TRUE(seg->representedLocation->nameIndex.hasValue());
+  EXPECT_EQ(index->getName(*seg->representedLocation->nameIndex), "bar");
+
+  // The segment "OAAOC" starts at generated 1:29 and names "baz".
+  seg = index->getSegmentForAddress(1, 29);
+  ASSERT_TRUE(seg.hasValue() && seg->representedLocation.hasValue());
+  ASSERT_TRUE(seg->representedLocation->nameIndex.hasValue());
+  EXPECT_EQ(index->getName(*seg->representedLocation->nameIndex), "baz");
+}
+
+TEST(SourceMap, IndexedInvalid) {
+  SourceErrorManager sm;
+  SimpleDiagHandlerRAII diagHandler(sm);
+  std::unique_ptr<SourceMap> sourceMap = SourceMapParser::parse(TestMap, sm);
+  ASSERT_TRUE(sourceMap);
+  std::string storage;
+  llvh::raw_string_ostream OS(storage);
+  IndexedSourceMap::write(*sourceMap, OS);
+  OS.flush();
+
+  EXPECT_TRUE(IndexedSourceMap::isIndexedSourceMap(storage));
+  EXPECT_FALSE(IndexedSourceMap::isIndexedSourceMap(TestMap));
+
+  auto truncated = IndexedSourceMap::create(llvh::MemoryBuffer::getMemBufferCopy(
+      llvh::StringRef(storage).drop_back(1), "index"));
+  EXPECT_FALSE(truncated.first);
+
+  auto notIndex = IndexedSourceMap::create(
+      llvh::MemoryBuffer::getMemBufferCopy(TestMap, "index"));
+  EXPECT_FALSE(notIndex.first);
+}
+
 TEST(SourceMap, VLQRandos) {
   // clang-format off
   const std::vector<int32_t> inputs = {0, 1, -1, 2, -2, 5298, -23498,
@@ -9,7 +9,9 @@
 
 #include "hermes/Support/BigIntSupport.h"
 #include "hermes/Support/BigIntTestHelpers.h"
+#include "llvh/ADT/APInt.h"
 #include "llvh/ADT/Optional.h"
+#include "llvh/ADT/SmallString.h"
 #include "llvh/ADT/bit.h"
 
 #include <limits>
@@ -816,4 +818,124 @@ TEST(BigIntTest, toDouble) {
 #include "BigIntSupportTest_ToDouble.inc"
 }
 
+
+/// \return a BigInt with \p numDigits pseudo-random digits, drawn from the
+/// generator \p state.
+std::vector<BigIntDigitType> randomDigits(uint64_t &state, uint32_t numDigits) {
+  std::vector<BigIntDigitType> digits(numDigits);
+  for (BigIntDigitType &d : digits) {
+    // splitmix64, which is good enough to exercise carries and borrows.
+    state += 0x9e3779b97f4a7c15ull;
+    uint64_t z = state;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    d = z ^ (z >> 31);
+  }
+  return digits;
+}
+
+/// Make the BigInt in \p digits negative if \p negative is true, and positive
+/// otherwise.
+void setSign(std::vector<BigIntDigitType> &digits, bool negative) {
+  constexpr BigIntDigitType kSignBit = 1ull << (BigIntDigitSizeInBits - 1);
+  digits.back() =
+      negative ? digits.back() | kSignBit : digits.back() & ~kSignBit;
+}
+
+/// \return \p src sign-extended to an APInt with \p numBits bits.
+llvh::APInt toAPInt(ImmutableBigIntRef src, unsigned numBits) {
+  if (src.numDigits == 0) {
+    return llvh::APInt(numBits, 0);
+  }
+  return llvh::APInt(
+             src.numDigits * BigIntDigitSizeInBits,
+             llvh::makeArrayRef(src.digits, src.numDigits))
+      .sext(numBits);
+}
+
+TEST(BigIntTest, largeMultiplyDivideTest) {
+  // The sizes straddle the threshold at which multiplication switches to
+  // Karatsuba's algorithm, and include unbalanced operands.
+  static const uint32_t kSizes[] = {1, 2, 31, 32, 33, 64, 65, 100, 257};
+  uint64_t state = 0;
+  for (uint32_t lhsSize : kSizes) {
+    for (uint32_t rhsSize : kSizes) {
+      // Try every combination of signs, with bit 0 of signs for lhs and bit 1
+      // for rhs.
+      for (unsigned signs = 0; signs < 4; ++signs) {
+        std::vector<BigIntDigitType> lhsDigits = randomDigits(state, lhsSize);
+        std::vector<BigIntDigitType> rhsDigits = randomDigits(state, rhsSize);
+        setSign(lhsDigits, signs & 1);
+        setSign(rhsDigits, signs & 2);
+        ImmutableBigIntRef lhs{lhsDigits.data(), lhsSize};
+        ImmutableBigIntRef rhs{rhsDigits.data(), rhsSize};
+
+        uint32_t mulSize = multiplyResultSize(lhs, rhs);
+        const unsigned mulBits = mulSize * BigIntDigitSizeInBits;
+        std::vector<BigIntDigitType> product(mulSize);
+        MutableBigIntRef dst{product.data(), mulSize};
+        EXPECT_EQ(multiply(dst, lhs, rhs), OperationStatus::RETURNED);
+        EXPECT_EQ(
+            toAPInt(ImmutableBigIntRef{dst.digits, dst.numDigits}, mulBits),
+            toAPInt(lhs, mulBits) * toAPInt(rhs, mulBits))
+            << lhsSize << " * " << rhsSize;
+
+        uint32_t divSize = divideResultSize(lhs, rhs);
+        const unsigned divBits = divSize * BigIntDigitSizeInBits;
+        std::vector<BigIntDigitType> quocDigits(divSize);
+        MutableBigIntRef quoc{quocDigits.data(), divSize};
+        EXPECT_EQ(divide(quoc, lhs, rhs), OperationStatus::RETURNED);
+        EXPECT_EQ(
+            toAPInt(ImmutableBigIntRef{quoc.digits, quoc.numDigits}, divBits),
+            toAPInt(lhs, divBits).sdiv(toAPInt(rhs, divBits)))
+            << lhsSize << " / " << rhsSize;
+
+        uint32_t remSize = remainderResultSize(lhs, rhs);
+        const unsigned remBits = remSize * BigIntDigitSizeInBits;
+        std::vector<BigIntDigitType> remDigits(remSize);
+        MutableBigIntRef rem{remDigits.data(), remSize};
+        EXPECT_EQ(remainder(rem, lhs, rhs), OperationStatus::RETURNED);
+        EXPECT_EQ(
+            toAPInt(ImmutableBigIntRef{rem.digits, rem.numDigits}, remBits),
+            toAPInt(lhs, remBits).srem(toAPInt(rhs, remBits)))
+            << lhsSize << " % " << rhsSize;
+      }
+    }
+  }
+}
+
+TEST(BigIntTest, largeToStringTest) {
+  uint64_t state = 1;
+  for (uint32_t numDigits : {1, 2, 3, 17, 64}) {
+    std::vector<BigIntDigitType> digits = randomDigits(state, numDigits);
+    // Zero a digit in the middle of the number, which produces zeros in the
+    // middle of the string, in every radix.
+    digits[numDigits / 2] = 0;
+    for (bool negate : {false, true}) {
+      setSign(digits, negate);
+      ImmutableBigIntRef src{digits.data(), numDigits};
+      for (uint8_t radix : {2, 8, 10, 16, 36}) {
+        llvh::SmallString<128> expected;
+        toAPInt(src, numDigits * BigIntDigitSizeInBits)
+            .toString(expected, radix, /* Signed */ true);
+        EXPECT_EQ(toString(src, radix), expected.str().lower())
+            << numDigits << " digits in radix " << unsigned(radix);
+      }
+    }
+  }
+
+  // Powers of the radix are exactly one character longer than the largest
+  // number that fits in the chunk size used by toString.
+  std::vector<BigIntDigitType> one{1, 0};
+  EXPECT_EQ(toString(ImmutableBigIntRef{one.data(), 1}, 10), "1");
+  std::vector<BigIntDigitType> tenTo19{10000000000000000000ull, 0};
+  EXPECT_EQ(
+      toString(ImmutableBigIntRef{tenTo19.data(), 2}, 10),
+      "10000000000000000000");
+  std::vector<BigIntDigitType> tenTo19Minus1{9999999999999999999ull, 0};
+  EXPECT_EQ(
+      toString(ImmutableBigIntRef{tenTo19Minus1.data(), 2}, 10),
+      "9999999999999999999");
+}
+
 } // namespace
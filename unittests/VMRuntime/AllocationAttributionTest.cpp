@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#if defined(HERMES_MEMORY_INSTRUMENTATION) && defined(HERMESVM_GC_HADES)
+
+#include "TestHelpers.h"
+#include "hermes/VM/DummyObject.h"
+#include "hermes/VM/GC.h"
+
+#include "llvh/Support/raw_ostream.h"
+
+#include "gtest/gtest.h"
+
+using namespace hermes::vm;
+
+namespace {
+
+using testhelpers::DummyObject;
+
+struct AllocationAttributionTest : public ::testing::Test {
+  std::shared_ptr<DummyRuntime> runtime;
+  DummyRuntime &rt;
+  AllocationAttributionTest()
+      : runtime(DummyRuntime::create(kTestGCConfigSmall)), rt(*runtime) {}
+
+  /// \return the allocation report of the heap as a JSON string.
+  std::string report() {
+    std::string out;
+    llvh::raw_string_ostream os(out);
+    rt.getHeap().getSamplingAllocationTracker().emitAttribution(os);
+    return os.str();
+  }
+};
+
+TEST_F(AllocationAttributionTest, YoungAndOldGen) {
+  int function;
+  rt.currentFunctionForProfiling = &function;
+  rt.currentFunctionNameForProfiling = "f";
+  // A tiny interval samples every allocation.
+  rt.getHeap().getSamplingAllocationTracker().enableAttribution(1, 0);
+
+  GCScope scope{rt};
+  // Three young objects that survive, two that die, and two allocated
+  // directly in the old generation.
+  for (int i = 0; i < 3; ++i)
+    rt.makeHandle(DummyObject::create(rt.getHeap(), rt));
+  for (int i = 0; i < 2; ++i)
+    DummyObject::create(rt.getHeap(), rt);
+  for (int i = 0; i < 2; ++i)
+    rt.makeHandle(DummyObject::createLongLived(rt.getHeap()));
+
+  std::string before = report();
+  EXPECT_NE(std::string::npos, before.find("\"name\":\"f\""));
+  EXPECT_NE(std::string::npos, before.find("\"samples\":7"));
+  EXPECT_NE(std::string::npos, before.find("\"allocatedOldGen\":2"));
+  EXPECT_NE(std::string::npos, before.find("\"survivedYoungGen\":0"));
+  EXPECT_NE(std::string::npos, before.find("\"liveSamples\":7"));
+
+  rt.collect();
+
+  // Old-gen allocations are not counted as young-gen survivors.
+  std::string after = report();
+  EXPECT_NE(std::string::npos, after.find("\"allocatedOldGen\":2"));
+  EXPECT_NE(std::string::npos, after.find("\"survivedYoungGen\":3"));
+  EXPECT_NE(std::string::npos, after.find("\"liveSamples\":5"));
+}
+
+TEST_F(AllocationAttributionTest, OutsideFunctions) {
+  // Allocations made while no JS function is running are not attributed.
+  rt.getHeap().getSamplingAllocationTracker().enableAttribution(1, 0);
+  GCScope scope{rt};
+  rt.makeHandle(DummyObject::create(rt.getHeap(), rt));
+  EXPECT_NE(std::string::npos, report().find("\"functions\":[]"));
+}
+
+} // namespace
+
+#endif // HERMES_MEMORY_INSTRUMENTATION && HERMESVM_GC_HADES
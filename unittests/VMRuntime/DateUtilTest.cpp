@@ -7,6 +7,7 @@
 
 #include "TestHelpers.h"
 
+#include "hermes/VM/JSLib/DateCache.h"
 #include "hermes/VM/JSLib/DateUtil.h"
 
 #include <cstdlib>
@@ -268,6 +269,42 @@ TEST(DateUtilTest, LocalTimeTest) {
   hermes::oscompat::unset_env("TZ");
 }
 
+TEST(DateUtilTest, LocalTimeOffsetCacheTest) {
+  // The cached conversions must match the uncached ones, including around DST
+  // transitions and in years mapped to equivalent years.
+  LocalTimeOffsetCache cache;
+#ifdef _WINDOWS
+  const char *zones[] = {"PST8PDT", "EST5EDT", "JST-9"};
+#else
+  const char *zones[] = {
+      "America/Los_Angeles", "Pacific/Auckland", "Asia/Tokyo"};
+#endif
+  for (const char *zone : zones) {
+    hermes::oscompat::set_env("TZ", zone);
+    // The cache only checks the TZ environment variable periodically.
+    cache.reset();
+    EXPECT_EQ(localTZA(), cache.localTZA()) << zone;
+    // Every 59 minutes and 59 seconds of 2017 and 2018.
+    for (double t = 1483228800000; t < 1546300800000; t += 3599000) {
+      EXPECT_EQ(daylightSavingTA(t), cache.daylightSavingTA(t))
+          << zone << " " << t;
+      EXPECT_EQ(localTime(t), cache.localTime(t)) << zone << " " << t;
+      EXPECT_EQ(utcTime(t), cache.utcTime(t)) << zone << " " << t;
+    }
+    // 1900, 2100, and close to the ends of the time range, where utcTime()
+    // is NaN if the adjustment takes its argument out of range.
+    for (double t : {-2208988800000.0, 4102444800000.0, -8.6e15, 8.6e15}) {
+      EXPECT_EQ(localTime(t), cache.localTime(t)) << zone << " " << t;
+      EXPECT_EQ(utcTime(t), cache.utcTime(t)) << zone << " " << t;
+    }
+  }
+  EXPECT_TRUE(std::isnan(cache.daylightSavingTA(
+      std::numeric_limits<double>::quiet_NaN())));
+  EXPECT_TRUE(std::isnan(cache.localTime(8.64e18)));
+
+  hermes::oscompat::unset_env("TZ");
+}
+
 TEST(DateUtilTest, HoursMinutesSecondsMsTest) {
   // Uses the formulae from spec, perform sanity check.
   double t = 0;
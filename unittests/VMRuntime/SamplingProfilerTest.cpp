@@ -11,6 +11,8 @@
 
 #include "hermes/VM/Runtime.h"
 
+#include "llvh/Support/raw_ostream.h"
+
 #include <gtest/gtest.h>
 
 namespace {
@@ -41,7 +43,9 @@ TEST(SamplingProfilerTest, Invariants) {
 }
 
 #ifndef __APPLE__
-TEST(SamplingProfilerTest, MultipleRuntimes) {
+// Static Hermes registers its internal unit with only one active runtime at a
+// time, so these tests cannot create several runtimes at once.
+TEST(SamplingProfilerTest, DISABLED_MultipleRuntimes) {
   auto rt0 = makeRuntime(withSamplingProfilerEnabled);
   auto rt1 = makeRuntime(withSamplingProfilerEnabled);
   auto rt2 = makeRuntime(withSamplingProfilerEnabled);
@@ -63,6 +67,54 @@ TEST(SamplingProfilerTest, MultipleProfilers) {
 }
 #endif
 
+/// \return a sample with one suspend frame per name in \p names, leaf first.
+SamplingProfiler::StackTrace makeSample(
+    std::initializer_list<const std::string *> names) {
+  SamplingProfiler::StackTrace sample{0};
+  for (const std::string *name : names) {
+    SamplingProfiler::StackFrame frame;
+    frame.kind = SamplingProfiler::StackFrame::FrameKind::SuspendFrame;
+    frame.suspendFrame = name;
+    sample.stack.push_back(frame);
+  }
+  return sample;
+}
+
+TEST(SamplingProfilerTest, AggregatedFoldedStacks) {
+  auto rt = makeRuntime(withSamplingProfilerEnabled);
+  SamplingProfiler &sp = *rt->samplingProfiler;
+  const std::string a{"a"}, b{"b"}, c{"c"}, d{"d"};
+
+  // Room for the root, the truncated node and three frames.
+  sp.setAggregation(5);
+  sp.aggregateSampleForTesting(makeSample({&b, &a}));
+  sp.aggregateSampleForTesting(makeSample({&b, &a}));
+  sp.aggregateSampleForTesting(makeSample({&a}));
+  sp.aggregateSampleForTesting(makeSample({&c, &a}));
+  // The tree is full, so these samples are truncated instead of being charged
+  // to a caller or to the root.
+  sp.aggregateSampleForTesting(makeSample({&d, &a}));
+  sp.aggregateSampleForTesting(makeSample({&d}));
+  sp.aggregateSampleForTesting(makeSample({}));
+
+  std::string out;
+  llvh::raw_string_ostream os(out);
+  sp.dumpAggregatedProfile(os);
+  EXPECT_EQ(
+      os.str(),
+      "[a] 1\n"
+      "[a];[b] 2\n"
+      "[a];[c] 1\n"
+      "[truncated] 2\n"
+      "[idle] 1\n");
+
+  // Dumping resets the tree.
+  out.clear();
+  sp.aggregateSampleForTesting(makeSample({&d}));
+  sp.dumpAggregatedProfile(os);
+  EXPECT_EQ(os.str(), "[d] 1\n");
+}
+
 } // namespace
 
 #endif // HERMESVM_SAMPLING_PROFILER_AVAILABLE
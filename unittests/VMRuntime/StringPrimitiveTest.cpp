@@ -328,4 +328,51 @@ TEST_F(StringPrimTest, FastConcatTest) {
   EXPECT_TRUE(utf16Ref.size() == utfStr3.size());
   EXPECT_TRUE(std::equal(utfStr3.begin(), utfStr3.end(), utf16Ref.begin()));
 }
+
+TEST_F(StringPrimTest, HostStringTest) {
+  std::string host(StringPrimitive::EXTERNAL_STRING_MIN_SIZE, 'h');
+  int releases = 0;
+  auto release = [](void *context) { ++*static_cast<int *>(context); };
+  {
+    GCScope scope{runtime};
+    auto cr = ExternalASCIIStringPrimitive::createFromHost(
+        runtime,
+        llvh::ArrayRef<char>(host.data(), host.size()),
+        release,
+        &releases);
+    ASSERT_NE(ExecutionStatus::EXCEPTION, cr);
+    auto str = runtime.makeHandle<ExternalASCIIStringPrimitive>(*cr);
+
+    // The characters are not copied out of the host buffer.
+    auto ref = str->getStringRef<char>();
+    EXPECT_EQ(host.data(), ref.data());
+    EXPECT_EQ(host.size(), ref.size());
+
+    // The string stays alive, and the buffer in use, while it is reachable.
+    runtime.collect("test");
+    EXPECT_EQ(0, releases);
+    EXPECT_EQ(host.data(), str->getStringRef<char>().data());
+  }
+
+  // Once the string is unreachable, the GC releases the buffer exactly once.
+  runtime.collect("test");
+  EXPECT_EQ(1, releases);
+  runtime.collect("test");
+  EXPECT_EQ(1, releases);
+}
+
+TEST_F(StringPrimTest, HostStringTooLongTest) {
+  int releases = 0;
+  auto release = [](void *context) { ++*static_cast<int *>(context); };
+  // The characters are never read, so the buffer need not be that long.
+  char16_t c = u'x';
+  auto cr = ExternalUTF16StringPrimitive::createFromHost(
+      runtime,
+      llvh::ArrayRef<char16_t>(&c, StringPrimitive::MAX_STRING_LENGTH + 1),
+      release,
+      &releases);
+  EXPECT_TRUE(isException(cr));
+  runtime.collect("test");
+  EXPECT_EQ(0, releases);
+}
 } // namespace
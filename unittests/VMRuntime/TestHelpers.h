@@ -364,6 +364,17 @@ class DummyRuntime final : public HandleRootOwner, public RuntimeBase {
   StackTracesTree *getStackTracesTree() {
     return nullptr;
   }
+
+  const void *getCurrentFunctionForProfiling(std::string *name) {
+    if (name)
+      *name = currentFunctionNameForProfiling;
+    return currentFunctionForProfiling;
+  }
+
+  /// The key and name reported as the innermost JS function, so that tests
+  /// can attribute allocations without running JS.
+  const void *currentFunctionForProfiling = nullptr;
+  std::string currentFunctionNameForProfiling;
 #endif
 
  private:
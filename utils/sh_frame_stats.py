@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+# Copyright (c) Meta Platforms, Inc. and affiliates.
+#
+# This source code is licensed under the MIT license found in the
+# LICENSE file in the root directory of this source tree.
+
+# -*- coding: utf-8 -*-
+
+""" Register allocation metrics for the Static Hermes C backend.
+
+Compiles each JS file with 'shermes -emit-c' and measures the generated C:
+  frame   total number of frame registers (the size passed to _sh_enter)
+  locals  total number of GC-visible locals (locals.head.count)
+  np      number of distinct non-pointer registers, summed over functions
+  movs    register-to-register copies
+
+This works with release builds, where LLVM-style statistics are disabled.
+Files whose path mentions 'typed' (but not 'untyped') are compiled with
+-typed.
+"""
+
+import argparse
+import re
+import subprocess
+import sys
+
+
+METRIC_KEYS = ["frame", "locals", "np", "movs"]
+
+REG = r"(?:locals\.t\d+|frame\[\d+\]|np\d+)"
+MOV_RE = re.compile(r"^\s*" + REG + r" = " + REG + r";$")
+FRAME_RE = re.compile(r"_sh_enter\(shr, &locals\.head, (\d+)\)")
+LOCALS_RE = re.compile(r"locals\.head\.count =(\d+);")
+NP_RE = re.compile(r"\bnp(\d+)\b")
+
+
+def measure_c(source):
+    """Returns a dict of metrics for the generated C in \p source."""
+    nps = 0
+    for fn in source.split("\nstatic SHLegacyValue ")[1:]:
+        nps += len(set(NP_RE.findall(fn)))
+    return {
+        "frame": sum(int(m) for m in FRAME_RE.findall(source)),
+        "locals": sum(int(m) for m in LOCALS_RE.findall(source)),
+        "np": nps,
+        "movs": sum(1 for line in source.splitlines() if MOV_RE.match(line)),
+    }
+
+
+def is_typed(path):
+    return "typed" in path and "untyped" not in path
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().split("\n")[0])
+    parser.add_argument("shermes", help="path to the shermes binary")
+    parser.add_argument("files", nargs="+", help="JS files to compile")
+    parser.add_argument("--opt", default="-O", help="optimization flag")
+    args = parser.parse_args()
+
+    totals = dict.fromkeys(METRIC_KEYS, 0)
+    for path in args.files:
+        cmd = [args.shermes, args.opt, "-emit-c", path, "-o", "-"]
+        if is_typed(path):
+            cmd.insert(2, "-typed")
+        proc = subprocess.run(cmd, capture_output=True, text=True)
+        if proc.returncode != 0:
+            print("%-60s failed to compile" % path, file=sys.stderr)
+            continue
+        metrics = measure_c(proc.stdout)
+        for k in METRIC_KEYS:
+            totals[k] += metrics[k]
+        print("%-60s %s" % (path, " ".join("%s=%6d" % (k, metrics[k]) for k in METRIC_KEYS)))
+    print("%-60s %s" % ("TOTAL", " ".join("%s=%6d" % (k, totals[k]) for k in METRIC_KEYS)))
+
+
+if __name__ == "__main__":
+    main()